@@ -38,6 +38,11 @@
 // <q SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING> Enables measurement of interrupt masking time for debugging purposes.
 // <i> Default: 0
 #define SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING    0
+
+// <q SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM> Records a histogram of interrupt masking times and the call sites of the longest ones.
+// <i> Requires SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING.
+// <i> Default: 0
+#define SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM 0
 // </h>
 
 // <<< end of configuration section >>>
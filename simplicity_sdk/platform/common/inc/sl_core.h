@@ -63,6 +63,10 @@ extern "C" {
  * @code{.c}
  * // Enables debug methods to measure the time spent in critical sections.
  * #define SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING   0
+ *
+ * // Also records a histogram of the section durations and the call sites of
+ * // the longest sections.
+ * #define SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM   0
  * @endcode
  *
  * @section sl_core_macro_api Macro API
@@ -150,6 +154,14 @@ extern "C" {
  * @ref CORE_get_max_time_atomic_section()
  * can be used to get the max timings since startup.
  *
+ * When SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM is also enabled, every
+ * section duration is counted in a log2 histogram and the
+ * @ref CORE_SECTION_LONGEST_COUNT longest sections are kept along with the
+ * return address of the call that entered them. Use
+ * @ref CORE_get_critical_section_statistics() and
+ * @ref CORE_get_atomic_section_statistics() to find out which code masks
+ * interrupts for too long, and how often.
+ *
  * @section sl_core_porting Porting from em_int
  *
  * Existing code using INT_Enable() and INT_Disable() must be ported to the
@@ -192,6 +204,14 @@ extern "C" {
  *  within ATOMIC regions. */
 #define CORE_ATOMIC_BASE_PRIORITY_LEVEL 3
 
+/** Number of duration buckets of the critical and atomic section histograms.
+ *  Bucket n counts the sections that lasted [2^(n-1), 2^n) cycles. */
+#define CORE_SECTION_HISTOGRAM_BUCKET_COUNT 32
+
+/** Number of longest critical and atomic sections recorded with their call
+ *  site. */
+#define CORE_SECTION_LONGEST_COUNT 8
+
 /*******************************************************************************
  ************************   MACRO API   ***************************************
  ******************************************************************************/
@@ -272,6 +292,18 @@ extern "C" {
 /// Storage for PRIMASK or BASEPRI value.
 typedef uint32_t CORE_irqState_t;
 
+/// A recorded critical or atomic section.
+typedef struct {
+  uint32_t cycles;       ///< Duration of the section in cycles.
+  uintptr_t call_site;   ///< Return address of the call that entered the section.
+} CORE_section_record_t;
+
+/// Critical or atomic section timing statistics.
+typedef struct {
+  uint32_t histogram[CORE_SECTION_HISTOGRAM_BUCKET_COUNT]; ///< Number of sections per duration bucket.
+  CORE_section_record_t longest[CORE_SECTION_LONGEST_COUNT]; ///< Longest sections, longest first.
+} CORE_section_statistics_t;
+
 /*******************************************************************************
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
@@ -450,6 +482,50 @@ void CORE_clear_max_time_critical_section(void);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_CORE, SL_CODE_CLASS_TIME_CRITICAL)
 void CORE_clear_max_time_atomic_section(void);
 
+/***************************************************************************//**
+ * @brief
+ *   Gets the duration histogram and the longest critical sections.
+ *
+ * @param[out] statistics
+ *   Pointer to the structure receiving the statistics. Unused entries of the
+ *   longest sections have a zero duration.
+ *
+ * @note SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING and
+ *       SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM must be enabled.
+ ******************************************************************************/
+void CORE_get_critical_section_statistics(CORE_section_statistics_t *statistics);
+
+/***************************************************************************//**
+ * @brief
+ *   Gets the duration histogram and the longest atomic sections.
+ *
+ * @param[out] statistics
+ *   Pointer to the structure receiving the statistics. Unused entries of the
+ *   longest sections have a zero duration.
+ *
+ * @note SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING and
+ *       SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM must be enabled.
+ ******************************************************************************/
+void CORE_get_atomic_section_statistics(CORE_section_statistics_t *statistics);
+
+/***************************************************************************//**
+ * @brief
+ *   Clears the duration histogram and the longest critical sections.
+ *
+ * @note SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING and
+ *       SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM must be enabled.
+ ******************************************************************************/
+void CORE_clear_critical_section_statistics(void);
+
+/***************************************************************************//**
+ * @brief
+ *   Clears the duration histogram and the longest atomic sections.
+ *
+ * @note SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING and
+ *       SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM must be enabled.
+ ******************************************************************************/
+void CORE_clear_atomic_section_statistics(void);
+
 /***************************************************************************//**
  * @brief
  *   Reset chip routine.
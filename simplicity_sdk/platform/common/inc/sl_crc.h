@@ -0,0 +1,213 @@
+/***************************************************************************//**
+ * @file
+ * @brief Streaming CRC computation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_CRC_H
+#define SL_CRC_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include "em_device.h"
+#include "sl_status.h"
+
+#if defined(GPCRC_PRESENT) && (GPCRC_COUNT > 0) && defined(LDMA_PRESENT)
+#define SL_CRC_GPCRC_SUPPORTED
+#include "sl_hal_gpcrc.h"
+#include "sl_hal_ldma.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*******************************************************************************
+ * @addtogroup crc CRC
+ * @brief CRC module computes 16-bit and 32-bit CRCs over streamed data.
+ * @details
+ *  Data is fed with sl_crc_update() in pieces of any length. The software
+ *  path processes eight bytes per step with slicing-by-8 lookup tables. On
+ *  devices with a GPCRC, updates longer than a threshold are moved to the
+ *  GPCRC, by LDMA when a channel is given. Both paths give identical results.
+ *
+ *  Only reflected algorithms (input and output reflected) are supported, as
+ *  the GPCRC shifts data least significant bit first.
+ * @{
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Defines
+
+/// CRC-32 (IEEE 802.3, zlib, PNG).
+#define SL_CRC_ALGORITHM_CRC32        { 32, 0x04C11DB7UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xCBF43926UL }
+
+/// CRC-16/ARC, also known as CRC-16/IBM.
+#define SL_CRC_ALGORITHM_CRC16_ARC    { 16, 0x8005UL, 0x0000UL, 0x0000UL, 0xBB3DUL }
+
+/// CRC-16/MODBUS.
+#define SL_CRC_ALGORITHM_CRC16_MODBUS { 16, 0x8005UL, 0xFFFFUL, 0x0000UL, 0x4B37UL }
+
+/// CRC-16/KERMIT, also known as CRC-16/CCITT (reflected).
+#define SL_CRC_ALGORITHM_CRC16_KERMIT { 16, 0x1021UL, 0x0000UL, 0x0000UL, 0x2189UL }
+
+// -----------------------------------------------------------------------------
+// Data Types
+
+/// CRC algorithm parameters.
+typedef struct {
+  uint8_t  width;   ///< Width in bits, 16 or 32.
+  uint32_t poly;    ///< Polynomial in normal bit order, without the highest order term.
+  uint32_t init;    ///< Initial register value.
+  uint32_t xor_out; ///< Value XORed with the final register value.
+  uint32_t check;   ///< CRC of the ASCII string "123456789".
+} sl_crc_algorithm_t;
+
+/// Slicing-by-8 lookup tables of an algorithm.
+typedef struct {
+  uint32_t entries[8][256]; ///< Entry [k][b] is the CRC of byte b followed by k zero bytes.
+} sl_crc_table_t;
+
+/// Streaming CRC state.
+typedef struct {
+  const sl_crc_algorithm_t *algorithm;        ///< Algorithm parameters.
+  const sl_crc_table_t     *table;            ///< Lookup tables built for the algorithm.
+  uint32_t                 value;             ///< Current register value, reflected.
+#if defined(SL_CRC_GPCRC_SUPPORTED)
+  GPCRC_TypeDef            *gpcrc;            ///< GPCRC instance, NULL for software only.
+  size_t                   gpcrc_threshold;   ///< Shortest update moved to the GPCRC.
+  LDMA_TypeDef             *ldma;             ///< LDMA instance feeding the GPCRC, NULL to feed it by CPU.
+  uint32_t                 ldma_channel;      ///< LDMA channel feeding the GPCRC.
+#endif
+} sl_crc_t;
+
+// -----------------------------------------------------------------------------
+// Prototypes
+
+/*******************************************************************************
+ * @brief
+ *  Build the slicing-by-8 lookup tables of an algorithm.
+ *
+ * @param[out] table      Tables to build. Can be shared by all streams using
+ *                        the same polynomial.
+ *
+ * @param[in]  algorithm  Algorithm parameters.
+ ******************************************************************************/
+void sl_crc_table_init(sl_crc_table_t *table,
+                       const sl_crc_algorithm_t *algorithm);
+
+/*******************************************************************************
+ * @brief
+ *  Start a CRC computation.
+ *
+ * @param[out] crc        CRC state.
+ *
+ * @param[in]  algorithm  Algorithm parameters, must stay valid while in use.
+ *
+ * @param[in]  table      Tables built by sl_crc_table_init() for the
+ *                        algorithm, must stay valid while in use.
+ ******************************************************************************/
+void sl_crc_init(sl_crc_t *crc,
+                 const sl_crc_algorithm_t *algorithm,
+                 const sl_crc_table_t *table);
+
+#if defined(SL_CRC_GPCRC_SUPPORTED)
+/*******************************************************************************
+ * @brief
+ *  Move long updates of a CRC computation to the GPCRC.
+ *
+ * @details
+ *  The GPCRC is reconfigured on each update that uses it, so it must not be
+ *  used by other code at the same time. The LDMA must be initialized with
+ *  sl_hal_ldma_init() and the GPCRC clock enabled.
+ *
+ * @param[in] crc           CRC state.
+ *
+ * @param[in] gpcrc         GPCRC instance, NULL to return to software only.
+ *
+ * @param[in] ldma          LDMA instance, NULL to write the GPCRC by CPU.
+ *
+ * @param[in] ldma_channel  LDMA channel, reserved for the CRC while in use.
+ *
+ * @param[in] threshold     Shortest update, in bytes, moved to the GPCRC.
+ ******************************************************************************/
+void sl_crc_use_gpcrc(sl_crc_t *crc,
+                      GPCRC_TypeDef *gpcrc,
+                      LDMA_TypeDef *ldma,
+                      uint32_t ldma_channel,
+                      size_t threshold);
+#endif
+
+/*******************************************************************************
+ * @brief
+ *  Add data to a CRC computation.
+ *
+ * @param[in] crc     CRC state.
+ *
+ * @param[in] data    Data, any alignment.
+ *
+ * @param[in] length  Length of the data in bytes.
+ ******************************************************************************/
+void sl_crc_update(sl_crc_t *crc,
+                   const void *data,
+                   size_t length);
+
+/*******************************************************************************
+ * @brief
+ *  Get the CRC of all data added so far.
+ *
+ * @details
+ *  The computation can be continued with sl_crc_update() afterwards.
+ *
+ * @param[in] crc  CRC state.
+ *
+ * @return    The CRC value.
+ ******************************************************************************/
+uint32_t sl_crc_final(const sl_crc_t *crc);
+
+/*******************************************************************************
+ * @brief
+ *  Check the configured paths of a CRC state against the algorithm check value.
+ *
+ * @details
+ *  Computes the CRC of "123456789" in software and, if configured, on the
+ *  GPCRC. The state itself is left unchanged.
+ *
+ * @param[in] crc  CRC state.
+ *
+ * @return    SL_STATUS_OK if all paths give the check value, SL_STATUS_FAIL
+ *            otherwise.
+ ******************************************************************************/
+sl_status_t sl_crc_check(const sl_crc_t *crc);
+
+/** @} (end addtogroup crc) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // SL_CRC_H
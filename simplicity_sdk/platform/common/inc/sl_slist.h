@@ -45,6 +45,11 @@ extern "C" {
  *        operations such as insert, push, pop, push back, sort and remove.
  *
  * @note The pop operation follows FIFO method.
+ *
+ * @note The sl_slist_list_* variant operates on a list descriptor that also
+ *       tracks the tail and the element count, so that push back, join and
+ *       count run in constant time. The descriptor head is a regular list
+ *       head and can be iterated with SL_SLIST_FOR_EACH.
  * @n @section slist_usage Singly-Linked List module Usage
  * @{
  ******************************************************************************/
@@ -57,6 +62,13 @@ struct sl_slist_node {
   sl_slist_node_t *node; ///< List node
 };
 
+/// List descriptor tracking the tail and element count
+typedef struct {
+  sl_slist_node_t *head; ///< First element of the list
+  sl_slist_node_t *tail; ///< Last element of the list
+  size_t count;          ///< Number of elements in the list
+} sl_slist_t;
+
 #ifndef DOXYGEN
 #define  container_of(ptr, type, member)  (type *)((uintptr_t)(ptr) - ((uintptr_t)(&((type *)0)->member)))
 
@@ -154,6 +166,23 @@ void sl_slist_sort(sl_slist_node_t **head,
                    bool (*cmp_fnct)(sl_slist_node_t *item_l,
                                     sl_slist_node_t *item_r));
 
+/*******************************************************************************
+ * Insert an item in a sorted list, after any items it is equally ordered with.
+ *
+ * @param    head      Pointer to the pointer of the head element of the list.
+ *
+ * @param    item      Pointer to the item to insert.
+ *
+ * @param    cmp_fnct  Pointer to function used to sort the list.
+ *                     item_l    Pointer to left  item.
+ *                     item_r    Pointer to right item.
+ *                     Returns whether the two items are ordered (true) or not (false).
+ ******************************************************************************/
+void sl_slist_insert_sorted(sl_slist_node_t **head,
+                            sl_slist_node_t *item,
+                            bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                             sl_slist_node_t *item_r));
+
 /*******************************************************************************
  * Checks if the list is empty.
  *
@@ -164,6 +193,129 @@ static inline bool sl_slist_is_empty(sl_slist_node_t *head)
   return head == NULL;
 }
 
+/*******************************************************************************
+ * Initialize a list descriptor.
+ *
+ * @param    list  Pointer to the list descriptor.
+ ******************************************************************************/
+void sl_slist_list_init(sl_slist_t *list);
+
+/*******************************************************************************
+ * Add given item at beginning of the list.
+ *
+ * @param    list  Pointer to the list descriptor.
+ *
+ * @param    item  Pointer to an item to add.
+ ******************************************************************************/
+void sl_slist_list_push(sl_slist_t *list,
+                        sl_slist_node_t *item);
+
+/*******************************************************************************
+ * Add item at the end of the list in constant time.
+ *
+ * @param    list  Pointer to the list descriptor.
+ *
+ * @param    item  Pointer to the item to add.
+ ******************************************************************************/
+void sl_slist_list_push_back(sl_slist_t *list,
+                             sl_slist_node_t *item);
+
+/*******************************************************************************
+ * Remove and return the first element of the list.
+ *
+ * @param    list  Pointer to the list descriptor.
+ *
+ * @return   Pointer to item that was at top of the list.
+ ******************************************************************************/
+sl_slist_node_t *sl_slist_list_pop(sl_slist_t *list);
+
+/*******************************************************************************
+ * Insert an item after the given item.
+ *
+ * @param    list  Pointer to the list descriptor.
+ *
+ * @param    item  Pointer to an item to add.
+ *
+ * @param    pos   Pointer to an item after which the item to add will be inserted.
+ ******************************************************************************/
+void sl_slist_list_insert(sl_slist_t *list,
+                          sl_slist_node_t *item,
+                          sl_slist_node_t *pos);
+
+/*******************************************************************************
+ * Join two lists together in constant time.
+ *
+ * @param    list_1  Pointer to the list descriptor to append to.
+ *
+ * @param    list_2  Pointer to the list descriptor to be appended. After the
+ *                   call, this list is empty.
+ ******************************************************************************/
+void sl_slist_list_join(sl_slist_t *list_1,
+                        sl_slist_t *list_2);
+
+/*******************************************************************************
+ * Remove an item from the list.
+ *
+ * @param    list  Pointer to the list descriptor.
+ *
+ * @param    item  Pointer to the item to remove.
+ ******************************************************************************/
+void sl_slist_list_remove(sl_slist_t *list,
+                          sl_slist_node_t *item);
+
+/*******************************************************************************
+ * Sort list items.
+ *
+ * @param    list      Pointer to the list descriptor.
+ *
+ * @param    cmp_fnct  Pointer to function to use for sorting the list.
+ *                     item_l    Pointer to left  item.
+ *                     item_r    Pointer to right item.
+ *                     Returns whether the two items are ordered (true) or not (false).
+ ******************************************************************************/
+void sl_slist_list_sort(sl_slist_t *list,
+                        bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                         sl_slist_node_t *item_r));
+
+/*******************************************************************************
+ * Insert an item in a sorted list, after any items it is equally ordered with.
+ *
+ * @param    list      Pointer to the list descriptor.
+ *
+ * @param    item      Pointer to the item to insert.
+ *
+ * @param    cmp_fnct  Pointer to function used to sort the list.
+ *                     item_l    Pointer to left  item.
+ *                     item_r    Pointer to right item.
+ *                     Returns whether the two items are ordered (true) or not (false).
+ ******************************************************************************/
+void sl_slist_list_insert_sorted(sl_slist_t *list,
+                                 sl_slist_node_t *item,
+                                 bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                                  sl_slist_node_t *item_r));
+
+/*******************************************************************************
+ * Get the number of elements in the list.
+ *
+ * @param    list  Pointer to the list descriptor.
+ *
+ * @return   Number of elements in the list.
+ ******************************************************************************/
+static inline size_t sl_slist_list_count(const sl_slist_t *list)
+{
+  return list->count;
+}
+
+/*******************************************************************************
+ * Checks if the list is empty.
+ *
+ * @param    list  Pointer to the list descriptor.
+ ******************************************************************************/
+static inline bool sl_slist_list_is_empty(const sl_slist_t *list)
+{
+  return list->head == NULL;
+}
+
 /** @} (end addtogroup slist) */
 
 #ifdef __cplusplus
@@ -32,6 +32,21 @@
 #include "sl_core_config.h"
 #include "sl_common.h"
 #include "em_device.h"
+#include <string.h>
+
+#if (SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1) && defined(SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM) \
+  && (SL_CORE_DEBUG_INTERRUPTS_MASKED_HISTOGRAM == 1)
+#define CORE_SECTION_HISTOGRAM_PRESENT
+#endif
+
+#if (SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
+// Return address of the call entering a section, when the compiler can provide it.
+#if defined(__GNUC__)
+#define CORE_CALL_SITE()  ((uintptr_t)__builtin_return_address(0))
+#else
+#define CORE_CALL_SITE()  ((uintptr_t)0)
+#endif
+#endif
 
 /**************************************************************************//**
  * @addtogroup sl_core
@@ -46,6 +61,11 @@ typedef struct {
   uint32_t start;    /*!< Cycle counter at start of recording. */
   uint32_t cycles;   /*!< Cycles elapsed in last recording. */
   uint32_t max;      /*!< Max recorded cycles since last reset or init. */
+#if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+  uintptr_t call_site;                    /*!< Call site of the current recording. */
+  uint32_t shortest_longest;              /*!< Index of the shortest entry of the longest recordings. */
+  CORE_section_statistics_t statistics;   /*!< Histogram and longest recordings. */
+#endif
 } dwt_cycle_counter_handle_t;
 
 /*******************************************************************************
@@ -69,11 +89,18 @@ dwt_cycle_counter_handle_t critical_cycle_counter = { 0 };
 
 #if (SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_CORE, SL_CODE_CLASS_TIME_CRITICAL)
-static void cycle_counter_start(dwt_cycle_counter_handle_t *handle);
+static void cycle_counter_start(dwt_cycle_counter_handle_t *handle,
+                                uintptr_t call_site);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_CORE, SL_CODE_CLASS_TIME_CRITICAL)
 static void cycle_counter_stop(dwt_cycle_counter_handle_t *handle);
 #endif
 
+#if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+static void cycle_counter_get_statistics(dwt_cycle_counter_handle_t *handle,
+                                         CORE_section_statistics_t *statistics);
+static void cycle_counter_clear_statistics(dwt_cycle_counter_handle_t *handle);
+#endif
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -111,7 +138,7 @@ SL_WEAK CORE_irqState_t CORE_EnterCritical(void)
   __disable_irq();
 #if (SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
   if (irqState == 0U) {
-    cycle_counter_start(&critical_cycle_counter);
+    cycle_counter_start(&critical_cycle_counter, CORE_CALL_SITE());
   }
 #endif
   return irqState;
@@ -193,7 +220,7 @@ SL_WEAK CORE_irqState_t CORE_EnterAtomic(void)
 #if (SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
   if ((irqState & (CORE_ATOMIC_BASE_PRIORITY_LEVEL << (8U - __NVIC_PRIO_BITS)))
       != (CORE_ATOMIC_BASE_PRIORITY_LEVEL << (8U - __NVIC_PRIO_BITS))) {
-    cycle_counter_start(&atomic_cycle_counter);
+    cycle_counter_start(&atomic_cycle_counter, CORE_CALL_SITE());
   }
 #endif
   return irqState;
@@ -202,7 +229,7 @@ SL_WEAK CORE_irqState_t CORE_EnterAtomic(void)
   __disable_irq();
 #if (SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
   if (irqState == 0U) {
-    cycle_counter_start(&critical_cycle_counter);
+    cycle_counter_start(&critical_cycle_counter, CORE_CALL_SITE());
   }
 #endif
   return irqState;
@@ -294,10 +321,19 @@ SL_WEAK bool CORE_IrqIsDisabled(void)
  * @param[in] handle
  *   Pointer to initialized counter handle.
  *
+ * @param[in] call_site
+ *   Return address of the call entering the section.
+ *
  * @note SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING must be enabled.
  ******************************************************************************/
-static void cycle_counter_start(dwt_cycle_counter_handle_t *handle)
+static void cycle_counter_start(dwt_cycle_counter_handle_t *handle,
+                                uintptr_t call_site)
 {
+#if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+  handle->call_site = call_site;
+#else
+  (void)call_site;
+#endif
   handle->start = DWT->CYCCNT;
 }
 #endif //(SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
@@ -319,9 +355,90 @@ static void cycle_counter_stop(dwt_cycle_counter_handle_t *handle)
   if (handle->cycles > handle->max) {
     handle->max = handle->cycles;
   }
+
+#if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+  uint32_t bucket = (handle->cycles == 0U) ? 0U : (32U - __CLZ(handle->cycles));
+  CORE_section_record_t *shortest;
+
+  if (bucket >= CORE_SECTION_HISTOGRAM_BUCKET_COUNT) {
+    bucket = CORE_SECTION_HISTOGRAM_BUCKET_COUNT - 1U;
+  }
+  handle->statistics.histogram[bucket]++;
+
+  // Replace the shortest of the longest recordings, then find the new shortest.
+  shortest = &handle->statistics.longest[handle->shortest_longest];
+  if (handle->cycles > shortest->cycles) {
+    shortest->cycles = handle->cycles;
+    shortest->call_site = handle->call_site;
+    for (uint32_t i = 0; i < CORE_SECTION_LONGEST_COUNT; i++) {
+      if (handle->statistics.longest[i].cycles
+          < handle->statistics.longest[handle->shortest_longest].cycles) {
+        handle->shortest_longest = i;
+      }
+    }
+  }
+#endif
 }
 #endif //(SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
 
+#if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+/***************************************************************************//**
+ * @brief
+ *   Copy the statistics of a counter, longest recordings first.
+ *
+ * @param[in] handle
+ *   Pointer to initialized counter handle.
+ *
+ * @param[out] statistics
+ *   Pointer to the structure receiving the statistics.
+ ******************************************************************************/
+static void cycle_counter_get_statistics(dwt_cycle_counter_handle_t *handle,
+                                         CORE_section_statistics_t *statistics)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  // Copy with interrupts masked, the section itself is not recorded.
+  irqState = __get_PRIMASK();
+  __disable_irq();
+  *statistics = handle->statistics;
+  if (irqState == 0U) {
+    __enable_irq();
+  }
+
+  // Insertion sort of the few longest recordings.
+  for (uint32_t i = 1; i < CORE_SECTION_LONGEST_COUNT; i++) {
+    CORE_section_record_t record = statistics->longest[i];
+    uint32_t j = i;
+
+    while ((j > 0U) && (statistics->longest[j - 1U].cycles < record.cycles)) {
+      statistics->longest[j] = statistics->longest[j - 1U];
+      j--;
+    }
+    statistics->longest[j] = record;
+  }
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Clear the statistics of a counter.
+ *
+ * @param[in] handle
+ *   Pointer to initialized counter handle.
+ ******************************************************************************/
+static void cycle_counter_clear_statistics(dwt_cycle_counter_handle_t *handle)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  irqState = __get_PRIMASK();
+  __disable_irq();
+  memset(&handle->statistics, 0, sizeof(handle->statistics));
+  handle->shortest_longest = 0;
+  if (irqState == 0U) {
+    __enable_irq();
+  }
+}
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Returns the max time spent in critical section.
@@ -370,6 +487,54 @@ void CORE_clear_max_time_atomic_section(void)
   #endif //(SL_CORE_DEBUG_INTERRUPTS_MASKED_TIMING == 1)
 }
 
+/***************************************************************************//**
+ * @brief
+ *   Gets the duration histogram and the longest critical sections.
+ ******************************************************************************/
+void CORE_get_critical_section_statistics(CORE_section_statistics_t *statistics)
+{
+  #if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+  cycle_counter_get_statistics(&critical_cycle_counter, statistics);
+  #else
+  memset(statistics, 0, sizeof(*statistics));
+  #endif
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Gets the duration histogram and the longest atomic sections.
+ ******************************************************************************/
+void CORE_get_atomic_section_statistics(CORE_section_statistics_t *statistics)
+{
+  #if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+  cycle_counter_get_statistics(&atomic_cycle_counter, statistics);
+  #else
+  memset(statistics, 0, sizeof(*statistics));
+  #endif
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Clears the duration histogram and the longest critical sections.
+ ******************************************************************************/
+void CORE_clear_critical_section_statistics(void)
+{
+  #if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+  cycle_counter_clear_statistics(&critical_cycle_counter);
+  #endif
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Clears the duration histogram and the longest atomic sections.
+ ******************************************************************************/
+void CORE_clear_atomic_section_statistics(void)
+{
+  #if defined(CORE_SECTION_HISTOGRAM_PRESENT)
+  cycle_counter_clear_statistics(&atomic_cycle_counter);
+  #endif
+}
+
 /***************************************************************************//**
  * @brief
  *   Reset chip routine.
@@ -0,0 +1,318 @@
+/***************************************************************************//**
+ * @file
+ * @brief Streaming CRC computation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_assert.h"
+#include "sl_crc.h"
+#include <stdbool.h>
+#include <stdint.h>
+
+/*******************************************************************************
+ ***************************  LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Mask of the bits used by a CRC of the given width.
+ ******************************************************************************/
+static uint32_t crc_mask(uint8_t width)
+{
+  return (width == 32U) ? 0xFFFFFFFFUL : ((1UL << width) - 1UL);
+}
+
+/***************************************************************************//**
+ * Reverse the order of the lowest width bits of a value.
+ ******************************************************************************/
+static uint32_t crc_reflect(uint32_t value, uint8_t width)
+{
+  uint32_t reflected = 0;
+  uint8_t i;
+
+  for (i = 0; i < width; i++) {
+    reflected = (reflected << 1) | (value & 1UL);
+    value >>= 1;
+  }
+  return reflected;
+}
+
+/***************************************************************************//**
+ * Add data to a reflected CRC register, eight bytes per table step.
+ *
+ * Each step XORs the register into the next four bytes and looks up all
+ * eight bytes at once, entry [k] accounting for the k bytes that follow.
+ ******************************************************************************/
+static uint32_t crc_update_software(const sl_crc_table_t *table,
+                                    uint32_t value,
+                                    const uint8_t *data,
+                                    size_t length)
+{
+  uint32_t low;
+  uint32_t high;
+
+  while (length >= 8U) {
+    low = ((uint32_t)data[0] | ((uint32_t)data[1] << 8)
+           | ((uint32_t)data[2] << 16) | ((uint32_t)data[3] << 24)) ^ value;
+    high = (uint32_t)data[4] | ((uint32_t)data[5] << 8)
+           | ((uint32_t)data[6] << 16) | ((uint32_t)data[7] << 24);
+
+    value = table->entries[7][low & 0xFFU]
+            ^ table->entries[6][(low >> 8) & 0xFFU]
+            ^ table->entries[5][(low >> 16) & 0xFFU]
+            ^ table->entries[4][low >> 24]
+            ^ table->entries[3][high & 0xFFU]
+            ^ table->entries[2][(high >> 8) & 0xFFU]
+            ^ table->entries[1][(high >> 16) & 0xFFU]
+            ^ table->entries[0][high >> 24];
+
+    data   += 8;
+    length -= 8U;
+  }
+
+  while (length > 0U) {
+    value = (value >> 8) ^ table->entries[0][(value ^ *data) & 0xFFU];
+    data++;
+    length--;
+  }
+
+  return value;
+}
+
+#if defined(SL_CRC_GPCRC_SUPPORTED)
+/***************************************************************************//**
+ * Add data to a reflected CRC register on the GPCRC.
+ *
+ * The GPCRC is seeded with the register, fed unaligned head and tail bytes by
+ * CPU and the aligned words by LDMA, or by CPU when no LDMA is given.
+ ******************************************************************************/
+static uint32_t crc_update_gpcrc(const sl_crc_t *crc,
+                                 uint32_t value,
+                                 const uint8_t *data,
+                                 size_t length)
+{
+  sl_hal_gpcrc_init_t init = SL_HAL_GPCRC_INIT_DEFAULT;
+  GPCRC_TypeDef *gpcrc = crc->gpcrc;
+  size_t words;
+  size_t count;
+
+  init.crc_poly   = (crc->algorithm->width == 32U) ? SL_HAL_GPCRC_COMMON_32_BIT_POLY : crc->algorithm->poly;
+  init.init_value = value;
+
+  sl_hal_gpcrc_disable(gpcrc);
+  sl_hal_gpcrc_init(gpcrc, &init);
+  sl_hal_gpcrc_enable(gpcrc);
+  sl_hal_gpcrc_start(gpcrc);
+
+  while ((length > 0U) && (((uintptr_t)data & 3U) != 0U)) {
+    sl_hal_gpcrc_write_input_8bit(gpcrc, *data);
+    data++;
+    length--;
+  }
+
+  words   = length / 4U;
+  length &= 3U;
+
+  if (crc->ldma != NULL) {
+    sl_hal_ldma_transfer_config_t transfer_config = SL_HAL_LDMA_TRANSFER_CFG_MEMORY();
+    sl_hal_ldma_descriptor_t descriptor;
+
+    while (words > 0U) {
+      count = (words < SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE) ? words : SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE;
+
+      descriptor = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2M(SL_HAL_LDMA_CTRL_SIZE_WORD,
+                                                                               data,
+                                                                               &gpcrc->INPUTDATA,
+                                                                               count);
+      descriptor.xfer.dst_inc  = SL_HAL_LDMA_CTRL_DST_INC_NONE;
+      descriptor.xfer.done_ifs = 0;
+
+      sl_hal_ldma_init_transfer(crc->ldma, crc->ldma_channel, &transfer_config, &descriptor);
+      sl_hal_ldma_start_transfer(crc->ldma, crc->ldma_channel);
+      while (!sl_hal_ldma_transfer_is_done(crc->ldma, crc->ldma_channel)) {
+      }
+
+      data  += count * 4U;
+      words -= count;
+    }
+  } else {
+    while (words > 0U) {
+      sl_hal_gpcrc_write_input_32bit(gpcrc, *(const uint32_t *)(const void *)data);
+      data += 4;
+      words--;
+    }
+  }
+
+  while (length > 0U) {
+    sl_hal_gpcrc_write_input_8bit(gpcrc, *data);
+    data++;
+    length--;
+  }
+
+  return sl_hal_gpcrc_read_data(gpcrc) & crc_mask(crc->algorithm->width);
+}
+#endif
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Build the slicing-by-8 lookup tables of an algorithm.
+ ******************************************************************************/
+void sl_crc_table_init(sl_crc_table_t *table,
+                       const sl_crc_algorithm_t *algorithm)
+{
+  EFM_ASSERT(table != NULL);
+  EFM_ASSERT(algorithm != NULL);
+  EFM_ASSERT((algorithm->width == 16U) || (algorithm->width == 32U));
+
+  uint32_t poly = crc_reflect(algorithm->poly, algorithm->width);
+  uint32_t value;
+  uint32_t byte;
+  uint32_t slice;
+  uint8_t bit;
+
+  for (byte = 0; byte < 256U; byte++) {
+    value = byte;
+    for (bit = 0; bit < 8U; bit++) {
+      value = ((value & 1UL) != 0UL) ? ((value >> 1) ^ poly) : (value >> 1);
+    }
+    table->entries[0][byte] = value;
+  }
+
+  for (byte = 0; byte < 256U; byte++) {
+    value = table->entries[0][byte];
+    for (slice = 1; slice < 8U; slice++) {
+      value = (value >> 8) ^ table->entries[0][value & 0xFFU];
+      table->entries[slice][byte] = value;
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Start a CRC computation.
+ ******************************************************************************/
+void sl_crc_init(sl_crc_t *crc,
+                 const sl_crc_algorithm_t *algorithm,
+                 const sl_crc_table_t *table)
+{
+  EFM_ASSERT(crc != NULL);
+  EFM_ASSERT(algorithm != NULL);
+  EFM_ASSERT(table != NULL);
+  EFM_ASSERT((algorithm->width == 16U) || (algorithm->width == 32U));
+
+  crc->algorithm = algorithm;
+  crc->table     = table;
+  crc->value     = crc_reflect(algorithm->init, algorithm->width);
+#if defined(SL_CRC_GPCRC_SUPPORTED)
+  crc->gpcrc           = NULL;
+  crc->gpcrc_threshold = 0;
+  crc->ldma            = NULL;
+  crc->ldma_channel    = 0;
+#endif
+}
+
+#if defined(SL_CRC_GPCRC_SUPPORTED)
+/***************************************************************************//**
+ * Move long updates of a CRC computation to the GPCRC.
+ ******************************************************************************/
+void sl_crc_use_gpcrc(sl_crc_t *crc,
+                      GPCRC_TypeDef *gpcrc,
+                      LDMA_TypeDef *ldma,
+                      uint32_t ldma_channel,
+                      size_t threshold)
+{
+  EFM_ASSERT(crc != NULL);
+  EFM_ASSERT((gpcrc == NULL) || SL_HAL_GPCRC_REF_VALID(gpcrc));
+  EFM_ASSERT((ldma == NULL) || (ldma_channel < DMA_CHAN_COUNT));
+
+  crc->gpcrc           = gpcrc;
+  crc->gpcrc_threshold = threshold;
+  crc->ldma            = ldma;
+  crc->ldma_channel    = ldma_channel;
+}
+#endif
+
+/***************************************************************************//**
+ * Add data to a CRC computation.
+ ******************************************************************************/
+void sl_crc_update(sl_crc_t *crc,
+                   const void *data,
+                   size_t length)
+{
+  EFM_ASSERT(crc != NULL);
+  EFM_ASSERT((data != NULL) || (length == 0U));
+
+#if defined(SL_CRC_GPCRC_SUPPORTED)
+  if ((crc->gpcrc != NULL) && (length >= crc->gpcrc_threshold)) {
+    crc->value = crc_update_gpcrc(crc, crc->value, (const uint8_t *)data, length);
+    return;
+  }
+#endif
+
+  crc->value = crc_update_software(crc->table, crc->value, (const uint8_t *)data, length);
+}
+
+/***************************************************************************//**
+ * Get the CRC of all data added so far.
+ ******************************************************************************/
+uint32_t sl_crc_final(const sl_crc_t *crc)
+{
+  EFM_ASSERT(crc != NULL);
+
+  return (crc->value ^ crc->algorithm->xor_out) & crc_mask(crc->algorithm->width);
+}
+
+/***************************************************************************//**
+ * Check the configured paths of a CRC state against the algorithm check value.
+ ******************************************************************************/
+sl_status_t sl_crc_check(const sl_crc_t *crc)
+{
+  EFM_ASSERT(crc != NULL);
+
+  static const uint8_t check_data[] = { '1', '2', '3', '4', '5', '6', '7', '8', '9' };
+  const sl_crc_algorithm_t *algorithm = crc->algorithm;
+  uint32_t init = crc_reflect(algorithm->init, algorithm->width);
+  uint32_t mask = crc_mask(algorithm->width);
+  uint32_t value;
+
+  value = crc_update_software(crc->table, init, check_data, sizeof(check_data));
+  if (((value ^ algorithm->xor_out) & mask) != algorithm->check) {
+    return SL_STATUS_FAIL;
+  }
+
+#if defined(SL_CRC_GPCRC_SUPPORTED)
+  if (crc->gpcrc != NULL) {
+    value = crc_update_gpcrc(crc, init, check_data, sizeof(check_data));
+    if (((value ^ algorithm->xor_out) & mask) != algorithm->check) {
+      return SL_STATUS_FAIL;
+    }
+  }
+#endif
+
+  return SL_STATUS_OK;
+}
@@ -34,6 +34,84 @@
 #include <stdlib.h>
 #include <stdint.h>
 
+/*******************************************************************************
+ ***************************  LOCAL FUNCTIONS   ********************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Sorts list items with a bottom-up merge sort and returns the last item.
+ *
+ * Runs of doubling length are merged in place, so the sort takes
+ * O(n log n) comparisons, no extra memory and keeps the order of items the
+ * compare function reports as ordered both ways.
+ ******************************************************************************/
+static sl_slist_node_t *merge_sort(sl_slist_node_t **head,
+                                   bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                                    sl_slist_node_t *item_r))
+{
+  sl_slist_node_t *list = *head;
+  sl_slist_node_t *tail = NULL;
+  size_t run_length = 1;
+  size_t merge_count;
+
+  if (list == NULL) {
+    return NULL;
+  }
+
+  do {
+    sl_slist_node_t *p_item_l = list;
+
+    list = NULL;
+    tail = NULL;
+    merge_count = 0;
+
+    while (p_item_l != NULL) {
+      sl_slist_node_t *p_item_r = p_item_l;
+      size_t size_l = 0;
+      size_t size_r = run_length;
+
+      merge_count++;
+      // Right run starts run_length items after the left one.
+      while ((size_l < run_length) && (p_item_r != NULL)) {
+        size_l++;
+        p_item_r = p_item_r->node;
+      }
+
+      // Merge both runs, taking from the left run while items are ordered.
+      while ((size_l > 0) || ((size_r > 0) && (p_item_r != NULL))) {
+        sl_slist_node_t *p_item;
+
+        if ((size_l != 0)
+            && ((size_r == 0) || (p_item_r == NULL) || cmp_fnct(p_item_l, p_item_r))) {
+          p_item = p_item_l;
+          p_item_l = p_item_l->node;
+          size_l--;
+        } else {
+          p_item = p_item_r;
+          p_item_r = p_item_r->node;
+          size_r--;
+        }
+
+        if (tail != NULL) {
+          tail->node = p_item;
+        } else {
+          list = p_item;
+        }
+        tail = p_item;
+      }
+
+      p_item_l = p_item_r;
+    }
+
+    tail->node = NULL;
+    run_length *= 2;
+  } while (merge_count > 1);
+
+  *head = list;
+
+  return tail;
+}
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -154,37 +232,195 @@ void sl_slist_sort(sl_slist_node_t **head,
                    bool (*cmp_fnct)(sl_slist_node_t *item_l,
                                     sl_slist_node_t *item_r))
 {
-  bool  swapped;
-  sl_slist_node_t **pp_item_l;
-
   EFM_ASSERT((head != NULL) && (cmp_fnct != NULL));
 
-  do {
-    swapped = false;
-
-    pp_item_l = head;
-    // Loop until end of list is found.
-    while ((*pp_item_l != NULL) && ((*pp_item_l)->node != NULL)) {
-      sl_slist_node_t *p_item_r = (*pp_item_l)->node;
-      bool  ordered;
-
-      // Call provided compare fnct.
-      ordered = cmp_fnct(*pp_item_l, p_item_r);
-      if (ordered == false) {
-        // If order is not correct, swap items.
-        sl_slist_node_t *p_tmp = p_item_r->node;
-
-        // Swap the two items.
-        p_item_r->node = *pp_item_l;
-        (*pp_item_l)->node = p_tmp;
-        *pp_item_l = p_item_r;
-        pp_item_l = &(p_item_r->node);
-        // Indicate a swap has been done.
-        swapped = true;
-      } else {
-        pp_item_l = &((*pp_item_l)->node);
+  (void)merge_sort(head, cmp_fnct);
+}
+
+/***************************************************************************//**
+ * Insert item in sorted list.
+ ******************************************************************************/
+void sl_slist_insert_sorted(sl_slist_node_t **head,
+                            sl_slist_node_t *item,
+                            bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                             sl_slist_node_t *item_r))
+{
+  sl_slist_node_t **node_ptr = head;
+
+  EFM_ASSERT((item != NULL) && (head != NULL) && (cmp_fnct != NULL));
+
+  // Skip all items ordered before or equally with the new item.
+  while ((*node_ptr != NULL) && cmp_fnct(*node_ptr, item)) {
+    node_ptr = &((*node_ptr)->node);
+  }
+
+  item->node = *node_ptr;
+  *node_ptr = item;
+}
+
+/***************************************************************************//**
+ * Initializes a list descriptor.
+ ******************************************************************************/
+void sl_slist_list_init(sl_slist_t *list)
+{
+  EFM_ASSERT(list != NULL);
+
+  list->head = NULL;
+  list->tail = NULL;
+  list->count = 0;
+}
+
+/***************************************************************************//**
+ * Add given item at beginning of list.
+ ******************************************************************************/
+void sl_slist_list_push(sl_slist_t *list,
+                        sl_slist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  item->node = list->head;
+  list->head = item;
+  if (list->tail == NULL) {
+    list->tail = item;
+  }
+  list->count++;
+}
+
+/***************************************************************************//**
+ * Add item at end of list.
+ ******************************************************************************/
+void sl_slist_list_push_back(sl_slist_t *list,
+                             sl_slist_node_t *item)
+{
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  item->node = NULL;
+  if (list->tail != NULL) {
+    list->tail->node = item;
+  } else {
+    list->head = item;
+  }
+  list->tail = item;
+  list->count++;
+}
+
+/***************************************************************************//**
+ * Removes and returns first element of list.
+ ******************************************************************************/
+sl_slist_node_t *sl_slist_list_pop(sl_slist_t *list)
+{
+  sl_slist_node_t *item;
+
+  EFM_ASSERT(list != NULL);
+
+  item = sl_slist_pop(&list->head);
+  if (item == NULL) {
+    return (NULL);
+  }
+
+  if (list->head == NULL) {
+    list->tail = NULL;
+  }
+  list->count--;
+
+  return (item);
+}
+
+/***************************************************************************//**
+ * Insert item after given item.
+ ******************************************************************************/
+void sl_slist_list_insert(sl_slist_t *list,
+                          sl_slist_node_t *item,
+                          sl_slist_node_t *pos)
+{
+  EFM_ASSERT(list != NULL);
+
+  sl_slist_insert(item, pos);
+  if (list->tail == pos) {
+    list->tail = item;
+  }
+  list->count++;
+}
+
+/***************************************************************************//**
+ * Append second list at end of first list.
+ ******************************************************************************/
+void sl_slist_list_join(sl_slist_t *list_1,
+                        sl_slist_t *list_2)
+{
+  EFM_ASSERT((list_1 != NULL) && (list_2 != NULL));
+
+  if (list_2->head == NULL) {
+    return;
+  }
+
+  if (list_1->tail != NULL) {
+    list_1->tail->node = list_2->head;
+  } else {
+    list_1->head = list_2->head;
+  }
+  list_1->tail = list_2->tail;
+  list_1->count += list_2->count;
+
+  sl_slist_list_init(list_2);
+}
+
+/***************************************************************************//**
+ * Remove item from list.
+ ******************************************************************************/
+void sl_slist_list_remove(sl_slist_t *list,
+                          sl_slist_node_t *item)
+{
+  sl_slist_node_t **node_ptr;
+  sl_slist_node_t *prev = NULL;
+
+  EFM_ASSERT((item != NULL) && (list != NULL));
+
+  for (node_ptr = &list->head; *node_ptr != NULL; node_ptr = &((*node_ptr)->node)) {
+    if (*node_ptr == item) {
+      *node_ptr = item->node;
+      item->node = NULL;
+      if (list->tail == item) {
+        list->tail = prev;
       }
+      list->count--;
+      return;
     }
-    // Re-loop until no items have been swapped.
-  } while (swapped == true);
+    prev = *node_ptr;
+  }
+}
+
+/***************************************************************************//**
+ * Sorts list items.
+ ******************************************************************************/
+void sl_slist_list_sort(sl_slist_t *list,
+                        bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                         sl_slist_node_t *item_r))
+{
+  EFM_ASSERT((list != NULL) && (cmp_fnct != NULL));
+
+  list->tail = merge_sort(&list->head, cmp_fnct);
+}
+
+/***************************************************************************//**
+ * Insert item in sorted list.
+ ******************************************************************************/
+void sl_slist_list_insert_sorted(sl_slist_t *list,
+                                 sl_slist_node_t *item,
+                                 bool (*cmp_fnct)(sl_slist_node_t *item_l,
+                                                  sl_slist_node_t *item_r))
+{
+  EFM_ASSERT((item != NULL) && (list != NULL) && (cmp_fnct != NULL));
+
+  // Items ordered after the current tail are appended without walking the list.
+  if ((list->tail != NULL) && cmp_fnct(list->tail, item)) {
+    sl_slist_list_push_back(list, item);
+    return;
+  }
+
+  sl_slist_insert_sorted(&list->head, item, cmp_fnct);
+  if (item->node == NULL) {
+    list->tail = item;
+  }
+  list->count++;
 }
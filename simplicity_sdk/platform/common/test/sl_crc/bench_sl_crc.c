@@ -0,0 +1,138 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host benchmark of the sl_crc software path.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// Compares sl_crc_update() (slicing-by-8) with a byte-at-a-time loop over the
+// first slice of the same tables. One stream is fed in updates from a short
+// packet to a flash page long, so only the update cost is measured.
+
+#define _POSIX_C_SOURCE 199309L
+
+#include "sl_crc.h"
+#include <stdio.h>
+#include <time.h>
+
+// -----------------------------------------------------------------------------
+// Defines
+
+#define BENCH_BYTES  (64UL * 1024UL * 1024UL)
+
+// -----------------------------------------------------------------------------
+// Static Variables
+
+static const sl_crc_algorithm_t crc32 = SL_CRC_ALGORITHM_CRC32;
+static const sl_crc_algorithm_t crc16_kermit = SL_CRC_ALGORITHM_CRC16_KERMIT;
+
+static sl_crc_table_t table;
+static uint8_t buffer[4096];
+
+// Keeps the compiler from dropping the loops.
+static volatile uint32_t sink;
+
+// -----------------------------------------------------------------------------
+// Static Function Definitions
+
+static double now(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + ((double)ts.tv_nsec * 1e-9);
+}
+
+static uint32_t crc_bytewise(const sl_crc_table_t *tables, uint32_t value, const uint8_t *data, size_t length)
+{
+  while (length > 0U) {
+    value = (value >> 8) ^ tables->entries[0][(value ^ *data) & 0xFFU];
+    data++;
+    length--;
+  }
+  return value;
+}
+
+static double bench_slicing(const sl_crc_algorithm_t *algorithm, size_t length)
+{
+  sl_crc_t crc;
+  double start;
+
+  sl_crc_init(&crc, algorithm, &table);
+  start = now();
+  for (size_t done = 0; done < BENCH_BYTES; done += length) {
+    sl_crc_update(&crc, buffer, length);
+  }
+  sink = sl_crc_final(&crc);
+  return (double)BENCH_BYTES / (now() - start);
+}
+
+static double bench_bytewise(size_t length)
+{
+  uint32_t value = 0xFFFFFFFFUL;
+  double start;
+
+  start = now();
+  for (size_t done = 0; done < BENCH_BYTES; done += length) {
+    value = crc_bytewise(&table, value, buffer, length);
+  }
+  sink = value;
+  return (double)BENCH_BYTES / (now() - start);
+}
+
+static void bench_algorithm(const char *name, const sl_crc_algorithm_t *algorithm)
+{
+  static const size_t lengths[] = { 16, 64, 256, 4096 };
+  double slicing;
+  double bytewise;
+
+  sl_crc_table_init(&table, algorithm);
+  for (size_t i = 0; i < sizeof(lengths) / sizeof(lengths[0]); i++) {
+    slicing = bench_slicing(algorithm, lengths[i]);
+    bytewise = bench_bytewise(lengths[i]);
+    printf("%-14s %5u B  slicing-by-8 %8.1f MB/s  bytewise %8.1f MB/s  x%.2f\n",
+           name,
+           (unsigned int)lengths[i],
+           slicing / 1e6,
+           bytewise / 1e6,
+           slicing / bytewise);
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Global Function Definitions
+
+int main(void)
+{
+  for (size_t i = 0; i < sizeof(buffer); i++) {
+    buffer[i] = (uint8_t)((i * 131U) + 7U);
+  }
+
+  bench_algorithm("CRC-32", &crc32);
+  bench_algorithm("CRC-16/KERMIT", &crc16_kermit);
+
+  return 0;
+}
@@ -0,0 +1,262 @@
+/***************************************************************************//**
+ * @file
+ * @brief Host test of the sl_crc software path.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_crc.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Defines
+
+#define RANDOM_STREAMS     500
+#define RANDOM_MAX_LENGTH  2048
+
+// -----------------------------------------------------------------------------
+// Static Variables
+
+static const sl_crc_algorithm_t crc32 = SL_CRC_ALGORITHM_CRC32;
+static const sl_crc_algorithm_t crc16_arc = SL_CRC_ALGORITHM_CRC16_ARC;
+static const sl_crc_algorithm_t crc16_modbus = SL_CRC_ALGORITHM_CRC16_MODBUS;
+static const sl_crc_algorithm_t crc16_kermit = SL_CRC_ALGORITHM_CRC16_KERMIT;
+
+// Other reflected algorithms, with check values from the CRC catalogue.
+static const sl_crc_algorithm_t crc32c = { 32, 0x1EDC6F41UL, 0xFFFFFFFFUL, 0xFFFFFFFFUL, 0xE3069283UL };
+static const sl_crc_algorithm_t crc32_jamcrc = { 32, 0x04C11DB7UL, 0xFFFFFFFFUL, 0x00000000UL, 0x340BC6D9UL };
+static const sl_crc_algorithm_t crc16_x25 = { 16, 0x1021UL, 0xFFFFUL, 0xFFFFUL, 0x906EUL };
+static const sl_crc_algorithm_t crc16_maxim = { 16, 0x8005UL, 0x0000UL, 0xFFFFUL, 0x44C2UL };
+
+static const struct {
+  const char *name;
+  const sl_crc_algorithm_t *algorithm;
+} algorithms[] = {
+  { "CRC-32", &crc32 },
+  { "CRC-16/ARC", &crc16_arc },
+  { "CRC-16/MODBUS", &crc16_modbus },
+  { "CRC-16/KERMIT", &crc16_kermit },
+  { "CRC-32C", &crc32c },
+  { "CRC-32/JAMCRC", &crc32_jamcrc },
+  { "CRC-16/X-25", &crc16_x25 },
+  { "CRC-16/MAXIM", &crc16_maxim },
+};
+
+#define ALGORITHM_COUNT  (sizeof(algorithms) / sizeof(algorithms[0]))
+
+static const char quick_fox[] = "The quick brown fox jumps over the lazy dog";
+
+// Published values for the algorithms of sl_crc.h, in the order CRC-32, ARC,
+// MODBUS, KERMIT.
+static const struct {
+  const char *data;
+  size_t length;
+  uint32_t expected[4];
+} vectors[] = {
+  { "", 0, { 0x00000000UL, 0x0000UL, 0xFFFFUL, 0x0000UL } },
+  { "a", 1, { 0xE8B7BE43UL, 0xE8C1UL, 0xA87EUL, 0x728FUL } },
+  { "abc", 3, { 0x352441C2UL, 0x9738UL, 0x5749UL, 0x58E9UL } },
+  { "123456789", 9, { 0xCBF43926UL, 0xBB3DUL, 0x4B37UL, 0x2189UL } },
+  { quick_fox, sizeof(quick_fox) - 1, { 0x414FA339UL, 0xFCDFUL, 0xA89CUL, 0xC459UL } },
+};
+
+static sl_crc_table_t tables[ALGORITHM_COUNT];
+static unsigned int failures;
+
+// -----------------------------------------------------------------------------
+// Static Function Definitions
+
+void assertEFM(const char *file, int line)
+{
+  fprintf(stderr, "assertion failed at %s:%d\n", file, line);
+  exit(2);
+}
+
+static void expect(int condition, const char *name, const char *what, uint32_t got, uint32_t expected)
+{
+  if (!condition) {
+    printf("FAIL %s: %s, got 0x%08lX expected 0x%08lX\n",
+           name, what, (unsigned long)got, (unsigned long)expected);
+    failures++;
+  }
+}
+
+// Bitwise reference, most significant bit first on reflected input bytes,
+// sharing nothing with the table-driven implementation.
+static uint32_t crc_reference(const sl_crc_algorithm_t *algorithm, const uint8_t *data, size_t length)
+{
+  uint8_t width = algorithm->width;
+  uint32_t top = 1UL << (width - 1U);
+  uint32_t mask = (width == 32U) ? 0xFFFFFFFFUL : ((1UL << width) - 1UL);
+  uint32_t value = algorithm->init;
+  uint32_t reflected = 0;
+  uint8_t byte;
+
+  for (size_t i = 0; i < length; i++) {
+    byte = 0;
+    for (int bit = 0; bit < 8; bit++) {
+      byte |= (uint8_t)(((data[i] >> bit) & 1U) << (7 - bit));
+    }
+    value ^= (uint32_t)byte << (width - 8U);
+    for (int bit = 0; bit < 8; bit++) {
+      value = ((value & top) != 0UL) ? (((value << 1) ^ algorithm->poly) & mask) : ((value << 1) & mask);
+    }
+  }
+
+  for (uint8_t bit = 0; bit < width; bit++) {
+    reflected = (reflected << 1) | ((value >> bit) & 1UL);
+  }
+  return reflected ^ algorithm->xor_out;
+}
+
+static uint32_t crc_one_shot(size_t index, const void *data, size_t length)
+{
+  sl_crc_t crc;
+
+  sl_crc_init(&crc, algorithms[index].algorithm, &tables[index]);
+  sl_crc_update(&crc, data, length);
+  return sl_crc_final(&crc);
+}
+
+static void test_check_values(void)
+{
+  sl_crc_t crc;
+  uint32_t value;
+
+  for (size_t i = 0; i < ALGORITHM_COUNT; i++) {
+    const sl_crc_algorithm_t *algorithm = algorithms[i].algorithm;
+
+    value = crc_one_shot(i, "123456789", 9);
+    expect(value == algorithm->check, algorithms[i].name, "check value", value, algorithm->check);
+
+    value = crc_reference(algorithm, (const uint8_t *)"123456789", 9);
+    expect(value == algorithm->check, algorithms[i].name, "reference check value", value, algorithm->check);
+
+    sl_crc_init(&crc, algorithm, &tables[i]);
+    expect(sl_crc_check(&crc) == SL_STATUS_OK, algorithms[i].name, "sl_crc_check()", 0, 0);
+  }
+}
+
+static void test_known_vectors(void)
+{
+  uint32_t value;
+
+  for (size_t v = 0; v < sizeof(vectors) / sizeof(vectors[0]); v++) {
+    for (size_t i = 0; i < 4; i++) {
+      value = crc_one_shot(i, vectors[v].data, vectors[v].length);
+      expect(value == vectors[v].expected[i], algorithms[i].name, vectors[v].data, value, vectors[v].expected[i]);
+    }
+  }
+}
+
+// RFC 3720 iSCSI vectors for CRC-32C, longer than one slicing step.
+static void test_crc32c_vectors(void)
+{
+  uint8_t data[32];
+  uint32_t value;
+
+  memset(data, 0x00, sizeof(data));
+  value = crc_one_shot(4, data, sizeof(data));
+  expect(value == 0x8A9136AAUL, "CRC-32C", "32 bytes of zeros", value, 0x8A9136AAUL);
+
+  memset(data, 0xFF, sizeof(data));
+  value = crc_one_shot(4, data, sizeof(data));
+  expect(value == 0x62A8AB43UL, "CRC-32C", "32 bytes of ones", value, 0x62A8AB43UL);
+
+  for (size_t i = 0; i < sizeof(data); i++) {
+    data[i] = (uint8_t)i;
+  }
+  value = crc_one_shot(4, data, sizeof(data));
+  expect(value == 0x46DD794EUL, "CRC-32C", "32 incrementing bytes", value, 0x46DD794EUL);
+}
+
+// Random data at random alignment, fed in random pieces, including empty
+// ones. sl_crc_final() is called between pieces, which must not disturb the
+// stream.
+static void test_random_splits(void)
+{
+  static uint8_t buffer[RANDOM_MAX_LENGTH + 8];
+  sl_crc_t crc;
+  uint32_t expected;
+  uint32_t value;
+  size_t offset;
+  size_t length;
+  size_t position;
+  size_t piece;
+
+  srand(1);
+  for (size_t i = 0; i < ALGORITHM_COUNT; i++) {
+    for (int stream = 0; stream < RANDOM_STREAMS; stream++) {
+      offset = (size_t)rand() % 8U;
+      length = (size_t)rand() % (RANDOM_MAX_LENGTH + 1U);
+      for (size_t b = 0; b < length; b++) {
+        buffer[offset + b] = (uint8_t)rand();
+      }
+      expected = crc_reference(algorithms[i].algorithm, &buffer[offset], length);
+
+      sl_crc_init(&crc, algorithms[i].algorithm, &tables[i]);
+      position = 0;
+      while (position < length) {
+        piece = ((rand() % 4) == 0) ? (size_t)rand() % 9U : (size_t)rand() % 100U;
+        if (piece > (length - position)) {
+          piece = length - position;
+        }
+        sl_crc_update(&crc, &buffer[offset + position], piece);
+        position += piece;
+        (void)sl_crc_final(&crc);
+      }
+      value = sl_crc_final(&crc);
+      expect(value == expected, algorithms[i].name, "random split stream", value, expected);
+
+      value = crc_one_shot(i, &buffer[offset], length);
+      expect(value == expected, algorithms[i].name, "random stream", value, expected);
+    }
+  }
+}
+
+// -----------------------------------------------------------------------------
+// Global Function Definitions
+
+int main(void)
+{
+  for (size_t i = 0; i < ALGORITHM_COUNT; i++) {
+    sl_crc_table_init(&tables[i], algorithms[i].algorithm);
+  }
+
+  test_check_values();
+  test_known_vectors();
+  test_crc32c_vectors();
+  test_random_splits();
+
+  if (failures != 0) {
+    printf("%u failures\n", failures);
+    return 1;
+  }
+  printf("sl_crc: all tests passed\n");
+  return 0;
+}
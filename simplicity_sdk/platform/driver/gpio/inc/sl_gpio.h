@@ -65,6 +65,16 @@ extern "C" {
 ///  The GPIO driver is used for external and EM4 interrupt configuration, port and pin configuration.
 ///  as well as manages the interrupt handler.
 ///
+///  External interrupts can optionally be put in edge capture mode with
+///  @ref sl_gpio_enable_edge_capture(). In that mode the interrupt handler
+///  only stamps the edge with the sleeptimer tick count, samples the pin level
+///  and queues the event. The events are then delivered in batches from thread
+///  context by @ref sl_gpio_process_captured_edges(), which keeps the interrupt
+///  handler short for high-rate lines such as encoders or sensor data-ready
+///  signals. An optional notify callback registered with
+///  @ref sl_gpio_set_edge_capture_notify() tells the consumer when a batch is
+///  ready, e.g. to post a semaphore or an event flag.
+///
 /// @{
 // *****************************************************************************
 
@@ -93,6 +103,27 @@ typedef struct {
   sl_gpio_pin_direction_t direction;
 } sl_gpio_pin_config_t;
 
+/***************************************************************************//**
+ * @brief
+ *   Structure for an edge captured on an external interrupt.
+ ******************************************************************************/
+typedef struct {
+  uint32_t timestamp;  ///< Sleeptimer tick count when the interrupt was handled.
+  uint8_t int_no;      ///< Pin interrupt number.
+  bool level;          ///< Pin input level sampled when the interrupt was handled.
+} sl_gpio_edge_event_t;
+
+/***************************************************************************//**
+ * @brief
+ *   Structure for edge capture statistics.
+ ******************************************************************************/
+typedef struct {
+  uint32_t captured;    ///< Number of edges queued by the interrupt handler.
+  uint32_t delivered;   ///< Number of edges delivered to the batch callback.
+  uint32_t overruns;    ///< Number of edges dropped because the queue was full.
+  uint32_t max_queued;  ///< Largest number of edges waiting in the queue.
+} sl_gpio_edge_capture_statistics_t;
+
 /*******************************************************************************
  *******************************   TYPEDEFS   **********************************
  ******************************************************************************/
@@ -105,6 +136,26 @@ typedef struct {
  ******************************************************************************/
 typedef void (*sl_gpio_irq_callback_t)(uint8_t int_no, void *context);
 
+/***************************************************************************//**
+ * GPIO edge capture batch callback function pointer.
+ *
+ * @param events Pointer to the captured edges, oldest first.
+ * @param count Number of captured edges in the batch.
+ * @param context Pointer to callback context.
+ ******************************************************************************/
+typedef void (*sl_gpio_edge_capture_callback_t)(const sl_gpio_edge_event_t *events,
+                                                uint32_t count,
+                                                void *context);
+
+/***************************************************************************//**
+ * GPIO edge capture notify callback function pointer.
+ *
+ * @note Called from interrupt context.
+ *
+ * @param context Pointer to callback context.
+ ******************************************************************************/
+typedef void (*sl_gpio_edge_capture_notify_t)(void *context);
+
 /*******************************************************************************
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
@@ -515,6 +566,105 @@ sl_status_t sl_gpio_unlock(void);
  ******************************************************************************/
 sl_status_t sl_gpio_is_locked(bool *state);
 
+/***************************************************************************//**
+ * Puts a configured external interrupt in edge capture mode.
+ *
+ * @note The interrupt must first be configured with
+ *       sl_gpio_configure_external_interrupt(). While in edge capture mode, the
+ *       callback registered for the interrupt is not called; the edges are
+ *       queued and delivered by sl_gpio_process_captured_edges() instead.
+ *       The timestamps are sleeptimer ticks and are 0 when the sleeptimer is
+ *       not part of the project.
+ *
+ * @param[in] gpio Pointer to GPIO structure with port and pin of the interrupt,
+ *                 used to sample the pin level.
+ * @param[in] int_no Pin interrupt number returned by
+ *                   sl_gpio_configure_external_interrupt().
+ *
+ * @return SL_STATUS_OK if there's no error.
+ *         SL_STATUS_NULL_POINTER if gpio is passed as null.
+ *         SL_STATUS_INVALID_PARAMETER if any of the port, pin, int_no parameters are invalid.
+ ******************************************************************************/
+sl_status_t sl_gpio_enable_edge_capture(const sl_gpio_t *gpio,
+                                        int32_t int_no);
+
+/***************************************************************************//**
+ * Takes an external interrupt out of edge capture mode.
+ *
+ * @note Edges already queued for the interrupt are still delivered by
+ *       sl_gpio_process_captured_edges().
+ *
+ * @param[in] int_no Pin interrupt number.
+ *
+ * @return SL_STATUS_OK if there's no error.
+ *         SL_STATUS_INVALID_PARAMETER if int_no is invalid.
+ ******************************************************************************/
+sl_status_t sl_gpio_disable_edge_capture(int32_t int_no);
+
+/***************************************************************************//**
+ * Registers the callback receiving the captured edges.
+ *
+ * @param[in] callback A pointer to the batch callback function, or NULL to
+ *                     discard the captured edges.
+ * @param[in] context A pointer to the callback context.
+ *
+ * @return SL_STATUS_OK if there's no error.
+ ******************************************************************************/
+sl_status_t sl_gpio_set_edge_capture_callback(sl_gpio_edge_capture_callback_t callback,
+                                              void *context);
+
+/***************************************************************************//**
+ * Registers the callback signaling that captured edges are ready.
+ *
+ * @note The notify callback is called from the interrupt handler for the first
+ *       edge queued since the last call to sl_gpio_process_captured_edges(),
+ *       so that the consumer is signaled once per batch rather than per edge.
+ *       It must only signal the consumer, e.g. post a semaphore or set an
+ *       event flag, and not process the edges itself.
+ *
+ * @param[in] notify A pointer to the notify callback function, or NULL to
+ *                   poll sl_gpio_process_captured_edges() instead.
+ * @param[in] context A pointer to the callback context.
+ *
+ * @return SL_STATUS_OK if there's no error.
+ ******************************************************************************/
+sl_status_t sl_gpio_set_edge_capture_notify(sl_gpio_edge_capture_notify_t notify,
+                                            void *context);
+
+/***************************************************************************//**
+ * Delivers the queued edges to the edge capture callback.
+ *
+ * @note This function must be called from thread context, periodically or
+ *       after being signaled by the callback registered with
+ *       sl_gpio_set_edge_capture_notify(). The callback is called once per
+ *       contiguous run of queued edges, so a call usually results in a single
+ *       batch. Edges captured while the callback runs are delivered on the
+ *       next call, and signal again.
+ *
+ * @param[out] event_count Pointer to store the number of edges delivered.
+ *                         Can be NULL.
+ *
+ * @return SL_STATUS_OK if there's no error.
+ ******************************************************************************/
+sl_status_t sl_gpio_process_captured_edges(uint32_t *event_count);
+
+/***************************************************************************//**
+ * Gets the edge capture statistics.
+ *
+ * @param[out] statistics Pointer to store the statistics.
+ *
+ * @return SL_STATUS_OK if there's no error.
+ *         SL_STATUS_NULL_POINTER if statistics is passed as null.
+ ******************************************************************************/
+sl_status_t sl_gpio_get_edge_capture_statistics(sl_gpio_edge_capture_statistics_t *statistics);
+
+/***************************************************************************//**
+ * Clears the edge capture statistics.
+ *
+ * @return SL_STATUS_OK if there's no error.
+ ******************************************************************************/
+sl_status_t sl_gpio_clear_edge_capture_statistics(void);
+
 /** @} (end addtogroup gpio driver) */
 #ifdef __cplusplus
 }
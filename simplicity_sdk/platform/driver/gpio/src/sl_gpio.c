@@ -29,12 +29,19 @@
  ******************************************************************************/
 
 #include <stddef.h>
+#include <string.h>
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
 #include "sl_core.h"
 #include "sl_common.h"
 #include "sl_interrupt_manager.h"
 #include "sl_clock_manager.h"
 #include "sl_hal_gpio.h"
 #include "sl_gpio.h"
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+#include "sl_sleeptimer.h"
+#endif
 
 /*******************************************************************************
  *******************************   DEFINES   ***********************************
@@ -46,6 +53,18 @@
 /// Pin direction validation.
 #define SL_GPIO_DIRECTION_IS_VALID(direction)  (direction <= SL_GPIO_PIN_DIRECTION_OUT)
 
+/// Number of captured edges that can be queued. Must be a power of two.
+#ifndef SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE
+#define SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE  32
+#endif
+
+#if (SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE & (SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE - 1)) != 0
+#error "SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE must be a power of two"
+#endif
+
+/// Pin interrupt number validation.
+#define SL_GPIO_INT_NO_IS_VALID(int_no)  (((int_no) >= 0) && ((int_no) <= SL_HAL_GPIO_INTERRUPT_MAX))
+
 /*******************************************************************************
  *******************************   STRUCTS   ***********************************
  ******************************************************************************/
@@ -68,6 +87,28 @@ typedef struct {
   sl_gpio_callback_desc_t callback_em4[SL_HAL_GPIO_INTERRUPT_MAX];
 } sl_gpio_callbacks_t;
 
+typedef struct {
+  // Mask of the external interrupts in edge capture mode.
+  uint32_t int_mask;
+  // Pins sampled for the external interrupts in edge capture mode.
+  sl_gpio_t pins[SL_HAL_GPIO_INTERRUPT_MAX + 1];
+  // Batch callback and its context.
+  sl_gpio_edge_capture_callback_t callback;
+  void *context;
+  // Notify callback and its context.
+  sl_gpio_edge_capture_notify_t notify;
+  void *notify_context;
+  // Set once the consumer was notified, cleared when it takes the queued edges.
+  bool notified;
+  // Single producer (interrupt handlers), single consumer (thread) queue.
+  // The indexes are free running, only the producer writes head and only
+  // the consumer writes tail.
+  sl_gpio_edge_event_t queue[SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE];
+  volatile uint32_t head;
+  volatile uint32_t tail;
+  sl_gpio_edge_capture_statistics_t statistics;
+} sl_gpio_edge_capture_t;
+
 /*******************************************************************************
  ********************************   GLOBALS   **********************************
  ******************************************************************************/
@@ -75,10 +116,14 @@ typedef struct {
 // Variable to manage and organize the callback functions for External and EM4 interrupts.
 static sl_gpio_callbacks_t gpio_interrupts = { 0 };
 
+// Edge capture mode state.
+static sl_gpio_edge_capture_t gpio_edge_capture = { 0 };
+
 /*******************************************************************************
  ******************************   LOCAL FUCTIONS   *****************************
  ******************************************************************************/
 static void sl_gpio_dispatch_interrupt(uint32_t iflags);
+static void sl_gpio_capture_edge(uint32_t int_no);
 
 /***************************************************************************//**
  *   Driver GPIO Initialization.
@@ -507,6 +552,7 @@ sl_status_t sl_gpio_deconfigure_external_interrupt(int32_t int_no)
   // Callback deregistration.
   gpio_interrupts.callback_ext[int_no].callback = NULL;
   gpio_interrupts.callback_ext[int_no].context = NULL;
+  gpio_edge_capture.int_mask &= ~(1UL << int_no);
 
   CORE_EXIT_ATOMIC();
   return SL_STATUS_OK;
@@ -757,6 +803,225 @@ sl_status_t sl_gpio_is_locked(bool *state)
   return SL_STATUS_OK;
 }
 
+/***************************************************************************//**
+ *  Puts a configured external interrupt in edge capture mode.
+ ******************************************************************************/
+sl_status_t sl_gpio_enable_edge_capture(const sl_gpio_t *gpio,
+                                        int32_t int_no)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (gpio == NULL) {
+    EFM_ASSERT(false);
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (!SL_HAL_GPIO_PORT_PIN_IS_VALID(gpio->port, gpio->pin) || !SL_GPIO_INT_NO_IS_VALID(int_no)) {
+    EFM_ASSERT(false);
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  gpio_edge_capture.pins[int_no] = *gpio;
+  gpio_edge_capture.int_mask |= (1UL << int_no);
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *  Takes an external interrupt out of edge capture mode.
+ ******************************************************************************/
+sl_status_t sl_gpio_disable_edge_capture(int32_t int_no)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (!SL_GPIO_INT_NO_IS_VALID(int_no)) {
+    EFM_ASSERT(false);
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  gpio_edge_capture.int_mask &= ~(1UL << int_no);
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *  Registers the callback receiving the captured edges.
+ ******************************************************************************/
+sl_status_t sl_gpio_set_edge_capture_callback(sl_gpio_edge_capture_callback_t callback,
+                                              void *context)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+
+  gpio_edge_capture.callback = callback;
+  gpio_edge_capture.context = context;
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *  Registers the callback signaling that captured edges are ready.
+ ******************************************************************************/
+sl_status_t sl_gpio_set_edge_capture_notify(sl_gpio_edge_capture_notify_t notify,
+                                            void *context)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+
+  gpio_edge_capture.notify = notify;
+  gpio_edge_capture.notify_context = context;
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *  Delivers the queued edges to the edge capture callback.
+ ******************************************************************************/
+sl_status_t sl_gpio_process_captured_edges(uint32_t *event_count)
+{
+  uint32_t head;
+  uint32_t tail;
+  uint32_t index;
+  uint32_t count;
+  uint32_t delivered = 0;
+  sl_gpio_edge_capture_callback_t callback = gpio_edge_capture.callback;
+  void *context = gpio_edge_capture.context;
+  CORE_DECLARE_IRQ_STATE;
+
+  // Only deliver what is queued now so that a busy line cannot keep
+  // the caller here forever. Edges queued from now on notify again.
+  CORE_ENTER_ATOMIC();
+  head = gpio_edge_capture.head;
+  gpio_edge_capture.notified = false;
+  CORE_EXIT_ATOMIC();
+  tail = gpio_edge_capture.tail;
+
+  while (tail != head) {
+    // Deliver the queue in place, one contiguous run at a time.
+    index = tail & (SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE - 1U);
+    count = head - tail;
+    if (count > (SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE - index)) {
+      count = SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE - index;
+    }
+
+    if (callback != NULL) {
+      callback(&gpio_edge_capture.queue[index], count, context);
+    }
+
+    // Release the slots only once the callback is done with them.
+    tail += count;
+    gpio_edge_capture.tail = tail;
+    delivered += count;
+  }
+
+  if (delivered != 0U) {
+    CORE_ATOMIC_SECTION(gpio_edge_capture.statistics.delivered += delivered; )
+  }
+
+  if (event_count != NULL) {
+    *event_count = delivered;
+  }
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *  Gets the edge capture statistics.
+ ******************************************************************************/
+sl_status_t sl_gpio_get_edge_capture_statistics(sl_gpio_edge_capture_statistics_t *statistics)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  if (statistics == NULL) {
+    EFM_ASSERT(false);
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  CORE_ENTER_ATOMIC();
+
+  *statistics = gpio_edge_capture.statistics;
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ *  Clears the edge capture statistics.
+ ******************************************************************************/
+sl_status_t sl_gpio_clear_edge_capture_statistics(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+
+  memset(&gpio_edge_capture.statistics, 0, sizeof(gpio_edge_capture.statistics));
+
+  CORE_EXIT_ATOMIC();
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Function queues an edge of an external interrupt in edge capture mode.
+ *
+ * @details This function is called by the dispatcher from the IRQHandlers.
+ *          The even and odd handlers may preempt each other, so the slot is
+ *          filled within an atomic section. When the queue is full the edge
+ *          is dropped and counted as an overrun. The first edge queued since
+ *          the consumer last took the queue calls the notify callback.
+ *
+ * @param int_no Pin interrupt number of the edge.
+ ******************************************************************************/
+static void sl_gpio_capture_edge(uint32_t int_no)
+{
+  uint32_t queued;
+  sl_gpio_edge_event_t *event;
+  sl_gpio_edge_capture_notify_t notify = NULL;
+  void *notify_context = NULL;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+
+  queued = gpio_edge_capture.head - gpio_edge_capture.tail;
+  if (queued >= SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE) {
+    gpio_edge_capture.statistics.overruns++;
+    CORE_EXIT_ATOMIC();
+    return;
+  }
+
+  event = &gpio_edge_capture.queue[gpio_edge_capture.head & (SL_GPIO_EDGE_CAPTURE_QUEUE_SIZE - 1U)];
+#if defined(SL_CATALOG_SLEEPTIMER_PRESENT)
+  event->timestamp = sl_sleeptimer_get_tick_count();
+#else
+  event->timestamp = 0;
+#endif
+  event->int_no = (uint8_t)int_no;
+  event->level = sl_hal_gpio_get_pin_input(&gpio_edge_capture.pins[int_no]);
+
+  gpio_edge_capture.head++;
+  gpio_edge_capture.statistics.captured++;
+  if ((queued + 1U) > gpio_edge_capture.statistics.max_queued) {
+    gpio_edge_capture.statistics.max_queued = queued + 1U;
+  }
+  if (!gpio_edge_capture.notified && (gpio_edge_capture.notify != NULL)) {
+    gpio_edge_capture.notified = true;
+    notify = gpio_edge_capture.notify;
+    notify_context = gpio_edge_capture.notify_context;
+  }
+
+  CORE_EXIT_ATOMIC();
+
+  // Signal the consumer outside of the atomic section.
+  if (notify != NULL) {
+    notify(notify_context);
+  }
+}
+
 /***************************************************************************//**
  * Function calls users callback for registered pin interrupts.
  *
@@ -778,6 +1043,11 @@ static void sl_gpio_dispatch_interrupt(uint32_t iflags)
     iflags &= ~(1UL << irq_idx);
 
     if (irq_idx <= SL_HAL_GPIO_INTERRUPT_MAX) {
+      // Queue the edge instead of calling the user callback.
+      if ((gpio_edge_capture.int_mask & (1UL << irq_idx)) != 0U) {
+        sl_gpio_capture_edge(irq_idx);
+        continue;
+      }
       callback = &gpio_interrupts.callback_ext[irq_idx];
     } else {
       callback = &gpio_interrupts.callback_em4[irq_idx - SL_HAL_GPIO_EM4WUEN_SHIFT];
@@ -21,6 +21,20 @@
 // <i> Default: 0
 #define EMDRV_DMADRV_DMA_CH_PRIORITY 0
 
+// <o EMDRV_DMADRV_MEM_CPU_THRESHOLD> Memory copy CPU threshold in bytes
+// <i> DMADRV_MemCopy() and DMADRV_MemSet() requests shorter than this are
+// <i> done by the CPU. Can be changed at runtime with
+// <i> DMADRV_MemSetCpuThreshold().
+// <i> Default: 64
+#define EMDRV_DMADRV_MEM_CPU_THRESHOLD 64
+
+// <o EMDRV_DMADRV_MEM_DESCRIPTOR_COUNT> Descriptors per memory operation <1-16>
+// <i> Number of linked descriptors started at once for a DMADRV_MemCopy() or
+// <i> DMADRV_MemSet() request. Longer requests are restarted from the
+// <i> completion interrupt.
+// <i> Default: 4
+#define EMDRV_DMADRV_MEM_DESCRIPTOR_COUNT 4
+
 // <<< end of configuration section >>>
 
 #endif // DMADRV_CONFIG_H
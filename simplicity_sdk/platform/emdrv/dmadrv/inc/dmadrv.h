@@ -31,6 +31,7 @@
 #ifndef __SILICON_LABS_DMADRV_H__
 #define __SILICON_LABS_DMADRV_H__
 
+#include <stddef.h>
 #include "em_device.h"
 
 #include "ecode.h"
@@ -51,6 +52,14 @@
 #include "dmadrv_config.h"
 #include "sl_code_classification.h"
 
+#if !defined(EMDRV_DMADRV_MEM_CPU_THRESHOLD)
+#define EMDRV_DMADRV_MEM_CPU_THRESHOLD 64
+#endif
+
+#if !defined(EMDRV_DMADRV_MEM_DESCRIPTOR_COUNT)
+#define EMDRV_DMADRV_MEM_DESCRIPTOR_COUNT 4
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -100,6 +109,45 @@ typedef bool (*DMADRV_Callback_t)(unsigned int channel,
                                   unsigned int sequenceNo,
                                   void *userParam);
 
+typedef struct DMADRV_MemOp DMADRV_MemOp_t;
+
+/***************************************************************************//**
+ * @brief
+ *  DMADRV memory operation completion callback function.
+ *
+ * @details
+ *  Called from the DMA interrupt handler when a DMA memory operation
+ *  completes, or from the calling context when the operation was done by
+ *  the CPU.
+ *
+ * @param[in] op
+ *  The completed memory operation.
+ *
+ * @param[in] userParam
+ *  Optional user parameter supplied on invocation.
+ ******************************************************************************/
+typedef void (*DMADRV_MemCallback_t)(DMADRV_MemOp_t *op,
+                                     void *userParam);
+
+/// A memory copy or set operation. Owned by the caller and must stay valid
+/// until the operation completes.
+struct DMADRV_MemOp {
+#if defined(EMDRV_DMADRV_LDMA)
+  LDMA_Descriptor_t        desc[EMDRV_DMADRV_MEM_DESCRIPTOR_COUNT]; ///< Descriptors of the running chain.
+#elif defined(EMDRV_DMADRV_LDMA_S3)
+  sl_hal_ldma_descriptor_t desc[EMDRV_DMADRV_MEM_DESCRIPTOR_COUNT]; ///< Descriptors of the running chain.
+#endif
+  uint8_t                  *dst;                                     ///< Next destination address.
+  const uint8_t            *src;                                     ///< Next source address, unused by a set.
+  size_t                   remaining;                                ///< Bytes not handed to the DMA yet.
+  uint32_t                 pattern;                                  ///< Fill pattern of a set.
+  DMADRV_DataSize_t        size;                                     ///< Transfer unit size.
+  bool                     set;                                      ///< True for a set, false for a copy.
+  volatile bool            done;                                     ///< True when the operation completed.
+  DMADRV_MemCallback_t     callback;                                 ///< Completion callback, can be NULL.
+  void                     *userParam;                               ///< Passed to the callback.
+};
+
 Ecode_t DMADRV_AllocateChannel(unsigned int *channelId,
                                void         *capabilities);
 Ecode_t DMADRV_AllocateChannelById(unsigned int channelId,
@@ -108,6 +156,22 @@ Ecode_t DMADRV_DeInit(void);
 Ecode_t DMADRV_FreeChannel(unsigned int channelId);
 Ecode_t DMADRV_Init(void);
 
+Ecode_t DMADRV_MemCopy(DMADRV_MemOp_t       *op,
+                       void                 *dst,
+                       const void           *src,
+                       size_t               len,
+                       DMADRV_MemCallback_t callback,
+                       void                 *cbUserParam);
+Ecode_t DMADRV_MemSet(DMADRV_MemOp_t       *op,
+                      void                 *dst,
+                      int                  value,
+                      size_t               len,
+                      DMADRV_MemCallback_t callback,
+                      void                 *cbUserParam);
+Ecode_t DMADRV_MemWait(DMADRV_MemOp_t *op);
+void DMADRV_MemSetCpuThreshold(size_t len);
+size_t DMADRV_MemGetCpuThreshold(void);
+
 Ecode_t DMADRV_MemoryPeripheral(unsigned int              channelId,
                                 DMADRV_PeripheralSignal_t peripheralSignal,
                                 void                      *dst,
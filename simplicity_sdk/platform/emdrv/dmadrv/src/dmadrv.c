@@ -30,6 +30,7 @@
 
 #include <stdbool.h>
 #include <stddef.h>
+#include <string.h>
 
 #include "em_device.h"
 #include "sl_core.h"
@@ -96,6 +97,8 @@ typedef struct {
 #endif
 
 static DmaXfer_t dmaXfer[EMDRV_DMADRV_DMA_CH_COUNT];
+
+static size_t memCpuThreshold = EMDRV_DMADRV_MEM_CPU_THRESHOLD;
 #endif
 
 static Ecode_t StartTransfer(DmaMode_t                 mode,
@@ -115,6 +118,23 @@ static Ecode_t StartTransfer(DmaMode_t                 mode,
 static void LDMA_IRQHandlerDefault(uint8_t chnum);
 #endif
 
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+static Ecode_t MemOpStart(DMADRV_MemOp_t       *op,
+                          void                 *dst,
+                          const void           *src,
+                          int                  value,
+                          bool                 set,
+                          size_t               len,
+                          DMADRV_MemCallback_t callback,
+                          void                 *cbUserParam);
+
+static void MemOpLoad(DMADRV_MemOp_t *op, unsigned int channelId);
+
+static bool MemOpCallback(unsigned int channel,
+                          unsigned int sequenceNo,
+                          void *userParam);
+#endif
+
 /// @endcond
 
 /***************************************************************************//**
@@ -446,6 +466,154 @@ Ecode_t DMADRV_LdmaStartTransfer(int                            channelId,
 }
 #endif
 
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+/***************************************************************************//**
+ * @brief
+ *  Start a memory to memory copy.
+ *
+ * @details
+ *  The copy is split into DMA descriptors of at most
+ *  @ref DMADRV_MAX_XFER_COUNT items, using the widest item size the buffer
+ *  alignment allows. Each copy runs on its own free DMA channel, so several
+ *  copies proceed concurrently. Copies shorter than the CPU threshold, or
+ *  started when no DMA channel is free, are done by the CPU before this
+ *  function returns.
+ *
+ * @param[in] op
+ *  The operation, owned by the caller until it completes.
+ *
+ * @param[in] dst
+ *  A destination memory address.
+ *
+ * @param[in] src
+ *  A source memory address. The buffers must not overlap.
+ *
+ * @param[in] len
+ *  A number of bytes to copy.
+ *
+ * @param[in] callback
+ *  A function to call on completion, use NULL if not needed.
+ *
+ * @param[in] cbUserParam
+ *  An optional user parameter to feed to the callback function. Use NULL if
+ *  not needed.
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_MemCopy(DMADRV_MemOp_t       *op,
+                       void                 *dst,
+                       const void           *src,
+                       size_t               len,
+                       DMADRV_MemCallback_t callback,
+                       void                 *cbUserParam)
+{
+  if ( src == NULL ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  return MemOpStart(op, dst, src, 0, false, len, callback, cbUserParam);
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Get the length below which memory operations are done by the CPU.
+ *
+ * @return
+ *  The threshold in bytes.
+ ******************************************************************************/
+size_t DMADRV_MemGetCpuThreshold(void)
+{
+  return memCpuThreshold;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Start a memory fill.
+ *
+ * @details
+ *  Behaves as @ref DMADRV_MemCopy(), the DMA reads the fill pattern from the
+ *  operation without incrementing the source address.
+ *
+ * @param[in] op
+ *  The operation, owned by the caller until it completes.
+ *
+ * @param[in] dst
+ *  A destination memory address.
+ *
+ * @param[in] value
+ *  The byte value to fill with.
+ *
+ * @param[in] len
+ *  A number of bytes to fill.
+ *
+ * @param[in] callback
+ *  A function to call on completion, use NULL if not needed.
+ *
+ * @param[in] cbUserParam
+ *  An optional user parameter to feed to the callback function. Use NULL if
+ *  not needed.
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_MemSet(DMADRV_MemOp_t       *op,
+                      void                 *dst,
+                      int                  value,
+                      size_t               len,
+                      DMADRV_MemCallback_t callback,
+                      void                 *cbUserParam)
+{
+  return MemOpStart(op, dst, NULL, value, true, len, callback, cbUserParam);
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Set the length below which memory operations are done by the CPU.
+ *
+ * @details
+ *  Short operations complete faster on the CPU than the DMA setup and
+ *  completion interrupt take. The crossover depends on the core clock, the
+ *  memory wait states and the bus load, so it can be tuned at runtime.
+ *
+ * @param[in] len
+ *  The threshold in bytes. Use 0 to always use the DMA when a channel is free.
+ ******************************************************************************/
+void DMADRV_MemSetCpuThreshold(size_t len)
+{
+  memCpuThreshold = len;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Wait for a memory operation to complete.
+ *
+ * @note
+ *  Must not be called from an interrupt with a priority equal to or higher
+ *  than the DMA interrupt.
+ *
+ * @param[in] op
+ *  The operation started by @ref DMADRV_MemCopy() or @ref DMADRV_MemSet().
+ *
+ * @return
+ *   @ref ECODE_EMDRV_DMADRV_OK on success. On failure, an appropriate
+ *   DMADRV @ref Ecode_t is returned.
+ ******************************************************************************/
+Ecode_t DMADRV_MemWait(DMADRV_MemOp_t *op)
+{
+  if ( op == NULL ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  while ( !op->done ) {
+  }
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+#endif
+
 /***************************************************************************//**
  * @brief
  *  Start a memory to a peripheral DMA transfer.
@@ -1703,6 +1871,178 @@ static Ecode_t StartTransfer(DmaMode_t             mode,
 }
 #endif /* defined( EMDRV_DMADRV_LDMA_S3 ) */
 
+#if defined(EMDRV_DMADRV_LDMA) || defined(EMDRV_DMADRV_LDMA_S3)
+/***************************************************************************//**
+ * @brief
+ *  Start a memory copy or fill on a free DMA channel or on the CPU.
+ ******************************************************************************/
+static Ecode_t MemOpStart(DMADRV_MemOp_t       *op,
+                          void                 *dst,
+                          const void           *src,
+                          int                  value,
+                          bool                 set,
+                          size_t               len,
+                          DMADRV_MemCallback_t callback,
+                          void                 *cbUserParam)
+{
+  unsigned int channelId;
+  uintptr_t align;
+  size_t tail;
+
+  if ( !initialized ) {
+    return ECODE_EMDRV_DMADRV_NOT_INITIALIZED;
+  }
+
+  if ( (op == NULL) || (dst == NULL) ) {
+    return ECODE_EMDRV_DMADRV_PARAM_ERROR;
+  }
+
+  op->dst       = (uint8_t *)dst;
+  op->src       = (const uint8_t *)src;
+  op->set       = set;
+  op->pattern   = 0x01010101UL * (uint8_t)value;
+  op->done      = false;
+  op->callback  = callback;
+  op->userParam = cbUserParam;
+
+  if ( (len < memCpuThreshold)
+       || (DMADRV_AllocateChannel(&channelId, NULL) != ECODE_EMDRV_DMADRV_OK) ) {
+    if ( set ) {
+      memset(dst, value, len);
+    } else {
+      memcpy(dst, src, len);
+    }
+    op->remaining = 0;
+    op->done      = true;
+    if ( callback != NULL ) {
+      callback(op, cbUserParam);
+    }
+    return ECODE_EMDRV_DMADRV_OK;
+  }
+
+  /* Use the widest item size the addresses allow, the CPU does the tail. */
+  align = (uintptr_t)dst | (set ? 0U : (uintptr_t)src);
+  if ( (align & 3U) == 0U ) {
+    op->size = dmadrvDataSize4;
+    tail     = len & 3U;
+  } else if ( (align & 1U) == 0U ) {
+    op->size = dmadrvDataSize2;
+    tail     = len & 1U;
+  } else {
+    op->size = dmadrvDataSize1;
+    tail     = 0U;
+  }
+  op->remaining = len - tail;
+  if ( set ) {
+    memset(&op->dst[op->remaining], value, tail);
+  } else {
+    memcpy(&op->dst[op->remaining], &op->src[op->remaining], tail);
+  }
+
+  if ( op->remaining == 0U ) {
+    DMADRV_FreeChannel(channelId);
+    op->done = true;
+    if ( callback != NULL ) {
+      callback(op, cbUserParam);
+    }
+    return ECODE_EMDRV_DMADRV_OK;
+  }
+
+  MemOpLoad(op, channelId);
+
+  return ECODE_EMDRV_DMADRV_OK;
+}
+
+/***************************************************************************//**
+ * @brief
+ *  Build and start the next descriptor chain of a memory operation.
+ ******************************************************************************/
+static void MemOpLoad(DMADRV_MemOp_t *op, unsigned int channelId)
+{
+  unsigned int i;
+  size_t count;
+  size_t bytes;
+  const void *src;
+#if defined(EMDRV_DMADRV_LDMA)
+  LDMA_TransferCfg_t xfer = LDMA_TRANSFER_CFG_MEMORY();
+  LDMA_Descriptor_t *desc;
+#else
+  sl_hal_ldma_transfer_config_t xfer = SL_HAL_LDMA_TRANSFER_CFG_MEMORY();
+  sl_hal_ldma_descriptor_t *desc;
+#endif
+
+  for ( i = 0U; (i < EMDRV_DMADRV_MEM_DESCRIPTOR_COUNT) && (op->remaining > 0U); i++ ) {
+    count = op->remaining >> op->size;
+    if ( count > (size_t)DMADRV_MAX_XFER_COUNT ) {
+      count = (size_t)DMADRV_MAX_XFER_COUNT;
+    }
+    bytes = count << op->size;
+    src   = op->set ? (const void *)&op->pattern : (const void *)op->src;
+    desc  = &op->desc[i];
+
+#if defined(EMDRV_DMADRV_LDMA)
+    *desc = (LDMA_Descriptor_t)LDMA_DESCRIPTOR_SINGLE_M2M_BYTE(src, op->dst, count);
+    desc->xfer.size = op->size;
+    if ( op->set ) {
+      desc->xfer.srcInc = ldmaCtrlSrcIncNone;
+    }
+    if ( i > 0U ) {
+      /* Link the previous descriptor to this one, only the last interrupts. */
+      op->desc[i - 1U].xfer.doneIfs  = 0;
+      op->desc[i - 1U].xfer.linkMode = ldmaLinkModeRel;
+      op->desc[i - 1U].xfer.link     = 1;
+      op->desc[i - 1U].xfer.linkAddr = 4;
+    }
+#else
+    *desc = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_SINGLE_M2M(op->size, src, op->dst, count);
+    if ( op->set ) {
+      desc->xfer.src_inc = SL_HAL_LDMA_CTRL_SRC_INC_NONE;
+    }
+    if ( i > 0U ) {
+      /* Link the previous descriptor to this one, only the last interrupts. */
+      op->desc[i - 1U].xfer.done_ifs  = 0;
+      op->desc[i - 1U].xfer.link_mode = SL_HAL_LDMA_LINK_MODE_REL;
+      op->desc[i - 1U].xfer.link      = 1;
+      op->desc[i - 1U].xfer.link_addr = 4;
+    }
+#endif
+
+    op->dst       += bytes;
+    op->remaining -= bytes;
+    if ( !op->set ) {
+      op->src += bytes;
+    }
+  }
+
+  DMADRV_LdmaStartTransfer((int)channelId, &xfer, &op->desc[0], MemOpCallback, op);
+}
+
+/***************************************************************************//**
+ * @brief
+ *  DMA completion callback of a memory operation chain.
+ ******************************************************************************/
+static bool MemOpCallback(unsigned int channel,
+                          unsigned int sequenceNo,
+                          void *userParam)
+{
+  DMADRV_MemOp_t *op = (DMADRV_MemOp_t *)userParam;
+  (void)sequenceNo;
+
+  if ( op->remaining > 0U ) {
+    MemOpLoad(op, channel);
+    return true;
+  }
+
+  DMADRV_FreeChannel(channel);
+  op->done = true;
+  if ( op->callback != NULL ) {
+    op->callback(op, op->userParam);
+  }
+
+  return true;
+}
+#endif
+
 /// @endcond
 
 // ******** THE REST OF THE FILE IS DOCUMENTATION ONLY !***********************
@@ -1800,6 +2140,11 @@ static Ecode_t StartTransfer(DmaMode_t             mode,
 ///   @ref DMADRV_LdmaStartTransfer() @n
 ///    Start a DMA transfer on an LDMA controller.
 ///
+///   @ref DMADRV_MemCopy(), @ref DMADRV_MemSet(), @ref DMADRV_MemWait() @n
+///    Offload a memory copy or fill to a free DMA channel and wait for it.
+///    Operations shorter than the threshold set with
+///    @ref DMADRV_MemSetCpuThreshold() are done by the CPU.
+///
 ///   @ref DMADRV_PauseTransfer() @n
 ///    Pause an ongoing DMA transfer.
 ///
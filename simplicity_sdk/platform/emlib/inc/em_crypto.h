@@ -49,6 +49,9 @@
 #include "em_bus.h"
 #include "sl_common.h"
 #include "em_crypto_compat.h"
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+#include "em_ldma.h"
+#endif
 #include <stdbool.h>
 #include <string.h>
 
@@ -193,6 +196,15 @@ extern "C" {
  *   To optimally load (with regards to speed) and execute an
  *   instruction sequence, use any of the CRYPTO_EXECUTE_X macros (where X is
  *   in the range 1-20) defined in em_crypto.h. E.g. CRYPTO_EXECUTE_19.
+ *
+ *   @n @section crypto_bulk LDMA-fed Bulk AES
+ *   The AES functions above feed every block through the CPU. For large
+ *   buffers, @ref CRYPTO_AES_BulkStart runs ECB, CBC or CTR with a single
+ *   repeating instruction sequence while two LDMA channels feed and drain
+ *   the DATA0 register. The CPU is free during the operation. The
+ *   application calls @ref CRYPTO_AES_BulkIRQHandler from its LDMA interrupt
+ *   handler, which calls the completion callback once all the output is
+ *   written.
  * @{
  ******************************************************************************/
 
@@ -590,6 +602,41 @@ typedef uint8_t CRYPTO_SHA256_Digest_TypeDef[CRYPTO_SHA256_DIGEST_SIZE_IN_BYTES]
  */
 typedef void (*CRYPTO_AES_CtrFuncPtr_TypeDef)(uint8_t * ctr);
 
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/** AES cipher modes supported by the LDMA-fed bulk mode. */
+typedef enum {
+  cryptoAesBulkEcb, /**< Electronic Codebook. */
+  cryptoAesBulkCbc, /**< Cipher-block chaining. */
+  cryptoAesBulkCtr  /**< Counter, 32 bit counter increment. */
+} CRYPTO_AES_BulkMode_TypeDef;
+
+/**
+ * @brief
+ *   LDMA-fed bulk AES completion callback.
+ *
+ * @param[in]  crypto   A pointer to the CRYPTO peripheral register block.
+ * @param[in]  user     User pointer given in the bulk operation.
+ */
+typedef void (*CRYPTO_AES_BulkCallback_TypeDef)(CRYPTO_TypeDef *crypto, void *user);
+
+/** LDMA-fed bulk AES operation. */
+typedef struct {
+  int                             txChannel; /**< LDMA channel feeding CRYPTO. */
+  int                             rxChannel; /**< LDMA channel draining CRYPTO. */
+  CRYPTO_AES_BulkCallback_TypeDef callback;  /**< Completion callback, can be NULL. */
+  void                            *user;     /**< User pointer passed to the callback. */
+
+  /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+  CRYPTO_TypeDef                  *crypto;
+  uint8_t                         *iv;
+  CRYPTO_DataReg_TypeDef          ivReg;
+  volatile bool                   busy;
+  LDMA_Descriptor_t               txDesc;
+  LDMA_Descriptor_t               rxDesc;
+  /** @endcond */
+} CRYPTO_AES_Bulk_TypeDef;
+#endif
+
 /*******************************************************************************
  *****************************   PROTOTYPES   **********************************
  ******************************************************************************/
@@ -1271,6 +1318,36 @@ void CRYPTO_AES_OFB256(CRYPTO_TypeDef *crypto,
                        const uint8_t * key,
                        const uint8_t * iv);
 
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+void CRYPTO_AES_BulkStart(CRYPTO_AES_Bulk_TypeDef *bulk,
+                          CRYPTO_TypeDef *crypto,
+                          CRYPTO_AES_BulkMode_TypeDef mode,
+                          uint32_t * out,
+                          const uint32_t * in,
+                          unsigned int len,
+                          const uint8_t * key,
+                          CRYPTO_KeyWidth_TypeDef keyWidth,
+                          uint8_t * iv,
+                          bool encrypt);
+
+bool CRYPTO_AES_BulkIRQHandler(CRYPTO_AES_Bulk_TypeDef *bulk);
+
+/***************************************************************************//**
+ * @brief
+ *   Check whether an LDMA-fed bulk AES operation is in progress.
+ *
+ * @param[in] bulk
+ *   A pointer to the bulk operation.
+ *
+ * @return
+ *   True while the operation is in progress.
+ ******************************************************************************/
+__STATIC_INLINE bool CRYPTO_AES_BulkBusy(const CRYPTO_AES_Bulk_TypeDef *bulk)
+{
+  return bulk->busy;
+}
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Clear one or more pending CRYPTO interrupts.
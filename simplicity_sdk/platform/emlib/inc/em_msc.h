@@ -318,6 +318,45 @@ typedef struct {
 
 #endif /* #if defined(_MSC_ECCCTRL_MASK) */
 
+#if (_SILICON_LABS_32B_SERIES > 0)
+/** Buffered flash writer configuration. */
+typedef struct {
+  uint32_t *startAddress;   /**< Start of the flash region to write, aligned
+                                 to a flash page. */
+  uint32_t size;            /**< Size of the flash region in bytes, multiple
+                                 of the flash page size. */
+  uint32_t *buffer;         /**< RAM staging buffer of FLASH_PAGE_SIZE bytes. */
+  int dmaChannel;           /**< LDMA channel used to program the flash, or -1
+                                 to program with MSC_WriteWord(). */
+  uint32_t eraseAheadPages; /**< Number of pages MSC_WriterEraseAhead() keeps
+                                 erased ahead of the page being staged. */
+} MSC_WriterInit_TypeDef;
+
+/** Buffered flash writer statistics. Cycle counts are measured with the DWT
+ *  cycle counter and stay 0 when it is not enabled. */
+typedef struct {
+  uint32_t bytesWritten;    /**< Number of bytes programmed, padding included. */
+  uint32_t writeCount;      /**< Number of program operations. */
+  uint32_t writeCycles;     /**< Total cycles spent programming. */
+  uint32_t writeMaxCycles;  /**< Longest program operation in cycles. */
+  uint32_t eraseCount;      /**< Number of pages erased. */
+  uint32_t eraseStalls;     /**< Pages erased on the write path because they
+                                 were not erased ahead. */
+  uint32_t eraseCycles;     /**< Total cycles spent erasing. */
+  uint32_t eraseMaxCycles;  /**< Longest page erase in cycles. */
+} MSC_WriterStats_TypeDef;
+
+/** Buffered flash writer. Members are private, use the MSC_Writer functions. */
+typedef struct {
+  MSC_WriterInit_TypeDef init;    /**< Writer configuration. */
+  uint32_t pageAddress;           /**< Flash page mapped to the staging buffer. */
+  uint32_t fill;                  /**< Bytes staged for the page. */
+  uint32_t flushed;               /**< Bytes of the page already programmed. */
+  uint32_t erasedEnd;             /**< End of the pages erased by the writer. */
+  MSC_WriterStats_TypeDef stats;  /**< Operation statistics. */
+} MSC_Writer_TypeDef;
+#endif
+
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 /* Deprecated type names. */
 #define mscBusStrategy_Typedef MSC_BusStrategy_Typedef
@@ -874,6 +913,16 @@ MSC_Status_TypeDef MSC_WriteWordDma(int ch,
                                     uint32_t *address,
                                     const void *data,
                                     uint32_t numBytes);
+
+MSC_Status_TypeDef MSC_WriterInit(MSC_Writer_TypeDef *writer,
+                                  const MSC_WriterInit_TypeDef *init);
+MSC_Status_TypeDef MSC_WriterAppend(MSC_Writer_TypeDef *writer,
+                                    const void *data,
+                                    uint32_t numBytes);
+MSC_Status_TypeDef MSC_WriterFlush(MSC_Writer_TypeDef *writer);
+MSC_Status_TypeDef MSC_WriterEraseAhead(MSC_Writer_TypeDef *writer);
+void MSC_WriterGetStats(const MSC_Writer_TypeDef *writer,
+                        MSC_WriterStats_TypeDef *stats);
 #endif
 
 void MSC_Init(void);
@@ -72,6 +72,26 @@
 
 #define CRYPTO_AES_BLOCKSIZE                     (16UL)
 
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/* LDMA request signals of the CRYPTO DATA0 register. */
+#if defined(LDMA_CH_REQSEL_SIGSEL_CRYPTO0DATA0WR)
+#define CRYPTO_BULK_SIGNAL_WR                    ldmaPeripheralSignal_CRYPTO0_DATA0WR
+#define CRYPTO_BULK_SIGNAL_RD                    ldmaPeripheralSignal_CRYPTO0_DATA0RD
+#define CRYPTO_BULK_INSTANCE                     CRYPTO0
+#else
+#define CRYPTO_BULK_SIGNAL_WR                    ldmaPeripheralSignal_CRYPTO_DATA0WR
+#define CRYPTO_BULK_SIGNAL_RD                    ldmaPeripheralSignal_CRYPTO_DATA0RD
+#define CRYPTO_BULK_INSTANCE                     CRYPTO
+#endif
+
+/* The instruction sequence runs once per block for the whole buffer, which
+ * is limited by the width of SEQCTRL.LENGTHA and by the word count of a
+ * single LDMA descriptor. */
+#define CRYPTO_BULK_SEQ_MAX_LEN                  (_CRYPTO_SEQCTRL_LENGTHA_MASK & ~(CRYPTO_AES_BLOCKSIZE - 1UL))
+#define CRYPTO_BULK_LDMA_MAX_LEN                 (LDMA_DESCRIPTOR_MAX_XFER_SIZE * 4UL)
+#define CRYPTO_BULK_MAX_LEN                      SL_MIN(CRYPTO_BULK_SEQ_MAX_LEN, CRYPTO_BULK_LDMA_MAX_LEN)
+#endif
+
 /*******************************************************************************
  ***********************   STATIC FUNCTIONS   **********************************
  ******************************************************************************/
@@ -2367,6 +2387,208 @@ __STATIC_INLINE void CRYPTO_AES_ProcessLoop(CRYPTO_TypeDef *        crypto,
   }
 }
 
+#if defined(LDMA_PRESENT) && (LDMA_COUNT == 1)
+/***************************************************************************//**
+ * @brief
+ *   Start an LDMA-fed bulk AES operation.
+ *
+ * @details
+ *   Loads the key and IV, then starts a single instruction sequence that
+ *   repeats for every block of the buffer. Each iteration takes its input
+ *   block from DATA0 through the LDMA transmit channel and hands the result
+ *   back in DATA0 to the LDMA receive channel. The function returns as soon
+ *   as the operation is started.
+ *
+ *   The operation is complete when @ref CRYPTO_AES_BulkIRQHandler returns
+ *   true or when @ref CRYPTO_AES_BulkBusy returns false. The CRYPTO module and
+ *   the two LDMA channels must not be used for anything else meanwhile.
+ *
+ *   See general comments on layout and byte ordering of parameters.
+ *
+ * @note
+ *   LDMA must be initialized with LDMA_Init() beforehand. The bulk operation
+ *   pays off for buffers of a few blocks and more; small buffers are faster
+ *   with the CPU-fed functions.
+ *
+ * @param[in,out] bulk
+ *   A pointer to the bulk operation. The channels, callback and user pointer
+ *   must be set. Must stay allocated until the operation completes.
+ *
+ * @param[in] crypto
+ *   A pointer to the CRYPTO peripheral register block.
+ *
+ * @param[in] mode
+ *   The cipher mode.
+ *
+ * @param[out] out
+ *   A word aligned buffer to place encrypted/decrypted data. Must be at least
+ *   @p len long. It may be set equal to @p in.
+ *
+ * @param[in] in
+ *   A word aligned buffer holding data to encrypt/decrypt. Must be at least
+ *   @p len long.
+ *
+ * @param[in] len
+ *   A number of bytes to encrypt/decrypt. Must be a multiple of 16 and fit
+ *   in both a single LDMA descriptor and SEQCTRL.LENGTHA.
+ *
+ * @param[in] key
+ *   The encryption or decryption key, see CRYPTO_AES_ECB128(). If this
+ *   argument is null, the key will not be loaded, as it is assumed the key
+ *   has been loaded into KEYHA previously.
+ *
+ * @param[in] keyWidth
+ *   Set to cryptoKey128Bits or cryptoKey256Bits.
+ *
+ * @param[in,out] iv
+ *   128 bit initialization vector for CBC or initial counter for CTR, updated
+ *   on completion. Must stay allocated until the operation completes. Unused
+ *   for ECB.
+ *
+ * @param[in] encrypt
+ *   Set to true to encrypt, false to decrypt. Unused for CTR.
+ ******************************************************************************/
+void CRYPTO_AES_BulkStart(CRYPTO_AES_Bulk_TypeDef *bulk,
+                          CRYPTO_TypeDef *crypto,
+                          CRYPTO_AES_BulkMode_TypeDef mode,
+                          uint32_t * out,
+                          const uint32_t * in,
+                          unsigned int len,
+                          const uint8_t * key,
+                          CRYPTO_KeyWidth_TypeDef keyWidth,
+                          uint8_t * iv,
+                          bool encrypt)
+{
+  LDMA_TransferCfg_t txCfg = LDMA_TRANSFER_CFG_PERIPHERAL(CRYPTO_BULK_SIGNAL_WR);
+  LDMA_TransferCfg_t rxCfg = LDMA_TRANSFER_CFG_PERIPHERAL(CRYPTO_BULK_SIGNAL_RD);
+  LDMA_Descriptor_t txDesc = LDMA_DESCRIPTOR_SINGLE_M2P_BYTE(in, &crypto->DATA0, len / 4U);
+  LDMA_Descriptor_t rxDesc = LDMA_DESCRIPTOR_SINGLE_P2M_BYTE(&crypto->DATA0, out, len / 4U);
+
+  EFM_ASSERT(crypto == CRYPTO_BULK_INSTANCE);
+  EFM_ASSERT(!bulk->busy);
+  EFM_ASSERT((len % CRYPTO_AES_BLOCKSIZE) == 0U);
+  EFM_ASSERT((len > 0U) && (len <= CRYPTO_BULK_MAX_LEN));
+  EFM_ASSERT((((uintptr_t)in & 0x3U) == 0U) && (((uintptr_t)out & 0x3U) == 0U));
+
+  /* Move whole 128 bit blocks, one block per CRYPTO request. */
+  txDesc.xfer.size      = ldmaCtrlSizeWord;
+  txDesc.xfer.blockSize = ldmaCtrlBlockSizeUnit4;
+  txDesc.xfer.doneIfs   = 0;
+  rxDesc.xfer.size      = ldmaCtrlSizeWord;
+  rxDesc.xfer.blockSize = ldmaCtrlBlockSizeUnit4;
+  bulk->txDesc = txDesc;
+  bulk->rxDesc = rxDesc;
+
+  bulk->crypto = crypto;
+  bulk->iv     = iv;
+  bulk->ivReg  = NULL;
+  bulk->busy   = true;
+
+  crypto->CTRL = ((keyWidth == cryptoKey256Bits) ? CRYPTO_CTRL_AES_AES256 : CRYPTO_CTRL_AES_AES128)
+                 | CRYPTO_CTRL_DMA0RSEL_DATA0 | CRYPTO_CTRL_DMA0MODE_FULL;
+  crypto->WAC = 0;
+
+  CRYPTO_KeyBufWriteUnaligned(crypto, key, keyWidth);
+
+  switch (mode) {
+    case cryptoAesBulkCbc:
+      /* DATA2 holds the previous ciphertext block. */
+      CRYPTO_DataWriteUnaligned(&crypto->DATA2, iv);
+      bulk->ivReg = &crypto->DATA2;
+      if (encrypt) {
+        CRYPTO_SEQ_LOAD_5(crypto,
+                          CRYPTO_CMD_INSTR_DMA0TODATA,
+                          CRYPTO_CMD_INSTR_DATA2TODATA0XOR,
+                          CRYPTO_CMD_INSTR_AESENC,
+                          CRYPTO_CMD_INSTR_DATA0TODATA2,
+                          CRYPTO_CMD_INSTR_DATATODMA0);
+      } else {
+        CRYPTO_SEQ_LOAD_6(crypto,
+                          CRYPTO_CMD_INSTR_DMA0TODATA,
+                          CRYPTO_CMD_INSTR_DATA0TODATA1,
+                          CRYPTO_CMD_INSTR_AESDEC,
+                          CRYPTO_CMD_INSTR_DATA2TODATA0XOR,
+                          CRYPTO_CMD_INSTR_DATA1TODATA2,
+                          CRYPTO_CMD_INSTR_DATATODMA0);
+      }
+      break;
+
+    case cryptoAesBulkCtr:
+      /* DATA1 holds the counter, DATA2 the input block. */
+      crypto->CTRL |= CRYPTO_CTRL_INCWIDTH_INCWIDTH4;
+      CRYPTO_DataWriteUnaligned(&crypto->DATA1, iv);
+      bulk->ivReg = &crypto->DATA1;
+      CRYPTO_SEQ_LOAD_7(crypto,
+                        CRYPTO_CMD_INSTR_DMA0TODATA,
+                        CRYPTO_CMD_INSTR_DATA0TODATA2,
+                        CRYPTO_CMD_INSTR_DATA1TODATA0,
+                        CRYPTO_CMD_INSTR_AESENC,
+                        CRYPTO_CMD_INSTR_DATA1INC,
+                        CRYPTO_CMD_INSTR_DATA2TODATA0XOR,
+                        CRYPTO_CMD_INSTR_DATATODMA0);
+      break;
+
+    case cryptoAesBulkEcb:
+    default:
+      if (encrypt) {
+        CRYPTO_SEQ_LOAD_3(crypto,
+                          CRYPTO_CMD_INSTR_DMA0TODATA,
+                          CRYPTO_CMD_INSTR_AESENC,
+                          CRYPTO_CMD_INSTR_DATATODMA0);
+      } else {
+        CRYPTO_SEQ_LOAD_3(crypto,
+                          CRYPTO_CMD_INSTR_DMA0TODATA,
+                          CRYPTO_CMD_INSTR_AESDEC,
+                          CRYPTO_CMD_INSTR_DATATODMA0);
+      }
+      break;
+  }
+
+  /* Run the sequence once per block for the whole buffer. */
+  crypto->SEQCTRL = CRYPTO_SEQCTRL_BLOCKSIZE_16BYTES | len;
+
+  LDMA_StartTransfer(bulk->rxChannel, &rxCfg, &bulk->rxDesc);
+  LDMA_StartTransfer(bulk->txChannel, &txCfg, &bulk->txDesc);
+
+  CRYPTO_InstructionSequenceExecute(crypto);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Complete an LDMA-fed bulk AES operation.
+ *
+ * @details
+ *   Must be called from the application's LDMA interrupt handler. When the
+ *   receive channel is done, the IV or counter is updated, the operation is
+ *   marked as complete and the callback is called.
+ *
+ * @param[in,out] bulk
+ *   A pointer to the bulk operation.
+ *
+ * @return
+ *   True if the operation completed in this call.
+ ******************************************************************************/
+bool CRYPTO_AES_BulkIRQHandler(CRYPTO_AES_Bulk_TypeDef *bulk)
+{
+  if (!bulk->busy || !LDMA_TransferDone(bulk->rxChannel)) {
+    return false;
+  }
+
+  CRYPTO_InstructionSequenceWait(bulk->crypto);
+  if (bulk->ivReg != NULL) {
+    CRYPTO_DataReadUnaligned(bulk->ivReg, bulk->iv);
+  }
+  bulk->crypto->CTRL &= ~(_CRYPTO_CTRL_DMA0RSEL_MASK | _CRYPTO_CTRL_DMA0MODE_MASK);
+  bulk->busy = false;
+
+  if (bulk->callback != NULL) {
+    bulk->callback(bulk->crypto, bulk->user);
+  }
+
+  return true;
+}
+#endif /* defined(LDMA_PRESENT) && (LDMA_COUNT == 1) */
+
 /** @} (end addtogroup crypto) */
 
 #endif /* defined(CRYPTO_COUNT) && (CRYPTO_COUNT > 0) */
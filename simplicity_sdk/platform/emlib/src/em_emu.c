@@ -41,6 +41,15 @@
 #include "em_system.h"
 #include "em_ramfunc.h"
 
+#if defined(SL_COMPONENT_CATALOG_PRESENT)
+#include "sl_component_catalog.h"
+#endif
+
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+#include "sl_clock_manager.h"
+#include "sli_clock_manager.h"
+#endif
+
 #if defined(SL_CATALOG_METRIC_EM23_WAKE_PRESENT)
 #include "sli_metric_em23_wake.h"
 #include "sli_metric_em23_wake_config.h"
@@ -759,6 +768,10 @@ static void dpllState(dpllState_TypeDef action)
         /* Relock DPLL and exit without waiting for ready. */
         DPLL0->EN_SET = DPLL_EN_EN;
       }
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+      /* The cached clock branch frequencies may have been decoded without the DPLL. */
+      sli_clock_manager_invalidate_clock_branch_cache();
+#endif
     }
   }
 }
@@ -1098,6 +1111,10 @@ void EMU_EnterEM2(bool restore)
     /* core clock variable must be updated since HF clock has changed */
     /* to HFRCO. */
     SystemCoreClockUpdate();
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+    /* The cached clock branch frequencies were decoded from the original clock. */
+    sl_clock_manager_notify_clock_tree_change();
+#endif
   }
 }
 
@@ -1310,6 +1327,10 @@ void EMU_EnterEM3(bool restore)
     /* core clock variable must be updated since HF clock has changed */
     /* to HFRCO. */
     SystemCoreClockUpdate();
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+    /* The cached clock branch frequencies were decoded from the original clock. */
+    sl_clock_manager_notify_clock_tree_change();
+#endif
   }
 }
 
@@ -36,6 +36,7 @@
 #include "sl_common.h"
 #include "em_core.h"
 #include "em_system.h"
+#include <string.h>
 
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 
@@ -64,6 +65,11 @@
 
 #define FLASH_PAGE_MASK (~(FLASH_PAGE_SIZE - 1U))
 
+/* Flash writer programming granularity. Flash is programmed in 64-bit
+ * double-words that can only be written twice between erases, so partial
+ * flushes are aligned to double-words. */
+#define MSC_WRITER_ALIGN  (8U)
+
 #if defined(_MSC_ECCCTRL_MASK)          \
   || defined(_SYSCFG_DMEM0ECCCTRL_MASK) \
   || defined(_MPAHBRAM_CTRL_MASK)
@@ -2078,5 +2084,277 @@ MSC_PortPriority_TypeDef MSC_PortGetCurrentPriority(void)
 }
 #endif /* if defined(_MPAHBRAM_CTRL_AHBPORTPRIORITY_MASK) */
 
+#if (_SILICON_LABS_32B_SERIES > 0)
+/** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
+
+/***************************************************************************//**
+ * @brief
+ *   Read the DWT cycle counter, 0 when it is not enabled.
+ ******************************************************************************/
+static uint32_t writerCycles(void)
+{
+  if ((DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk) == 0U) {
+    return 0U;
+  }
+  return DWT->CYCCNT;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Erase the page following the pages already erased by the writer.
+ ******************************************************************************/
+static MSC_Status_TypeDef writerErasePage(MSC_Writer_TypeDef *writer)
+{
+  MSC_Status_TypeDef retVal;
+  uint32_t cycles = writerCycles();
+
+  retVal = MSC_ErasePage((uint32_t *)writer->erasedEnd);
+  cycles = writerCycles() - cycles;
+
+  if (retVal == mscReturnOk) {
+    writer->erasedEnd += FLASH_PAGE_SIZE;
+    writer->stats.eraseCount++;
+    writer->stats.eraseCycles += cycles;
+    writer->stats.eraseMaxCycles = SL_MAX(writer->stats.eraseMaxCycles, cycles);
+  }
+
+  return retVal;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Program the staged bytes of the current page from the last flushed
+ *   double-word up to end.
+ ******************************************************************************/
+static MSC_Status_TypeDef writerProgram(MSC_Writer_TypeDef *writer,
+                                        uint32_t end)
+{
+  MSC_Status_TypeDef retVal;
+  uint32_t start = writer->flushed & ~(MSC_WRITER_ALIGN - 1U);
+  uint32_t cycles;
+
+  // The page must be erased before programming, erase it now if
+  // MSC_WriterEraseAhead() did not get to it.
+  while (writer->erasedEnd <= writer->pageAddress) {
+    writer->stats.eraseStalls++;
+    retVal = writerErasePage(writer);
+    if (retVal != mscReturnOk) {
+      return retVal;
+    }
+  }
+
+  cycles = writerCycles();
+  if (writer->init.dmaChannel >= 0) {
+    retVal = MSC_WriteWordDma(writer->init.dmaChannel,
+                              (uint32_t *)(writer->pageAddress + start),
+                              (const uint8_t *)writer->init.buffer + start,
+                              end - start);
+  } else {
+    retVal = MSC_WriteWord((uint32_t *)(writer->pageAddress + start),
+                           (const uint8_t *)writer->init.buffer + start,
+                           end - start);
+  }
+  cycles = writerCycles() - cycles;
+
+  if (retVal == mscReturnOk) {
+    writer->flushed = writer->fill;
+    writer->stats.bytesWritten += end - start;
+    writer->stats.writeCount++;
+    writer->stats.writeCycles += cycles;
+    writer->stats.writeMaxCycles = SL_MAX(writer->stats.writeMaxCycles, cycles);
+  }
+
+  return retVal;
+}
+
+/** @endcond */
+
+/***************************************************************************//**
+ * @brief
+ *   Initialize a buffered flash writer.
+ *
+ * @details
+ *   The writer stages appended data in a RAM buffer of one flash page and
+ *   programs the flash one full page at a time, using the LDMA when a channel
+ *   is configured. Pages of the region are erased by the writer before being
+ *   programmed. Calling MSC_WriterEraseAhead() when the application has time
+ *   to spare, for example from its idle loop, erases the upcoming pages in
+ *   advance so that appends do not stall for a page erase.
+ *
+ * @note
+ *   Flash reads, including instruction fetches, are stalled while a page is
+ *   erased or programmed. The writer does not make erases asynchronous, it
+ *   moves them out of the write path.
+ *
+ * @param[out] writer
+ *   Writer to initialize.
+ * @param[in] init
+ *   Writer configuration. The staging buffer must stay allocated while the
+ *   writer is used.
+ * @return
+ *   mscReturnOk, or mscReturnUnaligned if the region or buffer is not
+ *   correctly aligned.
+ ******************************************************************************/
+MSC_Status_TypeDef MSC_WriterInit(MSC_Writer_TypeDef *writer,
+                                  const MSC_WriterInit_TypeDef *init)
+{
+  EFM_ASSERT((writer != NULL) && (init != NULL) && (init->buffer != NULL));
+  EFM_ASSERT(init->dmaChannel < (int)DMA_CHAN_COUNT);
+
+  if ((((uint32_t)init->startAddress & (FLASH_PAGE_SIZE - 1U)) != 0U)
+      || ((init->size & (FLASH_PAGE_SIZE - 1U)) != 0U)
+      || (((uint32_t)init->buffer & 0x3U) != 0U)) {
+    return mscReturnUnaligned;
+  }
+
+  memset(writer, 0, sizeof(*writer));
+  writer->init = *init;
+  writer->pageAddress = (uint32_t)init->startAddress;
+  writer->erasedEnd = (uint32_t)init->startAddress;
+  // Unstaged bytes are programmed as erased flash when padding a flush.
+  memset(init->buffer, 0xFF, FLASH_PAGE_SIZE);
+
+  return mscReturnOk;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Append data to a buffered flash writer.
+ *
+ * @details
+ *   Data is copied to the staging buffer and a page is programmed each time
+ *   the buffer fills up. Data can be of any size and alignment.
+ *
+ * @param[in] writer
+ *   Initialized writer.
+ * @param[in] data
+ *   Data to append.
+ * @param[in] numBytes
+ *   Number of bytes to append.
+ * @return
+ *   mscReturnOk, mscReturnInvalidAddr if the data does not fit in the
+ *   region, or the status of the failed erase or write operation.
+ ******************************************************************************/
+MSC_Status_TypeDef MSC_WriterAppend(MSC_Writer_TypeDef *writer,
+                                    const void *data,
+                                    uint32_t numBytes)
+{
+  MSC_Status_TypeDef retVal;
+  const uint8_t *pData = (const uint8_t *)data;
+  uint32_t regionEnd = (uint32_t)writer->init.startAddress + writer->init.size;
+  uint32_t chunk;
+
+  while (numBytes) {
+    if (writer->pageAddress >= regionEnd) {
+      return mscReturnInvalidAddr;
+    }
+
+    chunk = SL_MIN(numBytes, FLASH_PAGE_SIZE - writer->fill);
+    memcpy((uint8_t *)writer->init.buffer + writer->fill, pData, chunk);
+    writer->fill += chunk;
+    pData        += chunk;
+    numBytes     -= chunk;
+
+    if (writer->fill == FLASH_PAGE_SIZE) {
+      retVal = writerProgram(writer, FLASH_PAGE_SIZE);
+      if (retVal != mscReturnOk) {
+        return retVal;
+      }
+      writer->pageAddress += FLASH_PAGE_SIZE;
+      writer->fill = 0;
+      writer->flushed = 0;
+      memset(writer->init.buffer, 0xFF, FLASH_PAGE_SIZE);
+    }
+  }
+
+  return mscReturnOk;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Program the data staged in a buffered flash writer.
+ *
+ * @details
+ *   The last double-word is padded with erased bytes and programmed again
+ *   when completed. As a flash double-word can only be programmed twice
+ *   between erases, a partially filled double-word is flushed only once.
+ *   A double-word already flushed partially is programmed again only once
+ *   appended data completes it.
+ *
+ * @param[in] writer
+ *   Initialized writer.
+ * @return
+ *   mscReturnOk, mscReturnUnaligned if the data staged since the last flush
+ *   does not complete the double-word that flush left partially filled, or
+ *   the status of the failed erase or write operation. Nothing is programmed
+ *   when mscReturnUnaligned is returned, the data stays staged.
+ ******************************************************************************/
+MSC_Status_TypeDef MSC_WriterFlush(MSC_Writer_TypeDef *writer)
+{
+  uint32_t end = SL_CEILING(writer->fill, MSC_WRITER_ALIGN);
+
+  if (writer->fill == writer->flushed) {
+    return mscReturnOk;
+  }
+
+  // An unaligned flushed offset means that its double-word was programmed
+  // partially. Programming it again while still partial would leave a
+  // third program to complete it.
+  if (((writer->flushed & (MSC_WRITER_ALIGN - 1U)) != 0U)
+      && (end == SL_CEILING(writer->flushed, MSC_WRITER_ALIGN))
+      && ((writer->fill & (MSC_WRITER_ALIGN - 1U)) != 0U)) {
+    return mscReturnUnaligned;
+  }
+
+  return writerProgram(writer, end);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Erase one upcoming page of a buffered flash writer.
+ *
+ * @details
+ *   Erases the next page not yet erased when fewer than eraseAheadPages pages
+ *   are erased past the page being staged. A single page is erased per call
+ *   to bound the time spent in the function.
+ *
+ * @param[in] writer
+ *   Initialized writer.
+ * @return
+ *   mscReturnOk or the status of the failed erase operation.
+ ******************************************************************************/
+MSC_Status_TypeDef MSC_WriterEraseAhead(MSC_Writer_TypeDef *writer)
+{
+  uint32_t regionEnd = (uint32_t)writer->init.startAddress + writer->init.size;
+  uint32_t target = writer->pageAddress
+                    + ((writer->init.eraseAheadPages + 1U) * FLASH_PAGE_SIZE);
+
+  if (writer->erasedEnd >= SL_MIN(target, regionEnd)) {
+    return mscReturnOk;
+  }
+
+  return writerErasePage(writer);
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Get the statistics of a buffered flash writer.
+ *
+ * @details
+ *   The average throughput is bytesWritten / writeCycles times the core
+ *   clock frequency.
+ *
+ * @param[in] writer
+ *   Initialized writer.
+ * @param[out] stats
+ *   Writer statistics.
+ ******************************************************************************/
+void MSC_WriterGetStats(const MSC_Writer_TypeDef *writer,
+                        MSC_WriterStats_TypeDef *stats)
+{
+  *stats = writer->stats;
+}
+#endif /* (_SILICON_LABS_32B_SERIES > 0) */
+
 /** @} (end addtogroup msc) */
 #endif /* defined(MSC_COUNT) && (MSC_COUNT > 0) */
@@ -42,6 +42,9 @@ extern "C" {
 #include "sl_assert.h"
 #include <stdbool.h>
 #include "sl_enum.h"
+#if defined(LDMA_PRESENT)
+#include "sl_hal_ldma.h"
+#endif
 
 /***************************************************************************//**
  * @addtogroup eusart EUSART - Enhanced USART
@@ -70,6 +73,15 @@ extern "C" {
 #define SL_HAL_EUSART_PRS_SUPPORTED
 #endif
 
+#if defined(LDMA_PRESENT) && defined(_EUSART_CFG1_RXTIMEOUT_MASK)
+#define SL_HAL_EUSART_BUFFERED_SUPPORTED
+#endif
+
+#if defined(SL_HAL_EUSART_BUFFERED_SUPPORTED)
+/// Number of buffers the buffered UART transmit queue can hold.
+#define SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE    4
+#endif
+
 // Define EUSART FIFO Depth information
 #if !defined(EUSART_FIFO_DEPTH)
 #if defined(EUART_PRESENT)
@@ -630,6 +642,95 @@ typedef struct {
 } sl_hal_eusart_spi_config_t;
 #endif
 
+#if defined(SL_HAL_EUSART_BUFFERED_SUPPORTED)
+/***************************************************************************//**
+ * @brief
+ *   Buffered UART receive callback.
+ *
+ * @details
+ *   Called from interrupt context when half of the receive ring is filled or
+ *   when the line went idle for the configured receive timeout.
+ *
+ * @param[in] available
+ *   Number of bytes ready to be read with sl_hal_eusart_buffered_read().
+ *
+ * @param[in] user_data
+ *   User data passed in the configuration.
+ ******************************************************************************/
+typedef void (*sl_hal_eusart_buffered_rx_callback_t)(uint32_t available,
+                                                     void *user_data);
+
+/***************************************************************************//**
+ * @brief
+ *   Buffered UART transmit callback.
+ *
+ * @details
+ *   Called from the LDMA interrupt when a queued buffer has been moved to the
+ *   transmit FIFO and can be reused.
+ *
+ * @param[in] buffer
+ *   Buffer passed to sl_hal_eusart_buffered_write().
+ *
+ * @param[in] length
+ *   Length of the buffer.
+ *
+ * @param[in] user_data
+ *   User data passed in the configuration.
+ ******************************************************************************/
+typedef void (*sl_hal_eusart_buffered_tx_callback_t)(const uint8_t *buffer,
+                                                     uint32_t length,
+                                                     void *user_data);
+
+/// Buffered UART configuration structure.
+typedef struct {
+  LDMA_TypeDef                         *ldma;             ///< LDMA instance.
+  uint32_t                             rx_channel;        ///< LDMA channel filling the receive ring.
+  uint32_t                             tx_channel;        ///< LDMA channel feeding the transmit FIFO.
+  uint32_t                             rx_signal;         ///< LDMA request of the RX FIFO level, e.g. SL_HAL_LDMA_PERIPHERAL_SIGNAL_EUSART0_RXFL.
+  uint32_t                             tx_signal;         ///< LDMA request of the TX FIFO level, e.g. SL_HAL_LDMA_PERIPHERAL_SIGNAL_EUSART0_TXFL.
+  uint8_t                              *rx_buffer;        ///< Receive ring buffer.
+  uint32_t                             rx_buffer_size;    ///< Receive ring size in bytes, even and at most 2 * SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE.
+  uint8_t                              rx_timeout_frames; ///< Idle frames before a receive timeout, 1 to 7, 0 to disable.
+  sl_hal_eusart_buffered_rx_callback_t rx_callback;       ///< Receive callback, can be NULL.
+  sl_hal_eusart_buffered_tx_callback_t tx_callback;       ///< Transmit callback, can be NULL.
+  void                                 *user_data;        ///< Passed to the callbacks.
+  uint32_t                             (*get_ticks)(void); ///< Free running tick source for the latency counters, can be NULL.
+} sl_hal_eusart_buffered_config_t;
+
+/// Buffered UART counters.
+typedef struct {
+  uint32_t rx_bytes;              ///< Bytes read by the application.
+  uint32_t rx_overruns;           ///< Times unread data was overwritten in the receive ring.
+  uint32_t rx_fifo_overflows;     ///< Receive FIFO overflows.
+  uint32_t rx_timeouts;           ///< Receive timeouts, idle line detected.
+  uint32_t rx_latency_total;      ///< Sum of ticks from receive callback to the read draining the ring.
+  uint32_t rx_latency_max;        ///< Longest receive latency in ticks.
+  uint32_t tx_buffers;            ///< Buffers transmitted.
+  uint32_t tx_bytes;              ///< Bytes transmitted.
+  uint32_t tx_latency_total;      ///< Sum of ticks from write to buffer completion.
+  uint32_t tx_latency_max;        ///< Longest transmit latency in ticks.
+} sl_hal_eusart_buffered_stats_t;
+
+/// Buffered UART state structure.
+typedef struct {
+  EUSART_TypeDef                  *eusart;                                            ///< EUSART instance.
+  sl_hal_eusart_buffered_config_t config;                                             ///< Configuration.
+  sl_hal_ldma_descriptor_t        rx_descriptors[2];                                  ///< Receive ring descriptors, one per half.
+  sl_hal_ldma_descriptor_t        tx_descriptors[SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE]; ///< Transmit queue descriptors.
+  const uint8_t                   *tx_buffers[SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE];    ///< Queued transmit buffers.
+  uint32_t                        tx_lengths[SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE];     ///< Queued transmit lengths.
+  uint32_t                        tx_ticks[SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE];       ///< Tick count when each buffer was queued.
+  uint32_t                        tx_head;                                            ///< Oldest queued buffer.
+  uint32_t                        tx_launched;                                        ///< First buffer not handed to the LDMA.
+  uint32_t                        tx_tail;                                            ///< Next free queue entry.
+  volatile uint32_t               rx_blocks;                                          ///< Completed halves of the receive ring.
+  uint32_t                        rx_read;                                            ///< Bytes consumed from the receive ring.
+  volatile uint32_t               rx_notify_ticks;                                    ///< Tick count of the oldest unread receive callback.
+  volatile bool                   rx_notified;                                        ///< A receive callback is waiting for a read.
+  sl_hal_eusart_buffered_stats_t  stats;                                              ///< Counters.
+} sl_hal_eusart_buffered_t;
+#endif
+
 /// Default configuration for EUSART initialization structure in UART mode with high-frequency clock.
 #define SL_HAL_EUSART_UART_INIT_DEFAULT_HF                                 \
   {                                                                        \
@@ -1139,6 +1240,133 @@ void sl_hal_eusart_enable_tx_prs_trigger(EUSART_TypeDef *eusart,
 void sl_hal_eusart_disable_tx_prs_trigger(EUSART_TypeDef *eusart);
 #endif // defined(SL_HAL_EUSART_PRS_SUPPORTED)
 
+#if defined(SL_HAL_EUSART_BUFFERED_SUPPORTED)
+/***************************************************************************//**
+ * @brief
+ *   Initialize buffered UART operation.
+ *
+ * @details
+ *   Reception runs continuously: two linked LDMA descriptors fill the halves
+ *   of the receive ring and the receive timeout flushes partial data to the
+ *   application. Transmission is fed from a queue of buffers, chained with
+ *   linked LDMA descriptors.
+ *
+ * @note
+ *   Call after initializing the EUSART in UART mode and before enabling it,
+ *   the receive timeout can only be configured while the EUSART is disabled.
+ *   The LDMA must be initialized with sl_hal_ldma_init().
+ *   sl_hal_eusart_buffered_ldma_irq_handler() must be called from the LDMA
+ *   interrupt handler and sl_hal_eusart_buffered_irq_handler() from the
+ *   EUSART receive interrupt handler.
+ *
+ * @param[in] eusart
+ *   Pointer to the EUSART peripheral register block.
+ *
+ * @param[out] buffered
+ *   Buffered UART state. Must stay valid while the driver runs.
+ *
+ * @param[in] config
+ *   Configuration.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_init(EUSART_TypeDef *eusart,
+                                 sl_hal_eusart_buffered_t *buffered,
+                                 const sl_hal_eusart_buffered_config_t *config);
+
+/***************************************************************************//**
+ * @brief
+ *   Start continuous reception into the receive ring.
+ *
+ * @param[in] buffered
+ *   Buffered UART state.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_start(sl_hal_eusart_buffered_t *buffered);
+
+/***************************************************************************//**
+ * @brief
+ *   Stop reception and transmission.
+ *
+ * @note
+ *   Queued transmit buffers are dropped without calling the transmit callback.
+ *
+ * @param[in] buffered
+ *   Buffered UART state.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_stop(sl_hal_eusart_buffered_t *buffered);
+
+/***************************************************************************//**
+ * @brief
+ *   Read received data from the receive ring.
+ *
+ * @details
+ *   If the LDMA overwrote data that was not read yet, the unread data is
+ *   discarded, an overrun is counted and 0 is returned.
+ *
+ * @param[in] buffered
+ *   Buffered UART state.
+ *
+ * @param[out] data
+ *   Destination buffer.
+ *
+ * @param[in] max_length
+ *   Size of the destination buffer.
+ *
+ * @return
+ *   Number of bytes copied.
+ ******************************************************************************/
+uint32_t sl_hal_eusart_buffered_read(sl_hal_eusart_buffered_t *buffered,
+                                     uint8_t *data,
+                                     uint32_t max_length);
+
+/***************************************************************************//**
+ * @brief
+ *   Queue a buffer for transmission.
+ *
+ * @details
+ *   The buffer is transmitted by the LDMA without CPU involvement and must
+ *   not be modified until the transmit callback reports it.
+ *
+ * @param[in] buffered
+ *   Buffered UART state.
+ *
+ * @param[in] data
+ *   Data to transmit.
+ *
+ * @param[in] length
+ *   Number of bytes, 1 to SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE.
+ *
+ * @return
+ *   True if the buffer was queued, false if the queue is full.
+ ******************************************************************************/
+bool sl_hal_eusart_buffered_write(sl_hal_eusart_buffered_t *buffered,
+                                  const uint8_t *data,
+                                  uint32_t length);
+
+/***************************************************************************//**
+ * @brief
+ *   Buffered UART LDMA interrupt handler.
+ *
+ * @details
+ *   Handles the receive ring and transmit queue channel flags. Does nothing
+ *   for other channels.
+ *
+ * @param[in] buffered
+ *   Buffered UART state.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_ldma_irq_handler(sl_hal_eusart_buffered_t *buffered);
+
+/***************************************************************************//**
+ * @brief
+ *   Buffered UART EUSART interrupt handler.
+ *
+ * @details
+ *   Handles the receive timeout and receive FIFO overflow flags.
+ *
+ * @param[in] buffered
+ *   Buffered UART state.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_irq_handler(sl_hal_eusart_buffered_t *buffered);
+#endif // defined(SL_HAL_EUSART_BUFFERED_SUPPORTED)
+
 #if defined(_EUSART_CFG0_SYNC_MASK)
 /***************************************************************************//**
  * @brief
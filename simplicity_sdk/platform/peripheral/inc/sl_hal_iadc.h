@@ -37,6 +37,9 @@
 #if defined(IADC_COUNT) && (IADC_COUNT > 0)
 
 #include <stdbool.h>
+#if defined(LDMA_PRESENT) && defined(LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN)
+#include "sl_hal_ldma.h"
+#endif
 
 #ifdef __cplusplus
 extern "C" {
@@ -420,6 +423,54 @@ typedef struct {
   uint8_t  id;     ///< ID of FIFO entry; Scan table entry id or single indicator (0x20).
 } sl_hal_iadc_result_t;
 
+#if defined(LDMA_PRESENT) && defined(LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN)
+/***************************************************************************//**
+ * @brief
+ *   IADC scan stream block callback.
+ *
+ * @param[in] block
+ *   Raw scan FIFO words of the completed block, frame_count * frame_size words.
+ *
+ * @param[in] frame_count
+ *   Number of scan frames in the block.
+ *
+ * @param[in] overrun
+ *   True if data was lost since the previous block, either because the LDMA
+ *   overwrote a block that was not released yet or because the scan FIFO
+ *   overflowed.
+ *
+ * @param[in] user_data
+ *   User data passed in the stream configuration.
+ ******************************************************************************/
+typedef void (*sl_hal_iadc_stream_callback_t)(const uint32_t *block,
+                                              uint32_t frame_count,
+                                              bool overrun,
+                                              void *user_data);
+
+/// IADC scan stream configuration structure.
+typedef struct {
+  LDMA_TypeDef                  *ldma;            ///< LDMA instance draining the scan FIFO.
+  uint32_t                      channel;          ///< LDMA channel.
+  uint32_t                      *buffer;          ///< Ring buffer, 2 * frames_per_block * frame_size words.
+  uint32_t                      frame_size;       ///< Samples per scan frame, the number of enabled scan table entries.
+  uint32_t                      frames_per_block; ///< Scan frames per half of the ring buffer.
+  sl_hal_iadc_stream_callback_t callback;         ///< Called from the LDMA interrupt for every completed block.
+  void                          *user_data;       ///< Passed to the callback.
+} sl_hal_iadc_stream_config_t;
+
+/// IADC scan stream state structure.
+typedef struct {
+  IADC_TypeDef                *iadc;            ///< IADC instance.
+  sl_hal_iadc_stream_config_t config;           ///< Stream configuration.
+  sl_hal_ldma_descriptor_t    descriptors[2];   ///< Ring descriptors, one per half of the buffer.
+  uint32_t                    next_block;       ///< Half of the buffer the LDMA completes next.
+  volatile uint32_t           held;             ///< Blocks handed to the application and not released.
+  volatile uint32_t           blocks;           ///< Completed blocks.
+  volatile uint32_t           overruns;         ///< Blocks overwritten before they were released.
+  volatile uint32_t           fifo_overflows;   ///< Scan FIFO overflows.
+} sl_hal_iadc_stream_t;
+#endif
+
 // Default IADC config for scan table.
 #define SL_HAL_IADC_SCANTABLE_DEFAULT     \
   {                                       \
@@ -922,6 +973,109 @@ sl_hal_iadc_result_t sl_hal_iadc_pull_scan_fifo_result(IADC_TypeDef *iadc);
  ******************************************************************************/
 uint32_t sl_hal_iadc_get_reference_voltage(sl_hal_iadc_voltage_reference_t reference);
 
+/***************************************************************************//**
+ * @brief
+ *   Convert a block of raw FIFO words to results.
+ *
+ * @details
+ *   Equivalent to converting every word the way
+ *   sl_hal_iadc_pull_scan_fifo_result() does, but the alignment is decoded
+ *   once for the whole block instead of once per sample.
+ *
+ * @param[in] raw_data
+ *   Raw FIFO words, e.g. a block delivered by the scan stream.
+ *
+ * @param[out] results
+ *   Converted results, count entries.
+ *
+ * @param[in] count
+ *   Number of words to convert.
+ *
+ * @param[in] alignment
+ *   Alignment the FIFO was configured with.
+ ******************************************************************************/
+void sl_hal_iadc_convert_raw_data_batch(const uint32_t *raw_data,
+                                        sl_hal_iadc_result_t *results,
+                                        uint32_t count,
+                                        sl_hal_iadc_alignment_t alignment);
+
+#if defined(LDMA_PRESENT) && defined(LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN)
+/***************************************************************************//**
+ * @brief
+ *   Initialize a continuous scan stream.
+ *
+ * @details
+ *   The stream uses two linked LDMA descriptors to drain the scan FIFO into
+ *   the two halves of a ring buffer. Each half holds frames_per_block scan
+ *   frames. Every time a half is filled the callback is invoked with it. The
+ *   application hands the half back with sl_hal_iadc_stream_release_block().
+ *
+ * @note
+ *   The IADC must be initialized and its scan table set before starting the
+ *   stream. Use a continuous or timer triggered scan, and set
+ *   fifo_dma_wakeup for operation in EM2. The LDMA must be initialized with
+ *   sl_hal_ldma_init(), and sl_hal_iadc_stream_irq_handler() must be called
+ *   from the LDMA interrupt handler.
+ *
+ * @param[in] iadc
+ *   Pointer to IADC peripheral register block.
+ *
+ * @param[out] stream
+ *   Stream state. Must stay valid while the stream runs.
+ *
+ * @param[in] config
+ *   Stream configuration.
+ ******************************************************************************/
+void sl_hal_iadc_stream_init(IADC_TypeDef *iadc,
+                             sl_hal_iadc_stream_t *stream,
+                             const sl_hal_iadc_stream_config_t *config);
+
+/***************************************************************************//**
+ * @brief
+ *   Start the LDMA ring and the scan.
+ *
+ * @param[in] stream
+ *   Stream state.
+ ******************************************************************************/
+void sl_hal_iadc_stream_start(sl_hal_iadc_stream_t *stream);
+
+/***************************************************************************//**
+ * @brief
+ *   Stop the scan and the LDMA ring.
+ *
+ * @param[in] stream
+ *   Stream state.
+ ******************************************************************************/
+void sl_hal_iadc_stream_stop(sl_hal_iadc_stream_t *stream);
+
+/***************************************************************************//**
+ * @brief
+ *   Hand a block delivered by the callback back to the stream.
+ *
+ * @details
+ *   A block must be released before the LDMA fills the other half of the
+ *   ring buffer, otherwise the stream counts an overrun.
+ *
+ * @param[in] stream
+ *   Stream state.
+ ******************************************************************************/
+void sl_hal_iadc_stream_release_block(sl_hal_iadc_stream_t *stream);
+
+/***************************************************************************//**
+ * @brief
+ *   Stream LDMA interrupt handler.
+ *
+ * @details
+ *   Call from the LDMA interrupt handler. Clears the channel done flag and
+ *   calls the stream callback if a block completed. Does nothing if the
+ *   channel flag is not pending.
+ *
+ * @param[in] stream
+ *   Stream state.
+ ******************************************************************************/
+void sl_hal_iadc_stream_irq_handler(sl_hal_iadc_stream_t *stream);
+#endif
+
 /***************************************************************************//**
  * @brief
  *   Enable the IADC.
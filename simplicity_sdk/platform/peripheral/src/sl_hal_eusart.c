@@ -35,6 +35,10 @@
 #include "sl_hal_prs.h"
 #endif // SL_HAL_EUSART_PRS_SUPPORTED
 #include <stddef.h>
+#if defined(SL_HAL_EUSART_BUFFERED_SUPPORTED)
+#include <string.h>
+#include "sl_core.h"
+#endif
 
 /*******************************************************************************
  **************************   LOCAL VARIABLES   ********************************
@@ -731,6 +735,356 @@ uint32_t sl_hal_eusart_spi_calculate_baudrate(uint32_t div, uint32_t freq)
 }
 #endif
 
+#if defined(SL_HAL_EUSART_BUFFERED_SUPPORTED)
+/***************************************************************************//**
+ * Read the tick source of the buffered UART, 0 if none is configured.
+ ******************************************************************************/
+static uint32_t eusart_buffered_ticks(const sl_hal_eusart_buffered_t *buffered)
+{
+  return (buffered->config.get_ticks != NULL) ? buffered->config.get_ticks() : 0;
+}
+
+/***************************************************************************//**
+ * Number of bytes written to the receive ring since reception started.
+ ******************************************************************************/
+static uint32_t eusart_buffered_rx_written(const sl_hal_eusart_buffered_t *buffered)
+{
+  uint32_t half    = buffered->config.rx_buffer_size / 2;
+  uint32_t ch_mask = 1UL << buffered->config.rx_channel;
+  uint32_t blocks;
+  uint32_t remaining;
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  blocks = buffered->rx_blocks;
+  // A half completed but not handled yet. The flag is read before the count
+  // so that a half completing in between is under-counted, never over-counted.
+  if ((sl_hal_ldma_get_pending_interrupts(buffered->config.ldma) & ch_mask) != 0) {
+    blocks++;
+  }
+  remaining = sl_hal_ldma_transfer_remaining_count(buffered->config.ldma,
+                                                   buffered->config.rx_channel);
+  CORE_EXIT_ATOMIC();
+
+  return (blocks * half) + (half - remaining);
+}
+
+/***************************************************************************//**
+ * Report received data to the application.
+ ******************************************************************************/
+static void eusart_buffered_rx_notify(sl_hal_eusart_buffered_t *buffered)
+{
+  uint32_t available = eusart_buffered_rx_written(buffered) - buffered->rx_read;
+
+  if (available == 0) {
+    return;
+  }
+  if (!buffered->rx_notified) {
+    buffered->rx_notified     = true;
+    buffered->rx_notify_ticks = eusart_buffered_ticks(buffered);
+  }
+  if (buffered->config.rx_callback != NULL) {
+    if (available > buffered->config.rx_buffer_size) {
+      available = buffered->config.rx_buffer_size;
+    }
+    buffered->config.rx_callback(available, buffered->config.user_data);
+  }
+}
+
+/***************************************************************************//**
+ * Hand all queued transmit buffers not yet launched to the LDMA as one chain.
+ ******************************************************************************/
+static void eusart_buffered_tx_launch(sl_hal_eusart_buffered_t *buffered)
+{
+  sl_hal_ldma_transfer_config_t transfer_config =
+    SL_HAL_LDMA_TRANSFER_CFG_PERIPHERAL(buffered->config.tx_signal);
+  LDMA_TypeDef *ldma = buffered->config.ldma;
+  uint32_t ch_mask   = 1UL << buffered->config.tx_channel;
+  uint32_t first     = buffered->tx_launched % SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE;
+  uint32_t index;
+  uint32_t slot;
+  uint32_t next;
+
+  for (index = buffered->tx_launched; index != buffered->tx_tail; index++) {
+    slot = index % SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE;
+    next = (index + 1) % SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE;
+    buffered->tx_descriptors[slot] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKABS_M2P(SL_HAL_LDMA_CTRL_SIZE_BYTE,
+                                                                                                  buffered->tx_buffers[slot],
+                                                                                                  &buffered->eusart->TXDATA,
+                                                                                                  buffered->tx_lengths[slot]);
+    // Only the last descriptor of the chain stops and raises the interrupt.
+    if (index + 1 != buffered->tx_tail) {
+      buffered->tx_descriptors[slot].xfer.link_addr = SL_HAL_LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(&buffered->tx_descriptors[next]);
+    } else {
+      buffered->tx_descriptors[slot].xfer.link     = 0;
+      buffered->tx_descriptors[slot].xfer.done_ifs = 1;
+    }
+  }
+  buffered->tx_launched = buffered->tx_tail;
+
+  sl_hal_ldma_init_transfer(ldma, buffered->config.tx_channel, &transfer_config, &buffered->tx_descriptors[first]);
+  sl_hal_ldma_clear_interrupts(ldma, ch_mask);
+  sl_hal_ldma_enable_interrupts(ldma, ch_mask);
+  sl_hal_ldma_start_transfer(ldma, buffered->config.tx_channel);
+}
+
+/***************************************************************************//**
+ * Initialize buffered UART operation.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_init(EUSART_TypeDef *eusart,
+                                 sl_hal_eusart_buffered_t *buffered,
+                                 const sl_hal_eusart_buffered_config_t *config)
+{
+  EFM_ASSERT(SL_HAL_EUSART_REF_VALID(eusart));
+  EFM_ASSERT(buffered != NULL);
+  EFM_ASSERT(config != NULL);
+  EFM_ASSERT(config->ldma != NULL);
+  EFM_ASSERT(config->rx_buffer != NULL);
+  EFM_ASSERT(config->rx_channel < DMA_CHAN_COUNT);
+  EFM_ASSERT(config->tx_channel < DMA_CHAN_COUNT);
+  EFM_ASSERT(config->rx_channel != config->tx_channel);
+  EFM_ASSERT((config->rx_buffer_size >= 2) && ((config->rx_buffer_size % 2) == 0));
+  EFM_ASSERT((config->rx_buffer_size / 2) <= SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE);
+  EFM_ASSERT(config->rx_timeout_frames <= (_EUSART_CFG1_RXTIMEOUT_MASK >> _EUSART_CFG1_RXTIMEOUT_SHIFT));
+  // CFG1 can only be written while the EUSART is disabled.
+  EFM_ASSERT((eusart->EN & _EUSART_EN_EN_MASK) == 0);
+
+  uint32_t half = config->rx_buffer_size / 2;
+
+  buffered->eusart = eusart;
+  buffered->config = *config;
+
+  eusart->CFG1 = (eusart->CFG1 & ~_EUSART_CFG1_RXTIMEOUT_MASK)
+                 | ((uint32_t)config->rx_timeout_frames << _EUSART_CFG1_RXTIMEOUT_SHIFT);
+
+  // Two descriptors linked to each other form the receive ring, each fills one half.
+  buffered->rx_descriptors[0] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKABS_P2M(SL_HAL_LDMA_CTRL_SIZE_BYTE,
+                                                                                             &eusart->RXDATA,
+                                                                                             config->rx_buffer,
+                                                                                             half);
+  buffered->rx_descriptors[1] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKABS_P2M(SL_HAL_LDMA_CTRL_SIZE_BYTE,
+                                                                                             &eusart->RXDATA,
+                                                                                             config->rx_buffer + half,
+                                                                                             half);
+  buffered->rx_descriptors[0].xfer.done_ifs  = 1;
+  buffered->rx_descriptors[0].xfer.link_addr = SL_HAL_LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(&buffered->rx_descriptors[1]);
+  buffered->rx_descriptors[1].xfer.done_ifs  = 1;
+  buffered->rx_descriptors[1].xfer.link_addr = SL_HAL_LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(&buffered->rx_descriptors[0]);
+
+  buffered->tx_head         = 0;
+  buffered->tx_launched     = 0;
+  buffered->tx_tail         = 0;
+  buffered->rx_blocks       = 0;
+  buffered->rx_read         = 0;
+  buffered->rx_notify_ticks = 0;
+  buffered->rx_notified     = false;
+  memset(&buffered->stats, 0, sizeof(buffered->stats));
+}
+
+/***************************************************************************//**
+ * Start continuous reception into the receive ring.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_start(sl_hal_eusart_buffered_t *buffered)
+{
+  EFM_ASSERT(buffered != NULL);
+
+  sl_hal_ldma_transfer_config_t transfer_config =
+    SL_HAL_LDMA_TRANSFER_CFG_PERIPHERAL(buffered->config.rx_signal);
+  LDMA_TypeDef *ldma = buffered->config.ldma;
+  uint32_t ch_mask   = 1UL << buffered->config.rx_channel;
+
+  buffered->rx_blocks   = 0;
+  buffered->rx_read     = 0;
+  buffered->rx_notified = false;
+
+  sl_hal_ldma_init_transfer(ldma, buffered->config.rx_channel, &transfer_config, &buffered->rx_descriptors[0]);
+  sl_hal_ldma_clear_interrupts(ldma, ch_mask);
+  sl_hal_ldma_enable_interrupts(ldma, ch_mask);
+  sl_hal_ldma_start_transfer(ldma, buffered->config.rx_channel);
+
+  sl_hal_eusart_clear_interrupts(buffered->eusart, EUSART_IF_RXTO | EUSART_IF_RXOF);
+  sl_hal_eusart_enable_interrupts(buffered->eusart, EUSART_IF_RXTO | EUSART_IF_RXOF);
+}
+
+/***************************************************************************//**
+ * Stop reception and transmission.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_stop(sl_hal_eusart_buffered_t *buffered)
+{
+  EFM_ASSERT(buffered != NULL);
+
+  sl_hal_eusart_disable_interrupts(buffered->eusart, EUSART_IF_RXTO | EUSART_IF_RXOF);
+  sl_hal_ldma_stop_transfer(buffered->config.ldma, buffered->config.rx_channel);
+  sl_hal_ldma_stop_transfer(buffered->config.ldma, buffered->config.tx_channel);
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  buffered->tx_head     = 0;
+  buffered->tx_launched = 0;
+  buffered->tx_tail     = 0;
+  buffered->rx_notified = false;
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Read received data from the receive ring.
+ ******************************************************************************/
+uint32_t sl_hal_eusart_buffered_read(sl_hal_eusart_buffered_t *buffered,
+                                     uint8_t *data,
+                                     uint32_t max_length)
+{
+  EFM_ASSERT(buffered != NULL);
+  EFM_ASSERT(data != NULL);
+
+  uint32_t size    = buffered->config.rx_buffer_size;
+  uint32_t read    = buffered->rx_read;
+  uint32_t written = eusart_buffered_rx_written(buffered);
+  uint32_t length  = written - read;
+  uint32_t offset;
+  uint32_t chunk;
+  uint32_t latency;
+
+  if (length > size) {
+    // The LDMA lapped the reader, the unread data is no longer consistent.
+    buffered->stats.rx_overruns++;
+    buffered->rx_read = written;
+    return 0;
+  }
+  if (length > max_length) {
+    length = max_length;
+  }
+
+  offset = read % size;
+  chunk  = (length < (size - offset)) ? length : (size - offset);
+  memcpy(data, &buffered->config.rx_buffer[offset], chunk);
+  memcpy(&data[chunk], buffered->config.rx_buffer, length - chunk);
+
+  // The copied bytes may have been overwritten while copying.
+  written = eusart_buffered_rx_written(buffered);
+  if ((written - read) > size) {
+    buffered->stats.rx_overruns++;
+    buffered->rx_read = written;
+    return 0;
+  }
+  buffered->rx_read        = read + length;
+  buffered->stats.rx_bytes += length;
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  if (buffered->rx_notified && (buffered->rx_read == written)) {
+    latency = eusart_buffered_ticks(buffered) - buffered->rx_notify_ticks;
+    buffered->stats.rx_latency_total += latency;
+    if (latency > buffered->stats.rx_latency_max) {
+      buffered->stats.rx_latency_max = latency;
+    }
+    buffered->rx_notified = false;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return length;
+}
+
+/***************************************************************************//**
+ * Queue a buffer for transmission.
+ ******************************************************************************/
+bool sl_hal_eusart_buffered_write(sl_hal_eusart_buffered_t *buffered,
+                                  const uint8_t *data,
+                                  uint32_t length)
+{
+  EFM_ASSERT(buffered != NULL);
+  EFM_ASSERT(data != NULL);
+  EFM_ASSERT((length > 0) && (length <= SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE));
+
+  uint32_t slot;
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  if ((buffered->tx_tail - buffered->tx_head) == SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE) {
+    CORE_EXIT_ATOMIC();
+    return false;
+  }
+  slot                       = buffered->tx_tail % SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE;
+  buffered->tx_buffers[slot] = data;
+  buffered->tx_lengths[slot] = length;
+  buffered->tx_ticks[slot]   = eusart_buffered_ticks(buffered);
+  buffered->tx_tail++;
+  // Buffers queued while a chain is running are launched when it completes.
+  if (buffered->tx_launched == buffered->tx_head) {
+    eusart_buffered_tx_launch(buffered);
+  }
+  CORE_EXIT_ATOMIC();
+
+  return true;
+}
+
+/***************************************************************************//**
+ * Buffered UART LDMA interrupt handler.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_ldma_irq_handler(sl_hal_eusart_buffered_t *buffered)
+{
+  EFM_ASSERT(buffered != NULL);
+
+  LDMA_TypeDef *ldma = buffered->config.ldma;
+  uint32_t rx_mask   = 1UL << buffered->config.rx_channel;
+  uint32_t tx_mask   = 1UL << buffered->config.tx_channel;
+  uint32_t pending   = sl_hal_ldma_get_pending_interrupts(ldma) & (rx_mask | tx_mask);
+  uint32_t now       = eusart_buffered_ticks(buffered);
+  uint32_t slot;
+  uint32_t latency;
+
+  if ((pending & rx_mask) != 0) {
+    buffered->rx_blocks++;
+    sl_hal_ldma_clear_interrupts(ldma, rx_mask);
+    eusart_buffered_rx_notify(buffered);
+  }
+
+  if ((pending & tx_mask) != 0) {
+    sl_hal_ldma_clear_interrupts(ldma, tx_mask);
+    while (buffered->tx_head != buffered->tx_launched) {
+      slot    = buffered->tx_head % SL_HAL_EUSART_BUFFERED_TX_QUEUE_SIZE;
+      latency = now - buffered->tx_ticks[slot];
+      buffered->stats.tx_buffers++;
+      buffered->stats.tx_bytes         += buffered->tx_lengths[slot];
+      buffered->stats.tx_latency_total += latency;
+      if (latency > buffered->stats.tx_latency_max) {
+        buffered->stats.tx_latency_max = latency;
+      }
+      buffered->tx_head++;
+      if (buffered->config.tx_callback != NULL) {
+        buffered->config.tx_callback(buffered->tx_buffers[slot],
+                                     buffered->tx_lengths[slot],
+                                     buffered->config.user_data);
+      }
+    }
+    if (buffered->tx_launched != buffered->tx_tail) {
+      eusart_buffered_tx_launch(buffered);
+    }
+  }
+}
+
+/***************************************************************************//**
+ * Buffered UART EUSART interrupt handler.
+ ******************************************************************************/
+void sl_hal_eusart_buffered_irq_handler(sl_hal_eusart_buffered_t *buffered)
+{
+  EFM_ASSERT(buffered != NULL);
+
+  uint32_t pending = sl_hal_eusart_get_enabled_pending_interrupts(buffered->eusart)
+                     & (EUSART_IF_RXTO | EUSART_IF_RXOF);
+
+  sl_hal_eusart_clear_interrupts(buffered->eusart, pending);
+
+  if ((pending & EUSART_IF_RXOF) != 0) {
+    buffered->stats.rx_fifo_overflows++;
+  }
+  // The line went idle, flush the partially filled half to the application.
+  if ((pending & EUSART_IF_RXTO) != 0) {
+    buffered->stats.rx_timeouts++;
+    eusart_buffered_rx_notify(buffered);
+  }
+}
+#endif // defined(SL_HAL_EUSART_BUFFERED_SUPPORTED)
+
 /***************************************************************************//**
  * Initializes the EUSART with asynchronous common settings to high
  * and low frequency clock.
@@ -35,6 +35,9 @@
 #include "sl_assert.h"
 #include "sl_common.h"
 #include "sl_hal_system.h"
+#if defined(LDMA_PRESENT) && defined(LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN)
+#include "sl_core.h"
+#endif
 #include <stddef.h>
 
 /*******************************************************************************
@@ -915,6 +918,192 @@ uint32_t sl_hal_iadc_get_reference_voltage(sl_hal_iadc_voltage_reference_t refer
   return ref_voltage;
 }
 
+/***************************************************************************//**
+ * Convert a block of raw FIFO words to results, decoding the alignment once.
+ ******************************************************************************/
+void sl_hal_iadc_convert_raw_data_batch(const uint32_t *raw_data,
+                                        sl_hal_iadc_result_t *results,
+                                        uint32_t count,
+                                        sl_hal_iadc_alignment_t alignment)
+{
+  EFM_ASSERT(raw_data != NULL);
+  EFM_ASSERT(results != NULL);
+
+  uint32_t i;
+  uint32_t raw;
+
+  switch (alignment) {
+    case SL_HAL_IADC_ALIGNMENT_RIGHT_12:
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16)
+    case SL_HAL_IADC_ALIGNMENT_RIGHT_16:
+#endif
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20)
+    case SL_HAL_IADC_ALIGNMENT_RIGHT_20:
+#endif
+      for (i = 0; i < count; i++) {
+        raw = raw_data[i];
+        // Mask out ID and replace with sign extension.
+        results[i].data = (raw & 0x00FFFFFFUL)
+                          | ((raw & 0x00800000UL) != 0x0UL ? 0xFF000000UL : 0x0UL);
+        results[i].id   = (uint8_t)(raw >> 24);
+      }
+      break;
+
+    case SL_HAL_IADC_ALIGNMENT_LEFT_12:
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT16)
+    case SL_HAL_IADC_ALIGNMENT_LEFT_16:
+#endif
+#if defined(IADC_SINGLEFIFOCFG_ALIGNMENT_RIGHT20)
+    case SL_HAL_IADC_ALIGNMENT_LEFT_20:
+#endif
+      for (i = 0; i < count; i++) {
+        raw = raw_data[i];
+        results[i].data = raw & 0xFFFFFF00UL;
+        results[i].id   = (uint8_t)(raw & 0x000000FFUL);
+      }
+      break;
+    default:
+      EFM_ASSERT(false);
+      break;
+  }
+}
+
+#if defined(LDMA_PRESENT) && defined(LDMAXBAR_CH_REQSEL_SIGSEL_IADC0IADC_SCAN)
+/***************************************************************************//**
+ * Initialize a continuous scan stream.
+ ******************************************************************************/
+void sl_hal_iadc_stream_init(IADC_TypeDef *iadc,
+                             sl_hal_iadc_stream_t *stream,
+                             const sl_hal_iadc_stream_config_t *config)
+{
+  // The LDMA request signal is only routed from IADC0.
+  EFM_ASSERT(iadc == IADC0);
+  EFM_ASSERT(stream != NULL);
+  EFM_ASSERT(config != NULL);
+  EFM_ASSERT(config->ldma != NULL);
+  EFM_ASSERT(config->buffer != NULL);
+  EFM_ASSERT(config->callback != NULL);
+  EFM_ASSERT(config->channel < DMA_CHAN_COUNT);
+
+  uint32_t block_words = config->frame_size * config->frames_per_block;
+  EFM_ASSERT((block_words > 0) && (block_words <= SL_HAL_LDMA_DESCRIPTOR_MAX_XFER_SIZE));
+
+  stream->iadc   = iadc;
+  stream->config = *config;
+
+  // Two descriptors linked to each other form the ring, each fills one half.
+  stream->descriptors[0] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKABS_P2M(SL_HAL_LDMA_CTRL_SIZE_WORD,
+                                                                                       &iadc->SCANFIFODATA,
+                                                                                       config->buffer,
+                                                                                       block_words);
+  stream->descriptors[1] = (sl_hal_ldma_descriptor_t)SL_HAL_LDMA_DESCRIPTOR_LINKABS_P2M(SL_HAL_LDMA_CTRL_SIZE_WORD,
+                                                                                       &iadc->SCANFIFODATA,
+                                                                                       config->buffer + block_words,
+                                                                                       block_words);
+  stream->descriptors[0].xfer.done_ifs  = 1;
+  stream->descriptors[0].xfer.link_addr = SL_HAL_LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(&stream->descriptors[1]);
+  stream->descriptors[1].xfer.done_ifs  = 1;
+  stream->descriptors[1].xfer.link_addr = SL_HAL_LDMA_DESCRIPTOR_LINKABS_ADDR_TO_LINKADDR(&stream->descriptors[0]);
+
+  stream->next_block     = 0;
+  stream->held           = 0;
+  stream->blocks         = 0;
+  stream->overruns       = 0;
+  stream->fifo_overflows = 0;
+}
+
+/***************************************************************************//**
+ * Start the LDMA ring and the scan.
+ ******************************************************************************/
+void sl_hal_iadc_stream_start(sl_hal_iadc_stream_t *stream)
+{
+  EFM_ASSERT(stream != NULL);
+
+  sl_hal_ldma_transfer_config_t transfer_config =
+    SL_HAL_LDMA_TRANSFER_CFG_PERIPHERAL(SL_HAL_LDMA_PERIPHERAL_SIGNAL_IADC0_IADC_SCAN);
+  LDMA_TypeDef *ldma = stream->config.ldma;
+  uint32_t ch_mask   = 1UL << stream->config.channel;
+
+  stream->next_block = 0;
+  stream->held       = 0;
+
+  sl_hal_iadc_clear_interrupts(stream->iadc, IADC_IF_SCANFIFOOF);
+  sl_hal_ldma_init_transfer(ldma, stream->config.channel, &transfer_config, &stream->descriptors[0]);
+  sl_hal_ldma_clear_interrupts(ldma, ch_mask);
+  sl_hal_ldma_enable_interrupts(ldma, ch_mask);
+  sl_hal_ldma_start_transfer(ldma, stream->config.channel);
+  sl_hal_iadc_start_scan(stream->iadc);
+}
+
+/***************************************************************************//**
+ * Stop the scan and the LDMA ring.
+ ******************************************************************************/
+void sl_hal_iadc_stream_stop(sl_hal_iadc_stream_t *stream)
+{
+  EFM_ASSERT(stream != NULL);
+
+  sl_hal_iadc_stop_scan(stream->iadc);
+  sl_hal_ldma_stop_transfer(stream->config.ldma, stream->config.channel);
+}
+
+/***************************************************************************//**
+ * Hand a block delivered by the callback back to the stream.
+ ******************************************************************************/
+void sl_hal_iadc_stream_release_block(sl_hal_iadc_stream_t *stream)
+{
+  EFM_ASSERT(stream != NULL);
+
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  if (stream->held > 0) {
+    stream->held--;
+  }
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Stream LDMA interrupt handler.
+ ******************************************************************************/
+void sl_hal_iadc_stream_irq_handler(sl_hal_iadc_stream_t *stream)
+{
+  EFM_ASSERT(stream != NULL);
+
+  LDMA_TypeDef *ldma   = stream->config.ldma;
+  uint32_t ch_mask     = 1UL << stream->config.channel;
+  uint32_t block_words = stream->config.frame_size * stream->config.frames_per_block;
+  uint32_t block;
+  bool overrun = false;
+
+  if ((sl_hal_ldma_get_pending_interrupts(ldma) & ch_mask) == 0) {
+    return;
+  }
+  sl_hal_ldma_clear_interrupts(ldma, ch_mask);
+
+  if ((sl_hal_iadc_get_pending_interrupts(stream->iadc) & IADC_IF_SCANFIFOOF) != 0) {
+    sl_hal_iadc_clear_interrupts(stream->iadc, IADC_IF_SCANFIFOOF);
+    stream->fifo_overflows++;
+    overrun = true;
+  }
+
+  block              = stream->next_block;
+  stream->next_block = block ^ 1UL;
+  stream->blocks++;
+
+  // The LDMA now fills the other half; if that half is still held it is lost.
+  if (stream->held > 0) {
+    stream->overruns++;
+    stream->held = 0;
+    overrun      = true;
+  }
+  stream->held++;
+
+  stream->config.callback(stream->config.buffer + (block * block_words),
+                          stream->config.frames_per_block,
+                          overrun,
+                          stream->config.user_data);
+}
+#endif
+
 static sl_hal_iadc_result_t sl_hal_iadc_convert_raw_data_to_result(uint32_t raw_data,
                                                                    sl_hal_iadc_alignment_t alignment)
 {
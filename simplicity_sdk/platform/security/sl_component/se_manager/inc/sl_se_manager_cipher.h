@@ -1116,6 +1116,53 @@ sl_status_t sl_se_poly1305_genkey_tag(sl_se_command_context_t *cmd_ctx,
 
 #endif // (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT)
 
+/***************************************************************************//**
+ * @brief
+ *   Authenticated encryption of a batch of independent packets under one key.
+ *
+ * @details
+ *   Each packet is encrypted exactly as by sl_se_ccm_encrypt_and_tag(),
+ *   sl_se_gcm_crypt_and_tag() with @ref SL_SE_ENCRYPT, or
+ *   sl_se_chacha20_poly1305_encrypt_and_tag(). The SE has no multi-packet
+ *   AEAD command, so every packet is still one mailbox command. Instead, the
+ *   SE lock is taken once for the whole batch and the key-level checks are
+ *   done once, which removes most of the per-packet overhead for short
+ *   payloads. Other threads cannot use the SE until the batch completes.
+ *
+ *   A failing packet does not stop the batch. Its error is reported in the
+ *   status field of its item.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @param[in] key
+ *   Pointer to sl_se_key_descriptor_t structure, shared by all packets.
+ *
+ * @param[in] alg
+ *   AEAD algorithm to use.
+ *
+ * @param[in] tag_len
+ *   The length of the tag to generate in Bytes, for all packets. Must be
+ *   16 for ChaCha20-Poly1305.
+ *
+ * @param[in,out] items
+ *   Packets to encrypt. The status field of each item is written.
+ *
+ * @param[in] item_count
+ *   Number of packets in @p items.
+ *
+ * @return
+ *   SL_STATUS_OK if every packet was encrypted, otherwise the status of the
+ *   first packet that failed, or the error that prevented the batch from
+ *   starting.
+ ******************************************************************************/
+sl_status_t sl_se_aead_encrypt_and_tag_batch(sl_se_command_context_t *cmd_ctx,
+                                             const sl_se_key_descriptor_t *key,
+                                             sl_se_aead_batch_alg_t alg,
+                                             size_t tag_len,
+                                             sl_se_aead_batch_item_t *items,
+                                             size_t item_count);
+
 #if defined(_SILICON_LABS_32B_SERIES_3)
 
 /***************************************************************************//**
@@ -398,6 +398,26 @@ typedef struct {
   bool    first_operation;          ///< First operation
 } sl_se_gcm_multipart_context_t;
 
+/// AEAD algorithms accepted by sl_se_aead_encrypt_and_tag_batch().
+typedef enum {
+  SL_SE_AEAD_BATCH_AES_CCM,           ///< AES-CCM
+  SL_SE_AEAD_BATCH_AES_GCM,           ///< AES-GCM
+  SL_SE_AEAD_BATCH_CHACHA20_POLY1305, ///< ChaCha20-Poly1305 (Vault devices only)
+} sl_se_aead_batch_alg_t;
+
+/// One packet of an AEAD encryption batch.
+typedef struct {
+  const unsigned char *iv;          ///< Nonce
+  size_t iv_len;                    ///< Nonce length
+  const unsigned char *add;         ///< Additional data
+  size_t add_len;                   ///< Additional data length
+  const unsigned char *input;       ///< Plaintext
+  unsigned char *output;            ///< Ciphertext, same length as the plaintext
+  size_t length;                    ///< Plaintext length
+  unsigned char *tag;               ///< Tag output
+  sl_status_t status;               ///< Result for this packet, set by the batch call
+} sl_se_aead_batch_item_t;
+
 /// @} (end addtogroup sl_se_manager_cipher)
 
 /// @addtogroup sl_se_manager_hash
@@ -184,6 +184,23 @@ sl_status_t sli_se_lock_release(void);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SE_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx);
 
+#if defined(SLI_MAILBOX_COMMAND_SUPPORTED) && !defined(SLI_SE_MANAGER_HOST_SYSTEM)
+/***************************************************************************//**
+ * @brief
+ *   Execute and wait for mailbox command to complete, without taking the SE
+ *   lock. The caller must hold the SE lock, which lets a sequence of
+ *   commands run back to back under a single lock acquisition.
+ *
+ * @param[in] cmd_ctx
+ *   Pointer to an SE command context object.
+ *
+ * @return
+ *   Status code, @ref sl_status.h.
+ ******************************************************************************/
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_SE_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+sl_status_t sli_se_execute_and_wait_locked(sl_se_command_context_t *cmd_ctx);
+#endif
+
 #if defined(SLI_MAILBOX_COMMAND_SUPPORTED)
 // Key handling helper functions
 sl_status_t sli_key_get_storage_size(const sl_se_key_descriptor_t* key,
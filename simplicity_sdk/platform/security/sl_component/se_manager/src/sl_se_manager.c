@@ -373,7 +373,7 @@ sl_status_t sl_se_set_yield(sl_se_command_context_t *cmd_ctx,
 sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
 {
   sl_status_t status = SL_STATUS_FAIL;
-  sli_se_mailbox_response_t command_response = SLI_SE_RESPONSE_INTERNAL_ERROR;
+  sl_status_t command_status = SL_STATUS_FAIL;
 
   if (cmd_ctx == NULL) {
     return SL_STATUS_INVALID_PARAMETER;
@@ -385,6 +385,36 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
     return status;
   }
 
+  command_status = sli_se_execute_and_wait_locked(cmd_ctx);
+
+  // Release SE lock
+  status = sli_se_lock_release();
+
+  if (command_status != SL_STATUS_OK) {
+    return command_status;
+  }
+  return status;
+}
+
+/***************************************************************************//**
+ * @brief
+ *   Execute and wait for SE mailbox command to complete, with the SE lock
+ *   already held by the caller.
+ *
+ * @return
+ *   One of the following status code, any other status codes relates to internal
+ *   function errors see @ref sl_status.h for their meaning.
+ *   - @c SL_STATUS_OK
+ *   - @c SL_STATUS_INVALID_PARAMETER
+ ******************************************************************************/
+sl_status_t sli_se_execute_and_wait_locked(sl_se_command_context_t *cmd_ctx)
+{
+  sli_se_mailbox_response_t command_response = SLI_SE_RESPONSE_INTERNAL_ERROR;
+
+  if (cmd_ctx == NULL) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
   // Execute SE mailbox command
   sli_se_mailbox_execute_command(&cmd_ctx->command);
 
@@ -394,8 +424,8 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
     sli_se_mailbox_enable_interrupt(SEMAILBOX_CONFIGURATION_RXINTEN);
 
     // Yield and Wait for the command completion signal
-    status = sli_psec_osal_wait_completion((sli_psec_osal_completion_t *)&se_command_completion,
-                                           SLI_PSEC_OSAL_WAIT_FOREVER);
+    sl_status_t status = sli_psec_osal_wait_completion((sli_psec_osal_completion_t *)&se_command_completion,
+                                                       SLI_PSEC_OSAL_WAIT_FOREVER);
 
     // Disable SEMAILBOX RXINT interrupt.
     sli_se_mailbox_disable_interrupt(SEMAILBOX_CONFIGURATION_RXINTEN);
@@ -405,7 +435,6 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
       // Read the command handle word ( not used ) from the SEMAILBOX FIFO
       SEMAILBOX_HOST->FIFO;
       #endif // #if (_SILICON_LABS_32B_SERIES == 3)
-      sli_se_lock_release();
       return status;
     }
 
@@ -425,12 +454,9 @@ sl_status_t sli_se_execute_and_wait(sl_se_command_context_t *cmd_ctx)
 
   #endif // #if defined(SL_SE_MANAGER_YIELD_WHILE_WAITING_FOR_COMMAND_COMPLETION)
 
-  // Release SE lock
-  status = sli_se_lock_release();
-
   // Return sl_status_t code.
   if (command_response == SLI_SE_RESPONSE_OK) {
-    return status;
+    return SL_STATUS_OK;
   } else {
     // Convert from sli_se_mailbox_response_t to sl_status_t code and return.
     return sli_se_to_sl_status(command_response);
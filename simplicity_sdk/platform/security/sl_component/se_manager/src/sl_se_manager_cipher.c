@@ -39,6 +39,14 @@
 /// @addtogroup sl_se_manager
 /// @{
 
+// -----------------------------------------------------------------------------
+// Local Types
+
+// Function used to run a prepared mailbox command. Single operations use
+// sli_se_execute_and_wait(), batches run under one SE lock acquisition with
+// sli_se_execute_and_wait_locked().
+typedef sl_status_t (*se_execute_function_t)(sl_se_command_context_t *cmd_ctx);
+
 uint32_t memcmp_time_cst(uint8_t *in1, uint8_t *in2, uint32_t size)
 {
   //Don't try to optimise this function for performance, it's time constant for security reasons
@@ -448,16 +456,17 @@ sl_status_t sl_se_aes_crypt_ctr(sl_se_command_context_t *cmd_ctx,
 }
 
 /***************************************************************************//**
- * AES-CCM buffer encryption.
+ * AES-CCM buffer encryption, running the command with the given function.
  ******************************************************************************/
-sl_status_t sl_se_ccm_encrypt_and_tag(sl_se_command_context_t *cmd_ctx,
-                                      const sl_se_key_descriptor_t *key,
-                                      size_t length,
-                                      const unsigned char *iv, size_t iv_len,
-                                      const unsigned char *add, size_t add_len,
-                                      const unsigned char *input,
-                                      unsigned char *output,
-                                      unsigned char *tag, size_t tag_len)
+static sl_status_t ccm_encrypt_and_tag(se_execute_function_t execute,
+                                       sl_se_command_context_t *cmd_ctx,
+                                       const sl_se_key_descriptor_t *key,
+                                       size_t length,
+                                       const unsigned char *iv, size_t iv_len,
+                                       const unsigned char *add, size_t add_len,
+                                       const unsigned char *input,
+                                       unsigned char *output,
+                                       unsigned char *tag, size_t tag_len)
 {
   if (cmd_ctx == NULL || key == NULL || (tag_len > 0 && tag == NULL) || iv == NULL) {
     return SL_STATUS_INVALID_PARAMETER;
@@ -522,10 +531,33 @@ sl_status_t sl_se_ccm_encrypt_and_tag(sl_se_command_context_t *cmd_ctx,
   sli_se_mailbox_command_add_output(se_cmd, &out_data);
   sli_se_mailbox_command_add_output(se_cmd, &out_tag);
 
-  command_status = sli_se_execute_and_wait(cmd_ctx);
+  command_status = execute(cmd_ctx);
   return command_status;
 }
 
+/***************************************************************************//**
+ * AES-CCM buffer encryption.
+ ******************************************************************************/
+sl_status_t sl_se_ccm_encrypt_and_tag(sl_se_command_context_t *cmd_ctx,
+                                      const sl_se_key_descriptor_t *key,
+                                      size_t length,
+                                      const unsigned char *iv, size_t iv_len,
+                                      const unsigned char *add, size_t add_len,
+                                      const unsigned char *input,
+                                      unsigned char *output,
+                                      unsigned char *tag, size_t tag_len)
+{
+  return ccm_encrypt_and_tag(sli_se_execute_and_wait,
+                             cmd_ctx,
+                             key,
+                             length,
+                             iv, iv_len,
+                             add, add_len,
+                             input,
+                             output,
+                             tag, tag_len);
+}
+
 /***************************************************************************//**
  * AES-CCM buffer decryption.
  ******************************************************************************/
@@ -1669,6 +1701,66 @@ sl_status_t sl_se_hmac(sl_se_command_context_t *cmd_ctx,
   return sli_se_execute_and_wait(cmd_ctx);
 }
 
+/***************************************************************************//**
+ * AES-GCM encryption command, shared by sl_se_gcm_crypt_and_tag() and the
+ * AEAD batch. Parameters are expected to be validated by the caller.
+ ******************************************************************************/
+static sl_status_t gcm_encrypt_and_tag(se_execute_function_t execute,
+                                       sl_se_command_context_t *cmd_ctx,
+                                       const sl_se_key_descriptor_t *key,
+                                       size_t length,
+                                       const unsigned char *iv,
+                                       size_t iv_len,
+                                       const unsigned char *add,
+                                       size_t add_len,
+                                       const unsigned char *input,
+                                       unsigned char *output,
+                                       size_t tag_len,
+                                       unsigned char *tag)
+{
+  sli_se_mailbox_command_t *se_cmd = &cmd_ctx->command;
+  uint8_t tagbuf[16];
+  sl_status_t status = SL_STATUS_OK;
+
+  sli_se_command_init(cmd_ctx, SLI_SE_COMMAND_AES_GCM_ENCRYPT);
+
+  sli_add_key_parameters(cmd_ctx, key, status);
+  sli_se_mailbox_command_add_parameter(se_cmd, add_len);
+  sli_se_mailbox_command_add_parameter(se_cmd, length);
+
+  sli_add_key_metadata(cmd_ctx, key, status);
+  sli_add_key_input(cmd_ctx, key, status);
+
+  sli_se_datatransfer_t iv_in = SLI_SE_DATATRANSFER_DEFAULT(iv, iv_len);
+  sli_se_mailbox_command_add_input(se_cmd, &iv_in);
+
+  sli_se_datatransfer_t aad_in = SLI_SE_DATATRANSFER_DEFAULT(add, add_len);
+  sli_se_mailbox_command_add_input(se_cmd, &aad_in);
+
+  sli_se_datatransfer_t data_in = SLI_SE_DATATRANSFER_DEFAULT(input, length);
+  sli_se_mailbox_command_add_input(se_cmd, &data_in);
+
+  sli_se_datatransfer_t data_out = SLI_SE_DATATRANSFER_DEFAULT(output, length);
+  if (output == NULL) {
+    data_out.length |= SLI_SE_DATATRANSFER_DISCARD;
+  }
+  sli_se_mailbox_command_add_output(se_cmd, &data_out);
+
+  sli_se_datatransfer_t mac_out = SLI_SE_DATATRANSFER_DEFAULT(tagbuf, sizeof(tagbuf));
+  sli_se_mailbox_command_add_output(se_cmd, &mac_out);
+
+  // Execute GCM operation.
+  status = execute(cmd_ctx);
+  if (status == SL_STATUS_OK) {
+    // For encryption, copy requested tag size to output tag buffer.
+    memcpy(tag, tagbuf, tag_len);
+  } else {
+    memset(output, 0, length);
+  }
+
+  return status;
+}
+
 /***************************************************************************//**
  * GCM buffer encryption or decryption.
  ******************************************************************************/
@@ -1694,7 +1786,6 @@ sl_status_t sl_se_gcm_crypt_and_tag(sl_se_command_context_t *cmd_ctx,
   }
 
   sli_se_mailbox_command_t *se_cmd = &cmd_ctx->command;
-  uint8_t tagbuf[16];
   sl_status_t status = SL_STATUS_OK;
 
   if (// IV length is required to be 96 bits for SE.
@@ -1758,43 +1849,18 @@ sl_status_t sl_se_gcm_crypt_and_tag(sl_se_command_context_t *cmd_ctx,
     output = NULL;
   }
 
-  sli_se_command_init(cmd_ctx, SLI_SE_COMMAND_AES_GCM_ENCRYPT);
-
-  sli_add_key_parameters(cmd_ctx, key, status);
-  sli_se_mailbox_command_add_parameter(se_cmd, add_len);
-  sli_se_mailbox_command_add_parameter(se_cmd, length);
-
-  sli_add_key_metadata(cmd_ctx, key, status);
-  sli_add_key_input(cmd_ctx, key, status);
-
-  sli_se_datatransfer_t iv_in = SLI_SE_DATATRANSFER_DEFAULT(iv, iv_len);
-  sli_se_mailbox_command_add_input(se_cmd, &iv_in);
-
-  sli_se_datatransfer_t aad_in = SLI_SE_DATATRANSFER_DEFAULT(add, add_len);
-  sli_se_mailbox_command_add_input(se_cmd, &aad_in);
-
-  sli_se_datatransfer_t data_in = SLI_SE_DATATRANSFER_DEFAULT(input, length);
-  sli_se_mailbox_command_add_input(se_cmd, &data_in);
-
-  sli_se_datatransfer_t data_out = SLI_SE_DATATRANSFER_DEFAULT(output, length);
-  if (output == NULL) {
-    data_out.length |= SLI_SE_DATATRANSFER_DISCARD;
-  }
-  sli_se_mailbox_command_add_output(se_cmd, &data_out);
-
-  sli_se_datatransfer_t mac_out = SLI_SE_DATATRANSFER_DEFAULT(tagbuf, sizeof(tagbuf));
-  sli_se_mailbox_command_add_output(se_cmd, &mac_out);
-
-  // Execute GCM operation.
-  status = sli_se_execute_and_wait(cmd_ctx);
-  if (status == SL_STATUS_OK) {
-    // For encryption, copy requested tag size to output tag buffer.
-    memcpy(tag, tagbuf, tag_len);
-  } else {
-    memset(output, 0, length);
-  }
-
-  return status;
+  return gcm_encrypt_and_tag(sli_se_execute_and_wait,
+                             cmd_ctx,
+                             key,
+                             length,
+                             iv,
+                             iv_len,
+                             add,
+                             add_len,
+                             input,
+                             output,
+                             tag_len,
+                             tag);
 }
 
 /***************************************************************************//**
@@ -2720,17 +2786,18 @@ sl_status_t sl_se_chacha20_crypt(sl_se_command_context_t *cmd_ctx,
 }
 
 /***************************************************************************//**
- * ChaCha20-Poly1305 authenticated encryption with additional data, as defined
- * by RFC8439 section 2.8.
+ * ChaCha20-Poly1305 authenticated encryption, running the command with the
+ * given function.
  ******************************************************************************/
-sl_status_t sl_se_chacha20_poly1305_encrypt_and_tag(sl_se_command_context_t *cmd_ctx,
-                                                    const sl_se_key_descriptor_t *key,
-                                                    size_t length,
-                                                    const unsigned char nonce[12],
-                                                    const unsigned char *add, size_t add_len,
-                                                    const unsigned char *input,
-                                                    unsigned char *output,
-                                                    unsigned char *tag)
+static sl_status_t chacha20_poly1305_encrypt_and_tag(se_execute_function_t execute,
+                                                     sl_se_command_context_t *cmd_ctx,
+                                                     const sl_se_key_descriptor_t *key,
+                                                     size_t length,
+                                                     const unsigned char nonce[12],
+                                                     const unsigned char *add, size_t add_len,
+                                                     const unsigned char *input,
+                                                     unsigned char *output,
+                                                     unsigned char *tag)
 {
   // Check input parameters.
   if (cmd_ctx == NULL || key == NULL || nonce == NULL
@@ -2777,7 +2844,31 @@ sl_status_t sl_se_chacha20_poly1305_encrypt_and_tag(sl_se_command_context_t *cmd
   sli_se_mailbox_command_add_output(se_cmd, &mac_out);
 
   // Execute AEAD operation.
-  return sli_se_execute_and_wait(cmd_ctx);
+  return execute(cmd_ctx);
+}
+
+/***************************************************************************//**
+ * ChaCha20-Poly1305 authenticated encryption with additional data, as defined
+ * by RFC8439 section 2.8.
+ ******************************************************************************/
+sl_status_t sl_se_chacha20_poly1305_encrypt_and_tag(sl_se_command_context_t *cmd_ctx,
+                                                    const sl_se_key_descriptor_t *key,
+                                                    size_t length,
+                                                    const unsigned char nonce[12],
+                                                    const unsigned char *add, size_t add_len,
+                                                    const unsigned char *input,
+                                                    unsigned char *output,
+                                                    unsigned char *tag)
+{
+  return chacha20_poly1305_encrypt_and_tag(sli_se_execute_and_wait,
+                                           cmd_ctx,
+                                           key,
+                                           length,
+                                           nonce,
+                                           add, add_len,
+                                           input,
+                                           output,
+                                           tag);
 }
 
 /***************************************************************************//**
@@ -2889,6 +2980,156 @@ sl_status_t sl_se_poly1305_genkey_tag(sl_se_command_context_t *cmd_ctx,
 }
 #endif
 
+/***************************************************************************//**
+ * Authenticated encryption of a batch of packets under one key.
+ ******************************************************************************/
+sl_status_t sl_se_aead_encrypt_and_tag_batch(sl_se_command_context_t *cmd_ctx,
+                                             const sl_se_key_descriptor_t *key,
+                                             sl_se_aead_batch_alg_t alg,
+                                             size_t tag_len,
+                                             sl_se_aead_batch_item_t *items,
+                                             size_t item_count)
+{
+  if (cmd_ctx == NULL || key == NULL || (item_count > 0 && items == NULL)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Checks that only depend on the key and algorithm are done once for the
+  // whole batch.
+  switch (alg) {
+    case SL_SE_AEAD_BATCH_AES_CCM:
+      // The CCM command validates everything per packet.
+      break;
+
+    case SL_SE_AEAD_BATCH_AES_GCM:
+      if ((tag_len < 4) || (tag_len > 16)) {
+        return SL_STATUS_INVALID_PARAMETER;
+      }
+      switch (key->type) {
+        case SL_SE_KEY_TYPE_AES_128:
+        case SL_SE_KEY_TYPE_AES_192:
+        case SL_SE_KEY_TYPE_AES_256:
+          break;
+
+        default:
+          return SL_STATUS_INVALID_PARAMETER;
+      }
+      break;
+
+#if (defined(_SILICON_LABS_SECURITY_FEATURE) \
+  && (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT))
+    case SL_SE_AEAD_BATCH_CHACHA20_POLY1305:
+      if (tag_len != 16) {
+        return SL_STATUS_INVALID_PARAMETER;
+      }
+      break;
+#endif
+
+    default:
+      return SL_STATUS_NOT_SUPPORTED;
+  }
+
+  if (item_count == 0) {
+    return SL_STATUS_OK;
+  }
+
+  sl_status_t status = SL_STATUS_OK;
+  se_execute_function_t execute;
+
+#if defined(SLI_SE_MANAGER_HOST_SYSTEM)
+  execute = sli_se_execute_and_wait;
+#else
+  // Hold the SE lock for the whole batch so that each packet costs a single
+  // mailbox round trip and no lock traffic.
+  status = sli_se_lock_acquire();
+  if (status != SL_STATUS_OK) {
+    for (size_t i = 0; i < item_count; i++) {
+      items[i].status = status;
+    }
+    return status;
+  }
+  execute = sli_se_execute_and_wait_locked;
+#endif
+
+  for (size_t i = 0; i < item_count; i++) {
+    sl_se_aead_batch_item_t *item = &items[i];
+
+    switch (alg) {
+      case SL_SE_AEAD_BATCH_AES_CCM:
+        item->status = ccm_encrypt_and_tag(execute,
+                                           cmd_ctx,
+                                           key,
+                                           item->length,
+                                           item->iv, item->iv_len,
+                                           item->add, item->add_len,
+                                           item->input,
+                                           item->output,
+                                           item->tag, tag_len);
+        break;
+
+      case SL_SE_AEAD_BATCH_AES_GCM:
+        if (item->iv == NULL || item->tag == NULL
+            || (item->iv_len != 96 / 8)
+            || ((item->add_len > 0) && (item->add == NULL))
+            || ((item->length > 0)
+                && (item->input == NULL || item->output == NULL))) {
+          item->status = SL_STATUS_INVALID_PARAMETER;
+          break;
+        }
+        item->status = gcm_encrypt_and_tag(execute,
+                                           cmd_ctx,
+                                           key,
+                                           item->length,
+                                           item->iv,
+                                           item->iv_len,
+                                           item->add,
+                                           item->add_len,
+                                           item->input,
+                                           item->output,
+                                           tag_len,
+                                           item->tag);
+        break;
+
+#if (defined(_SILICON_LABS_SECURITY_FEATURE) \
+  && (_SILICON_LABS_SECURITY_FEATURE == _SILICON_LABS_SECURITY_FEATURE_VAULT))
+      case SL_SE_AEAD_BATCH_CHACHA20_POLY1305:
+        if (item->iv == NULL || item->iv_len != 12) {
+          item->status = SL_STATUS_INVALID_PARAMETER;
+          break;
+        }
+        item->status = chacha20_poly1305_encrypt_and_tag(execute,
+                                                         cmd_ctx,
+                                                         key,
+                                                         item->length,
+                                                         item->iv,
+                                                         item->add, item->add_len,
+                                                         item->input,
+                                                         item->output,
+                                                         item->tag);
+        break;
+#endif
+
+      default:
+        item->status = SL_STATUS_NOT_SUPPORTED;
+        break;
+    }
+
+    // Report the first failure, but keep going: packets are independent.
+    if (status == SL_STATUS_OK) {
+      status = item->status;
+    }
+  }
+
+#if !defined(SLI_SE_MANAGER_HOST_SYSTEM)
+  sl_status_t release_status = sli_se_lock_release();
+  if (status == SL_STATUS_OK) {
+    status = release_status;
+  }
+#endif
+
+  return status;
+}
+
 /** @} (end addtogroup sl_se) */
 
 #if defined(_SILICON_LABS_32B_SERIES_3)
@@ -238,6 +238,12 @@ psa_status_t sli_hostcrypto_transparent_cipher_set_iv(
   size_t iv_length);
 
 /** Encrypt or decrypt a message fragment in an active cipher operation.
+ *
+ * For #PSA_ALG_ECB_NO_PADDING and #PSA_ALG_CTR each call runs at most one
+ * accelerator job. An ECB fragment which does not complete a block is only
+ * buffered. CTR keeps the next counter block and the keystream left over
+ * from a trailing partial block in \p operation, so a fragment which fits in
+ * that keystream runs no job.
  *
  * \param[in,out] operation     Active cipher operation.
  * \param[in] input             Buffer containing the message fragment to
@@ -54,8 +54,9 @@ typedef struct {
   psa_algorithm_t alg;                ///< Algorithm (cipher and mode of operation)
   struct sxkeyref key_ref;            ///< Key reference structure
   struct sxblkcipher cipher;          ///< Cipher operation
-  uint8_t block[16];                  ///< Block for input caching
-  uint8_t iv[16];                     ///< IV
+  uint8_t block[16];                  ///< Block for input caching, or CTR keystream left
+  uint8_t iv[16];                     ///< IV, or next CTR counter block
+  bool iv_set;                        ///< CTR counter block has been set
   size_t processed_length;            ///< Number of bytes processed
 } sli_hostcrypto_transparent_cipher_operation_t;
 
@@ -147,6 +147,187 @@ void sli_its_release_mutex(void)
 #endif
 }
 
+// -------------------------------------
+// Decrypted object cache
+
+// RAM budget, in bytes, for keeping decrypted ITS objects in RAM. Reading a
+// cached object skips both the NVM3 read and the AEAD decryption. 0 disables
+// the cache.
+#if !defined(SL_PSA_ITS_OBJECT_CACHE_SIZE)
+#define SL_PSA_ITS_OBJECT_CACHE_SIZE    0
+#endif
+
+// Maximum number of objects held by the decrypted object cache.
+#if !defined(SL_PSA_ITS_OBJECT_CACHE_ENTRIES)
+#define SL_PSA_ITS_OBJECT_CACHE_ENTRIES 8
+#endif
+
+#if defined(SLI_PSA_ITS_ENCRYPTED) && (SL_PSA_ITS_OBJECT_CACHE_SIZE > 0)
+#define SLI_PSA_ITS_OBJECT_CACHE
+
+typedef struct {
+  bool used;
+  psa_storage_uid_t uid;
+  psa_storage_create_flags_t flags;
+  uint32_t last_use;
+  size_t size;
+  uint8_t *data;
+} sli_its_object_cache_entry_t;
+
+typedef struct {
+  uint32_t hits;
+  uint32_t misses;
+  uint32_t evictions;
+} sli_its_object_cache_stats_t;
+
+#if defined(TFM_CONFIG_SL_SECURE_LIBRARY)
+static inline bool object_lives_in_s(const void *object, size_t object_size);
+#endif // defined(TFM_CONFIG_SL_SECURE_LIBRARY)
+
+static sli_its_object_cache_entry_t its_object_cache[SL_PSA_ITS_OBJECT_CACHE_ENTRIES] = { 0 };
+static size_t its_object_cache_used_size = 0;
+static uint32_t its_object_cache_clock = 0;
+SLI_STATIC sli_its_object_cache_stats_t its_object_cache_stats = { 0 };
+
+/**
+ * \brief Zeroize and drop a cache entry.
+ */
+static void object_cache_drop(sli_its_object_cache_entry_t *entry)
+{
+  if (entry->data != NULL) {
+    memset(entry->data, 0, entry->size);
+    mbedtls_free(entry->data);
+  }
+  its_object_cache_used_size -= entry->size;
+  memset(entry, 0, sizeof(*entry));
+}
+
+/**
+ * \brief Look up a decrypted object in the cache and mark it as most recently used.
+ *
+ * \return The cache entry, or NULL on a miss.
+ */
+static sli_its_object_cache_entry_t *object_cache_lookup(psa_storage_uid_t uid)
+{
+  for (size_t i = 0; i < SL_PSA_ITS_OBJECT_CACHE_ENTRIES; i++) {
+    if (its_object_cache[i].used && its_object_cache[i].uid == uid) {
+      its_object_cache[i].last_use = ++its_object_cache_clock;
+      its_object_cache_stats.hits++;
+      return &its_object_cache[i];
+    }
+  }
+  its_object_cache_stats.misses++;
+  return NULL;
+}
+
+/**
+ * \brief Serve a psa_its_get() request from a cache entry, applying the same
+ *        checks as for an object read from NVM3.
+ */
+static psa_status_t object_cache_read(const sli_its_object_cache_entry_t *entry,
+                                      uint32_t data_offset,
+                                      uint32_t data_length,
+                                      void *p_data,
+                                      size_t *p_data_length)
+{
+#if defined(TFM_CONFIG_SL_SECURE_LIBRARY)
+  if (entry->flags == PSA_STORAGE_FLAG_WRITE_ONCE_SECURE_ACCESSIBLE
+      && !object_lives_in_s(p_data, data_length)) {
+    // The flag indicates that this data should not be read back to the non-secure domain
+    return PSA_ERROR_INVALID_ARGUMENT;
+  }
+#endif
+
+  // Empty objects are never cached, so only the offset needs checking.
+  if (data_length != 0U) {
+    if (data_offset >= entry->size) {
+      return PSA_ERROR_INVALID_ARGUMENT;
+    }
+  } else if (data_offset > entry->size) {
+    return PSA_ERROR_INVALID_ARGUMENT;
+  }
+
+  if (data_length > (entry->size - data_offset)) {
+    *p_data_length = entry->size - data_offset;
+  } else {
+    *p_data_length = data_length;
+  }
+
+  if (*p_data_length > 0) {
+    memcpy(p_data, entry->data + data_offset, *p_data_length);
+  }
+  return PSA_SUCCESS;
+}
+
+/**
+ * \brief Drop the cached copy of an object, if any. Must be called before the
+ *        object is changed or removed in NVM3.
+ */
+static void object_cache_invalidate(psa_storage_uid_t uid)
+{
+  for (size_t i = 0; i < SL_PSA_ITS_OBJECT_CACHE_ENTRIES; i++) {
+    if (its_object_cache[i].used && its_object_cache[i].uid == uid) {
+      object_cache_drop(&its_object_cache[i]);
+    }
+  }
+}
+
+/**
+ * \brief Insert a freshly decrypted and authenticated object in the cache,
+ *        evicting the least recently used objects to stay within the RAM budget.
+ *
+ * \note Failing to cache an object is not an error, the object is simply read
+ *       from NVM3 again next time.
+ */
+static void object_cache_insert(psa_storage_uid_t uid,
+                                psa_storage_create_flags_t flags,
+                                const uint8_t *data,
+                                size_t size)
+{
+  sli_its_object_cache_entry_t *entry;
+
+  if (size == 0U || size > SL_PSA_ITS_OBJECT_CACHE_SIZE) {
+    return;
+  }
+
+  object_cache_invalidate(uid);
+
+  for (;;) {
+    sli_its_object_cache_entry_t *lru = NULL;
+    entry = NULL;
+
+    for (size_t i = 0; i < SL_PSA_ITS_OBJECT_CACHE_ENTRIES; i++) {
+      if (!its_object_cache[i].used) {
+        entry = &its_object_cache[i];
+      } else if (lru == NULL
+                 || (int32_t)(its_object_cache[i].last_use - lru->last_use) < 0) {
+        lru = &its_object_cache[i];
+      }
+    }
+
+    if (entry != NULL && (its_object_cache_used_size + size) <= SL_PSA_ITS_OBJECT_CACHE_SIZE) {
+      break;
+    }
+
+    // Out of entries or RAM budget, evict the least recently used object.
+    object_cache_drop(lru);
+    its_object_cache_stats.evictions++;
+  }
+
+  entry->data = mbedtls_calloc(1, size);
+  if (entry->data == NULL) {
+    return;
+  }
+  memcpy(entry->data, data, size);
+  entry->used = true;
+  entry->uid = uid;
+  entry->flags = flags;
+  entry->size = size;
+  entry->last_use = ++its_object_cache_clock;
+  its_object_cache_used_size += size;
+}
+#endif // defined(SLI_PSA_ITS_ENCRYPTED) && (SL_PSA_ITS_OBJECT_CACHE_SIZE > 0)
+
 // -------------------------------------
 // Defines
 
@@ -934,6 +1115,9 @@ psa_status_t psa_its_set(psa_storage_uid_t uid,
   }
 #endif
   sli_its_acquire_mutex();
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_invalidate(uid);
+#endif
   nvm3_ObjectKey_t nvm3_object_id = prepare_its_get_nvm3_id(uid);
   Ecode_t status;
   psa_status_t ret = PSA_SUCCESS;
@@ -1106,6 +1290,13 @@ psa_status_t psa_its_get(psa_storage_uid_t uid,
   size_t its_file_offset = 0;
 
   sli_its_acquire_mutex();
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  const sli_its_object_cache_entry_t *cache_entry = object_cache_lookup(uid);
+  if (cache_entry != NULL) {
+    ret = object_cache_read(cache_entry, data_offset, data_length, p_data, p_data_length);
+    goto exit;
+  }
+#endif
   nvm3_ObjectKey_t nvm3_object_id = prepare_its_get_nvm3_id(uid);
   if (nvm3_object_id > SLI_PSA_ITS_NVM3_RANGE_END) {
     ret = PSA_ERROR_DOES_NOT_EXIST;
@@ -1206,6 +1397,10 @@ psa_status_t psa_its_get(psa_storage_uid_t uid,
     goto exit;
   }
 
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_insert(uid, its_file_meta.flags, blob->data, plaintext_length);
+#endif
+
   if (*p_data_length > 0) {
     memcpy(p_data, blob->data + data_offset, *p_data_length);
   }
@@ -1370,6 +1565,9 @@ psa_status_t psa_its_remove(psa_storage_uid_t uid)
   }
 #endif
 
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_invalidate(uid);
+#endif
   status = nvm3_deleteObject(nvm3_defaultHandle, nvm3_object_id);
 
   if (status == ECODE_NVM3_OK) {
@@ -1431,6 +1629,11 @@ psa_status_t sli_psa_its_change_key_id(mbedtls_svc_key_id_t old_id,
 #endif
   sli_its_acquire_mutex();
 
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_invalidate(old_uid);
+  object_cache_invalidate(new_uid);
+#endif
+
   // Check whether the key to migrate exists on disk
   nvm3_ObjectKey_t nvm3_object_id = prepare_its_get_nvm3_id(old_uid);
   if (nvm3_object_id > SLI_PSA_ITS_NVM3_RANGE_END) {
@@ -2248,6 +2451,9 @@ psa_status_t psa_its_set_v1(psa_storage_uid_t uid,
   sli_its_file_meta_v2_t its_file_meta_v2;
 
   sli_its_acquire_mutex();
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_invalidate(uid);
+#endif
   psa_status = find_nvm3_id(uid, true, &its_file_meta_v2, NULL, NULL,
                             &nvm3_object_id);
   if (psa_status != PSA_SUCCESS) {
@@ -2869,6 +3075,9 @@ psa_status_t psa_its_set(psa_storage_uid_t uid,
   its_file_meta = (sli_its_file_meta_v2_t *)its_file_buffer;
 
   sli_its_acquire_mutex();
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_invalidate(uid);
+#endif
   psa_status = find_nvm3_id(uid, true, its_file_meta, NULL, NULL, &nvm3_object_id);
   if (psa_status != PSA_SUCCESS) {
     if (psa_status == PSA_ERROR_DOES_NOT_EXIST) {
@@ -2980,6 +3189,13 @@ psa_status_t psa_its_get(psa_storage_uid_t uid,
   nvm3_ObjectKey_t nvm3_object_id;
 
   sli_its_acquire_mutex();
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  const sli_its_object_cache_entry_t *cache_entry = object_cache_lookup(uid);
+  if (cache_entry != NULL) {
+    psa_status = object_cache_read(cache_entry, data_offset, data_length, p_data, p_data_length);
+    goto exit;
+  }
+#endif
   psa_status = find_nvm3_id(uid, false, &its_file_meta, &its_file_offset, &its_file_size, &nvm3_object_id);
   if (psa_status != PSA_SUCCESS) {
     goto exit;
@@ -3066,6 +3282,10 @@ psa_status_t psa_its_get(psa_storage_uid_t uid,
     goto exit;
   }
 
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_insert(uid, its_file_meta.flags, blob->data, plaintext_length);
+#endif
+
   if (*p_data_length > 0) {
     memcpy(p_data, blob->data + data_offset, *p_data_length);
   }
@@ -3174,6 +3394,9 @@ psa_status_t psa_its_remove(psa_storage_uid_t uid)
     psa_status = PSA_ERROR_NOT_PERMITTED;
     goto exit;
   }
+#if defined(SLI_PSA_ITS_OBJECT_CACHE)
+  object_cache_invalidate(uid);
+#endif
   status = nvm3_deleteObject(nvm3_defaultHandle, nvm3_object_id);
   if (status == ECODE_NVM3_OK) {
     // Power-loss might occur, however upon boot, the look-up table will be
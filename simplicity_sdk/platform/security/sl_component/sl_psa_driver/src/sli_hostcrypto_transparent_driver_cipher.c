@@ -108,6 +108,237 @@ static psa_status_t driver_can_handle(const psa_key_attributes_t *attributes,
 }
 #endif
 
+#if defined(PSA_WANT_KEY_TYPE_AES) && defined(PSA_WANT_ALG_ECB_NO_PADDING)
+// Multipart ECB update. The accelerator keeps no ECB state between jobs, so
+// the block completed from buffered input and all the full blocks of this
+// input are processed in a single job. Input which does not complete a block
+// is only buffered, without reserving the accelerator.
+static psa_status_t cipher_update_ecb(
+  sli_hostcrypto_transparent_cipher_operation_t *operation,
+  const uint8_t *input,
+  size_t input_length,
+  uint8_t *output,
+  size_t output_size,
+  size_t *output_length)
+{
+  struct sxblkcipher cipher;
+  int sx_status = SX_ERR_UNITIALIZED_OBJ;
+  size_t buffered = operation->processed_length % 16;
+  size_t head = 0;
+  size_t bulk;
+  size_t tail;
+  size_t total_output;
+  uint8_t tail_block[16];
+  const uint8_t *bulk_input;
+  uint8_t *bulk_output;
+
+  *output_length = 0;
+
+  if (buffered + input_length < 16) {
+    memcpy(&operation->block[buffered], input, input_length);
+    operation->processed_length += input_length;
+    return PSA_SUCCESS;
+  }
+
+  if (buffered != 0) {
+    head = 16 - buffered;
+  }
+  bulk = ((input_length - head) / 16) * 16;
+  tail = input_length - head - bulk;
+  total_output = ((head != 0) ? 16 : 0) + bulk;
+  if (output_size < total_output) {
+    return PSA_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  // Complete the buffered block and keep the trailing partial block before
+  // any output is written.
+  memcpy(&operation->block[buffered], input, head);
+  memcpy(tail_block, &input[head + bulk], tail);
+
+  // Our drivers only support full or no overlap between input and output
+  // buffers. So when the output overlaps the full blocks, move them to where
+  // their output goes and process them in place.
+  bulk_input = &input[head];
+  bulk_output = &output[total_output - bulk];
+  if ((bulk > 0)
+      && (output < (bulk_input + bulk))
+      && (bulk_input < (output + total_output))) {
+    memmove(bulk_output, bulk_input, bulk);
+    bulk_input = bulk_output;
+  }
+
+  if (sli_sxsymcrypt_lock_cryptomaster_selection(
+        SLI_SXSYMCRYPT_CRYPTOMASTER_HOSTSYMCRYPTO, false)) {
+    return PSA_ERROR_SERVICE_FAILURE;
+  }
+  if (operation->direction == SLI_HOSTCRYPTO_ENCRYPT) {
+    sx_status = sx_blkcipher_create_aesecb_enc(&cipher, &operation->key_ref);
+  } else {
+    sx_status = sx_blkcipher_create_aesecb_dec(&cipher, &operation->key_ref);
+  }
+  if (sli_sxsymcrypt_unlock_cryptomaster_selection()) {
+    return PSA_ERROR_SERVICE_FAILURE;
+  }
+  if (sx_status != SX_OK) {
+    return PSA_ERROR_HARDWARE_FAILURE;
+  }
+
+  if (head != 0) {
+    sx_status = sx_blkcipher_crypt(&cipher,
+                                   (const char *)operation->block,
+                                   16,
+                                   (char *)output);
+    if (sx_status != SX_OK) {
+      return PSA_ERROR_HARDWARE_FAILURE;
+    }
+  }
+  if (bulk > 0) {
+    sx_status = sx_blkcipher_crypt(&cipher,
+                                   (const char *)bulk_input,
+                                   bulk,
+                                   (char *)bulk_output);
+    if (sx_status != SX_OK) {
+      return PSA_ERROR_HARDWARE_FAILURE;
+    }
+  }
+  sx_status = sx_blkcipher_run(&cipher);
+  if (sx_status != SX_OK) {
+    return PSA_ERROR_HARDWARE_FAILURE;
+  }
+  sx_status = sx_blkcipher_wait(&cipher);
+  if (sx_status != SX_OK) {
+    return PSA_ERROR_HARDWARE_FAILURE;
+  }
+
+  memcpy(operation->block, tail_block, tail);
+  operation->processed_length += input_length;
+  *output_length = total_output;
+
+  return PSA_SUCCESS;
+}
+#endif // PSA_WANT_KEY_TYPE_AES && PSA_WANT_ALG_ECB_NO_PADDING
+
+#if defined(PSA_WANT_KEY_TYPE_AES) && defined(PSA_WANT_ALG_CTR)
+// Add a block count to a 128-bit big-endian counter block.
+static void ctr_add_blocks(uint8_t counter[16], size_t blocks)
+{
+  uint64_t carry = blocks;
+
+  for (int i = 15; (i >= 0) && (carry != 0); i--) {
+    carry += counter[i];
+    counter[i] = (uint8_t)carry;
+    carry >>= 8;
+  }
+}
+
+// Multipart CTR update. The operation keeps the next counter block in iv and,
+// when the previous input ended within a block, the rest of that keystream
+// block in block. Input is first combined with the keystream left over, then
+// the full blocks and the keystream of a trailing partial block are produced
+// in a single job. No accelerator state is saved between updates, and an
+// update served from the keystream left over runs no job at all.
+static psa_status_t cipher_update_ctr(
+  sli_hostcrypto_transparent_cipher_operation_t *operation,
+  const uint8_t *input,
+  size_t input_length,
+  uint8_t *output,
+  size_t output_size,
+  size_t *output_length)
+{
+  struct sxblkcipher cipher;
+  int sx_status = SX_ERR_UNITIALIZED_OBJ;
+  size_t used = operation->processed_length % 16;
+  size_t count;
+  size_t bulk;
+  size_t tail;
+
+  if (output_size < input_length) {
+    return PSA_ERROR_BUFFER_TOO_SMALL;
+  }
+
+  // Our drivers only support full or no overlap between input and output
+  // buffers. So in the case of partial overlap, copy the input buffer into
+  // the output buffer and process it in place as if the buffers fully
+  // overlapped.
+  if ((output > input) && (output < (input + input_length))) {
+    memmove(output, input, input_length);
+    input = output;
+  }
+
+  *output_length = input_length;
+
+  // Use up the keystream left over by the previous update.
+  if (used != 0) {
+    count = (input_length < (16 - used)) ? input_length : (16 - used);
+    for (size_t i = 0; i < count; i++) {
+      output[i] = input[i] ^ operation->block[used + i];
+    }
+    input += count;
+    output += count;
+    input_length -= count;
+    operation->processed_length += count;
+  }
+  if (input_length == 0) {
+    return PSA_SUCCESS;
+  }
+
+  bulk = (input_length / 16) * 16;
+  tail = input_length - bulk;
+
+  // CTR decryption is the same keystream operation as encryption.
+  if (sli_sxsymcrypt_lock_cryptomaster_selection(
+        SLI_SXSYMCRYPT_CRYPTOMASTER_HOSTSYMCRYPTO, false)) {
+    return PSA_ERROR_SERVICE_FAILURE;
+  }
+  sx_status = sx_blkcipher_create_aesctr_enc(&cipher,
+                                             &operation->key_ref,
+                                             (const char *)operation->iv);
+  if (sli_sxsymcrypt_unlock_cryptomaster_selection()) {
+    return PSA_ERROR_SERVICE_FAILURE;
+  }
+  if (sx_status != SX_OK) {
+    return PSA_ERROR_HARDWARE_FAILURE;
+  }
+
+  if (bulk > 0) {
+    sx_status = sx_blkcipher_crypt(&cipher,
+                                   (const char *)input,
+                                   bulk,
+                                   (char *)output);
+    if (sx_status != SX_OK) {
+      return PSA_ERROR_HARDWARE_FAILURE;
+    }
+  }
+  if (tail > 0) {
+    // Encrypting a zero block yields the keystream of the trailing input.
+    memset(operation->block, 0, sizeof(operation->block));
+    sx_status = sx_blkcipher_crypt(&cipher,
+                                   (const char *)operation->block,
+                                   16,
+                                   (char *)operation->block);
+    if (sx_status != SX_OK) {
+      return PSA_ERROR_HARDWARE_FAILURE;
+    }
+  }
+  sx_status = sx_blkcipher_run(&cipher);
+  if (sx_status != SX_OK) {
+    return PSA_ERROR_HARDWARE_FAILURE;
+  }
+  sx_status = sx_blkcipher_wait(&cipher);
+  if (sx_status != SX_OK) {
+    return PSA_ERROR_HARDWARE_FAILURE;
+  }
+
+  for (size_t i = 0; i < tail; i++) {
+    output[bulk + i] = input[bulk + i] ^ operation->block[i];
+  }
+  ctr_add_blocks(operation->iv, (bulk / 16) + ((tail != 0) ? 1 : 0));
+  operation->processed_length += input_length;
+
+  return PSA_SUCCESS;
+}
+#endif // PSA_WANT_KEY_TYPE_AES && PSA_WANT_ALG_CTR
+
 // -----------------------------------------------------------------------------
 // Entry Point Definitions
 
@@ -738,13 +969,24 @@ psa_status_t sli_hostcrypto_transparent_cipher_set_iv(
     return PSA_ERROR_BAD_STATE;
   }
 
-  if (operation->cipher.dma.regs != 0) {
+  if ((operation->cipher.dma.regs != 0) || operation->iv_set) {
     // cipher context was set previously
     return PSA_ERROR_BAD_STATE;
   }
 
   memcpy(operation->iv, iv, iv_length);
 
+#if defined(PSA_WANT_ALG_CTR)
+  if (operation->alg == PSA_ALG_CTR) {
+    // The counter block is kept in the operation, each update runs its own job.
+    if (iv_length != 16) {
+      return PSA_ERROR_INVALID_ARGUMENT;
+    }
+    operation->iv_set = true;
+    return PSA_SUCCESS;
+  }
+#endif
+
   if (sli_sxsymcrypt_lock_cryptomaster_selection(
         SLI_SXSYMCRYPT_CRYPTOMASTER_HOSTSYMCRYPTO, false)) {
     return PSA_ERROR_SERVICE_FAILURE;
@@ -757,17 +999,6 @@ psa_status_t sli_hostcrypto_transparent_cipher_set_iv(
       return PSA_ERROR_INVALID_ARGUMENT;
     }
     switch (operation->alg) {
-#if defined(PSA_WANT_ALG_CTR)
-      case PSA_ALG_CTR:
-        if (operation->direction == SLI_HOSTCRYPTO_ENCRYPT) {
-          sx_status = sx_blkcipher_create_aesctr_enc(
-            &operation->cipher, &operation->key_ref, (const char *)operation->iv);
-        } else {
-          sx_status = sx_blkcipher_create_aesctr_dec(
-            &operation->cipher, &operation->key_ref, (const char *)operation->iv);
-        }
-        break;
-#endif
 #if defined(PSA_WANT_ALG_CFB)
       case PSA_ALG_CFB:
         if (operation->direction == SLI_HOSTCRYPTO_ENCRYPT) {
@@ -868,41 +1099,31 @@ psa_status_t sli_hostcrypto_transparent_cipher_update(
     return PSA_SUCCESS;
   }
 
-  if (!operation->cipher.dma.regs
-      && !(operation->cipher.dma.dmamem.cfg & SLI_HOSTCRYPTO_BLKCIPHER_CTX_SAVE)) {
-    if (operation->alg == PSA_ALG_ECB_NO_PADDING) {
-      // ECB mode does not have context saving so we need to create a new
-      // operation everytime the update function is called
-      if (sli_sxsymcrypt_lock_cryptomaster_selection(
-            SLI_SXSYMCRYPT_CRYPTOMASTER_HOSTSYMCRYPTO, false)) {
-        return PSA_ERROR_SERVICE_FAILURE;
-      }
-      if (operation->direction == SLI_HOSTCRYPTO_ENCRYPT) {
-        sx_status = sx_blkcipher_create_aesecb_enc(&operation->cipher,
-                                                   &operation->key_ref);
-      } else if (operation->direction == SLI_HOSTCRYPTO_DECRYPT) {
-        sx_status = sx_blkcipher_create_aesecb_dec(&operation->cipher,
-                                                   &operation->key_ref);
-      }
-      if (sli_sxsymcrypt_unlock_cryptomaster_selection()) {
-        return PSA_ERROR_SERVICE_FAILURE;
-      }
-      if (sx_status != SX_OK) {
-        return PSA_ERROR_HARDWARE_FAILURE;
-      }
-    } else {
+#if defined(PSA_WANT_ALG_ECB_NO_PADDING)
+  if (operation->alg == PSA_ALG_ECB_NO_PADDING) {
+    return cipher_update_ecb(operation, input, input_length, output, output_size, output_length);
+  }
+#endif
+#if defined(PSA_WANT_ALG_CTR)
+  if (operation->alg == PSA_ALG_CTR) {
+    if (!operation->iv_set) {
       return PSA_ERROR_BAD_STATE;
     }
+    return cipher_update_ctr(operation, input, input_length, output, output_size, output_length);
+  }
+#endif
+
+  if (!operation->cipher.dma.regs
+      && !(operation->cipher.dma.dmamem.cfg & SLI_HOSTCRYPTO_BLKCIPHER_CTX_SAVE)) {
+    return PSA_ERROR_BAD_STATE;
   }
 
   bool lagging = true;
   switch (operation->alg) {
-    case PSA_ALG_ECB_NO_PADDING:
     case PSA_ALG_CBC_NO_PADDING:
     case PSA_ALG_CBC_PKCS7:
       lagging = true;
       break;
-    case PSA_ALG_CTR:
     case PSA_ALG_CFB:
     case PSA_ALG_OFB:
       lagging = false;
@@ -1000,11 +1221,7 @@ psa_status_t sli_hostcrypto_transparent_cipher_update(
         if (sx_status != SX_OK) {
           return PSA_ERROR_HARDWARE_FAILURE;
         }
-        if (operation->alg == PSA_ALG_ECB_NO_PADDING) {
-          sx_status = sx_blkcipher_run(&operation->cipher);
-        } else {
-          sx_status = sx_blkcipher_save_state(&operation->cipher);
-        }
+        sx_status = sx_blkcipher_save_state(&operation->cipher);
         if (sx_status != SX_OK) {
           return PSA_ERROR_HARDWARE_FAILURE;
         }
@@ -1076,19 +1293,7 @@ psa_status_t sli_hostcrypto_transparent_cipher_update(
               SLI_SXSYMCRYPT_CRYPTOMASTER_HOSTSYMCRYPTO, false)) {
           return PSA_ERROR_SERVICE_FAILURE;
         }
-        if (operation->alg == PSA_ALG_ECB_NO_PADDING) {
-          // ECB mode does not have context saving so we need to create a new
-          // operation everytime the update function is called
-          if (operation->direction == SLI_HOSTCRYPTO_ENCRYPT) {
-            sx_status = sx_blkcipher_create_aesecb_enc(&operation->cipher,
-                                                       &operation->key_ref);
-          } else if (operation->direction == SLI_HOSTCRYPTO_DECRYPT) {
-            sx_status = sx_blkcipher_create_aesecb_dec(&operation->cipher,
-                                                       &operation->key_ref);
-          }
-        } else {
-          sx_status = sx_blkcipher_resume_state(&operation->cipher);
-        }
+        sx_status = sx_blkcipher_resume_state(&operation->cipher);
         if (sli_sxsymcrypt_unlock_cryptomaster_selection()) {
           return PSA_ERROR_SERVICE_FAILURE;
         }
@@ -1103,11 +1308,7 @@ psa_status_t sli_hostcrypto_transparent_cipher_update(
       if (sx_status != SX_OK) {
         return PSA_ERROR_HARDWARE_FAILURE;
       }
-      if (operation->alg == PSA_ALG_ECB_NO_PADDING) {
-        sx_status = sx_blkcipher_run(&operation->cipher);
-      } else {
-        sx_status = sx_blkcipher_save_state(&operation->cipher);
-      }
+      sx_status = sx_blkcipher_save_state(&operation->cipher);
       if (sx_status != SX_OK) {
         return PSA_ERROR_HARDWARE_FAILURE;
       }
@@ -0,0 +1,240 @@
+/***************************************************************************//**
+ * @file
+ * @brief Blocks per second of the HostCryptoSubSystem AES ECB and CTR paths.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+// On-target benchmark, it needs the HostCryptoSubSystem accelerator. Add this
+// file to an application for a device with SLI_MBEDTLS_DEVICE_HC, with stdio
+// retargeted, and call sli_hostcrypto_cipher_benchmark() once PSA Crypto is
+// initialized. The driver entry points are called directly so the figures do
+// not include the PSA core dispatch.
+//
+// Each case encrypts the same buffer in spans of a given size, either with one
+// single-shot call per span (the per-call path) or with one multipart update
+// per span.
+
+#include "sli_psa_driver_features.h"
+
+#if defined(SLI_MBEDTLS_DEVICE_HC)
+
+#include "em_device.h"
+#include "psa/crypto.h"
+#include "sli_hostcrypto_transparent_types.h"
+#include "sli_hostcrypto_transparent_functions.h"
+
+#include <stdio.h>
+#include <string.h>
+
+// -----------------------------------------------------------------------------
+// Defines
+
+#define BENCHMARK_BLOCKS  1024
+
+// -----------------------------------------------------------------------------
+// Static Variables
+
+static const uint8_t key[16] = {
+  0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6,
+  0xab, 0xf7, 0x15, 0x88, 0x09, 0xcf, 0x4f, 0x3c
+};
+
+static uint8_t input[BENCHMARK_BLOCKS * 16];
+static uint8_t output[BENCHMARK_BLOCKS * 16];
+
+// -----------------------------------------------------------------------------
+// Static Function Definitions
+
+static void cycle_counter_start(void)
+{
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CYCCNT = 0;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+}
+
+static uint32_t cycle_counter_read(void)
+{
+  return DWT->CYCCNT;
+}
+
+static void report(const char *name, size_t span, uint32_t cycles)
+{
+  uint64_t blocks_per_second = 0;
+
+  if (cycles != 0) {
+    blocks_per_second = ((uint64_t)BENCHMARK_BLOCKS * SystemCoreClock) / cycles;
+  }
+  printf("%-24s %3u B/call %10lu cycles %8lu blocks/s\n",
+         name,
+         (unsigned int)span,
+         (unsigned long)cycles,
+         (unsigned long)blocks_per_second);
+}
+
+// Counter block at a byte offset of a CTR stream starting at a zero counter.
+static void ctr_counter_block(uint8_t counter[16], size_t offset)
+{
+  size_t block = offset / 16;
+
+  memset(counter, 0, 16);
+  for (int i = 15; (i >= 0) && (block != 0); i--) {
+    counter[i] = (uint8_t)block;
+    block >>= 8;
+  }
+}
+
+static psa_status_t bench_single_shot(const psa_key_attributes_t *attributes,
+                                      psa_algorithm_t alg,
+                                      size_t span,
+                                      uint32_t *cycles)
+{
+  psa_status_t status = PSA_SUCCESS;
+  uint8_t counter[16];
+  size_t output_length;
+  uint32_t start;
+
+  start = cycle_counter_read();
+  for (size_t offset = 0; offset < sizeof(input); offset += span) {
+    ctr_counter_block(counter, offset);
+    status = sli_hostcrypto_transparent_cipher_encrypt(attributes,
+                                                       key,
+                                                       sizeof(key),
+                                                       alg,
+                                                       counter,
+                                                       (alg == PSA_ALG_CTR) ? 16 : 0,
+                                                       &input[offset],
+                                                       span,
+                                                       &output[offset],
+                                                       span,
+                                                       &output_length);
+    if (status != PSA_SUCCESS) {
+      return status;
+    }
+  }
+  *cycles = cycle_counter_read() - start;
+
+  return status;
+}
+
+static psa_status_t bench_multipart(const psa_key_attributes_t *attributes,
+                                    psa_algorithm_t alg,
+                                    size_t span,
+                                    uint32_t *cycles)
+{
+  sli_hostcrypto_transparent_cipher_operation_t operation;
+  psa_status_t status;
+  uint8_t counter[16];
+  size_t output_length;
+  size_t offset = 0;
+  uint32_t start;
+
+  memset(&operation, 0, sizeof(operation));
+
+  start = cycle_counter_read();
+  status = sli_hostcrypto_transparent_cipher_encrypt_setup(&operation,
+                                                           attributes,
+                                                           key,
+                                                           sizeof(key),
+                                                           alg);
+  if ((status == PSA_SUCCESS) && (alg == PSA_ALG_CTR)) {
+    ctr_counter_block(counter, 0);
+    status = sli_hostcrypto_transparent_cipher_set_iv(&operation,
+                                                      counter,
+                                                      sizeof(counter));
+  }
+  while ((status == PSA_SUCCESS) && (offset < sizeof(input))) {
+    status = sli_hostcrypto_transparent_cipher_update(&operation,
+                                                      &input[offset],
+                                                      span,
+                                                      &output[offset],
+                                                      sizeof(output) - offset,
+                                                      &output_length);
+    offset += span;
+  }
+  if (status == PSA_SUCCESS) {
+    status = sli_hostcrypto_transparent_cipher_finish(&operation,
+                                                      NULL,
+                                                      0,
+                                                      &output_length);
+  }
+  *cycles = cycle_counter_read() - start;
+
+  if (status != PSA_SUCCESS) {
+    sli_hostcrypto_transparent_cipher_abort(&operation);
+  }
+
+  return status;
+}
+
+// -----------------------------------------------------------------------------
+// Global Function Definitions
+
+psa_status_t sli_hostcrypto_cipher_benchmark(void)
+{
+  static const struct {
+    const char *name;
+    psa_algorithm_t alg;
+    size_t span;
+    bool multipart;
+  } cases[] = {
+    { "ECB single-shot", PSA_ALG_ECB_NO_PADDING, 16, false },
+    { "ECB multipart", PSA_ALG_ECB_NO_PADDING, 16, true },
+    { "ECB single-shot", PSA_ALG_ECB_NO_PADDING, 128, false },
+    { "ECB multipart", PSA_ALG_ECB_NO_PADDING, 128, true },
+    { "CTR single-shot", PSA_ALG_CTR, 16, false },
+    { "CTR multipart", PSA_ALG_CTR, 16, true },
+    { "CTR multipart", PSA_ALG_CTR, 4, true },
+  };
+  psa_key_attributes_t attributes = PSA_KEY_ATTRIBUTES_INIT;
+  psa_status_t status;
+  uint32_t cycles;
+
+  psa_set_key_type(&attributes, PSA_KEY_TYPE_AES);
+  psa_set_key_bits(&attributes, 128);
+
+  for (size_t i = 0; i < sizeof(input); i++) {
+    input[i] = (uint8_t)i;
+  }
+
+  cycle_counter_start();
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+    if (cases[i].multipart) {
+      status = bench_multipart(&attributes, cases[i].alg, cases[i].span, &cycles);
+    } else {
+      status = bench_single_shot(&attributes, cases[i].alg, cases[i].span, &cycles);
+    }
+    if (status != PSA_SUCCESS) {
+      printf("%s: failed, status %ld\n", cases[i].name, (long)status);
+      return status;
+    }
+    report(cases[i].name, cases[i].span, cycles);
+  }
+
+  return PSA_SUCCESS;
+}
+
+#endif // SLI_MBEDTLS_DEVICE_HC
@@ -36,6 +36,7 @@
 #include "sl_status.h"
 #include "sl_enum.h"
 #include "sl_device_clock.h"
+#include "sl_slist.h"
 #include "sl_code_classification.h"
 
 #ifdef __cplusplus
@@ -260,6 +261,17 @@ extern "C" {
  * sl_clock_manager_get_rco_calibration_count() can be called to retrieve the
  * calibration process result.
  *
+ * ### Clock Tree Changes
+ * Clock branch frequencies returned by sl_clock_manager_get_clock_branch_frequency()
+ * are cached and only decoded again from the CMU registers after the clock tree
+ * changed. Clock Manager functions changing the clock tree, such as
+ * slx_clock_manager_set_sysclk_source(), invalidate the cache themselves. Code
+ * modifying the clock tree directly must call
+ * sl_clock_manager_notify_clock_tree_change() afterwards. Drivers deriving
+ * settings like baud rates from a clock branch frequency can register a callback
+ * with sl_clock_manager_subscribe_clock_tree_change() to recompute them only
+ * when the clock tree changes.
+ *
  * @{
  ******************************************************************************/
 
@@ -301,6 +313,16 @@ SL_ENUM(sl_clock_manager_clock_calibration_t) {
   SL_CLOCK_MANAGER_CLOCK_CALIBRATION_ULFRCO      ///< Clock Calibration ULFRCO
 };
 
+/// Callback called after the clock tree changed.
+typedef void (*sl_clock_manager_clock_tree_change_callback_t)(void *context);
+
+/// Clock tree change subscription handle.
+typedef struct {
+  sl_slist_node_t node;                                    ///< List node.
+  sl_clock_manager_clock_tree_change_callback_t callback;  ///< Function called after the clock tree changed.
+  void *context;                                           ///< Context passed to the callback.
+} sl_clock_manager_clock_tree_change_handle_t;
+
 // -----------------------------------------------------------------------------
 // Prototypes
 
@@ -681,6 +703,43 @@ sl_status_t slx_clock_manager_set_sysclk_source(sl_oscillator_t oscillator);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_CLOCK_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 sl_status_t sl_clock_manager_get_sysclk_source(sl_oscillator_t *oscillator);
 
+/***************************************************************************//**
+ * Registers a callback called after the clock tree changed.
+ *
+ * @param[in] handle    Subscription handle. Must stay allocated until
+ *                      unsubscribed.
+ *
+ * @param[in] callback  Function called after the clock tree changed.
+ *
+ * @param[in] context   Context passed to the callback.
+ *
+ * @note The callback is called from the context that changed the clock tree.
+ *       It can unsubscribe its own handle.
+ ******************************************************************************/
+void sl_clock_manager_subscribe_clock_tree_change(sl_clock_manager_clock_tree_change_handle_t *handle,
+                                                  sl_clock_manager_clock_tree_change_callback_t callback,
+                                                  void *context);
+
+/***************************************************************************//**
+ * Unregisters a clock tree change callback.
+ *
+ * @param[in] handle  Subscription handle which must have been registered
+ *                    previously.
+ ******************************************************************************/
+void sl_clock_manager_unsubscribe_clock_tree_change(sl_clock_manager_clock_tree_change_handle_t *handle);
+
+/***************************************************************************//**
+ * Signals a clock tree change made outside the Clock Manager.
+ *
+ * Invalidates the cached clock branch frequencies and calls the registered
+ * clock tree change callbacks.
+ *
+ * @note Must be called after changing clock selects, dividers or oscillator
+ *       frequencies (for example the DPLL) without going through the Clock
+ *       Manager.
+ ******************************************************************************/
+void sl_clock_manager_notify_clock_tree_change(void);
+
 /** @} (end addtogroup clock_manager) */
 
 #ifdef __cplusplus
@@ -58,6 +58,16 @@ __WEAK void sli_clock_manager_notify_hfxo_ready(void);
  ******************************************************************************/
 sl_status_t sli_clock_manager_get_hfxo_average_startup_time(uint32_t *val);
 
+/***************************************************************************//**
+ * Invalidates the cached clock branch frequencies without notifying the
+ * clock tree change subscribers.
+ *
+ * @note Used by code that temporarily changes the clock tree and restores it
+ *       afterwards, like the power manager around deep sleep. Can be called
+ *       from interrupt context and with interrupts disabled.
+ ******************************************************************************/
+void sli_clock_manager_invalidate_clock_branch_cache(void);
+
 #ifdef __cplusplus
 }
 #endif
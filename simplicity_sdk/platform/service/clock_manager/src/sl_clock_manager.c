@@ -32,14 +32,75 @@
 #include "sli_clock_manager.h"
 #include "sli_clock_manager_hal.h"
 #include "sl_assert.h"
+#include "sl_core.h"
+#include "sl_slist.h"
 #include "cmsis_compiler.h"
 
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+// Number of words of the clock branch frequency cache validity bitmap.
+#define CLOCK_BRANCH_VALID_WORD_COUNT  (((uint32_t)SL_CLOCK_BRANCH_INVALID + 31U) / 32U)
+
+/*******************************************************************************
+ *******************************   LOCAL VARIABLES   ***************************
+ ******************************************************************************/
+
+// Clock branch frequencies, valid when their bit is set in clock_branch_valid.
+static uint32_t clock_branch_frequency[SL_CLOCK_BRANCH_INVALID];
+static uint32_t clock_branch_valid[CLOCK_BRANCH_VALID_WORD_COUNT];
+
+// Incremented on every invalidation so that a frequency decoded while the
+// clock tree changed is not cached.
+static uint32_t clock_tree_generation;
+
+// Clock tree change subscribers.
+static sl_slist_node_t *clock_tree_change_list = NULL;
+
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Invalidates the cached clock branch frequencies and notifies subscribers.
+ *
+ * @note The next subscriber is fetched before calling the current one, so a
+ *       callback can unsubscribe its own handle.
+ ******************************************************************************/
+static void clock_tree_changed(void)
+{
+  sl_slist_node_t *node;
+  sl_slist_node_t *next;
+  sl_clock_manager_clock_tree_change_handle_t *handle;
+  CORE_DECLARE_IRQ_STATE;
+
+  sli_clock_manager_invalidate_clock_branch_cache();
+
+  CORE_ENTER_CRITICAL();
+  node = clock_tree_change_list;
+  CORE_EXIT_CRITICAL();
+
+  while (node != NULL) {
+    CORE_ENTER_CRITICAL();
+    next = node->node;
+    CORE_EXIT_CRITICAL();
+
+    handle = SL_SLIST_ENTRY(node, sl_clock_manager_clock_tree_change_handle_t, node);
+    handle->callback(handle->context);
+    node = next;
+  }
+}
+
 /***************************************************************************//**
  * Performs Clock Manager runtime initialization.
  ******************************************************************************/
 sl_status_t sl_clock_manager_runtime_init(void)
 {
-  return sli_clock_manager_hal_runtime_init();
+  sl_status_t status = sli_clock_manager_hal_runtime_init();
+
+  clock_tree_changed();
+  return status;
 }
 
 /***************************************************************************//**
@@ -74,11 +135,43 @@ sl_status_t sl_clock_manager_get_oscillator_precision(sl_oscillator_t oscillator
 sl_status_t sl_clock_manager_get_clock_branch_frequency(sl_clock_branch_t clock_branch,
                                                         uint32_t          *frequency)
 {
+  sl_status_t status;
+  uint32_t index = (uint32_t)clock_branch;
+  uint32_t mask;
+  uint32_t generation;
+  CORE_DECLARE_IRQ_STATE;
+
   if (frequency == NULL) {
     return SL_STATUS_NULL_POINTER;
   }
 
-  return sli_clock_manager_hal_get_clock_branch_frequency(clock_branch, frequency);
+  if (index >= (uint32_t)SL_CLOCK_BRANCH_INVALID) {
+    return sli_clock_manager_hal_get_clock_branch_frequency(clock_branch, frequency);
+  }
+  mask = 1UL << (index % 32U);
+
+  CORE_ENTER_ATOMIC();
+  if ((clock_branch_valid[index / 32U] & mask) != 0U) {
+    *frequency = clock_branch_frequency[index];
+    CORE_EXIT_ATOMIC();
+    return SL_STATUS_OK;
+  }
+  generation = clock_tree_generation;
+  CORE_EXIT_ATOMIC();
+
+  status = sli_clock_manager_hal_get_clock_branch_frequency(clock_branch, frequency);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  CORE_ENTER_ATOMIC();
+  if (generation == clock_tree_generation) {
+    clock_branch_frequency[index] = *frequency;
+    clock_branch_valid[index / 32U] |= mask;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return SL_STATUS_OK;
 }
 
 /***************************************************************************//**
@@ -128,7 +221,12 @@ sl_status_t sl_clock_manager_set_gpio_clock_output(sl_clock_manager_export_clock
 sl_status_t sl_clock_manager_set_rc_oscillator_calibration(sl_oscillator_t oscillator,
                                                            uint32_t        val)
 {
-  return sli_clock_manager_hal_set_rc_oscillator_calibration(oscillator, val);
+  sl_status_t status = sli_clock_manager_hal_set_rc_oscillator_calibration(oscillator, val);
+
+  if (status == SL_STATUS_OK) {
+    clock_tree_changed();
+  }
+  return status;
 }
 
 /***************************************************************************//**
@@ -271,7 +369,12 @@ sl_status_t sl_clock_manager_get_rco_calibration_count(uint32_t *count)
  ******************************************************************************/
 sl_status_t slx_clock_manager_set_sysclk_source(sl_oscillator_t oscillator)
 {
-  return sli_clock_manager_hal_set_sysclk_source(oscillator);
+  sl_status_t status = sli_clock_manager_hal_set_sysclk_source(oscillator);
+
+  if (status == SL_STATUS_OK) {
+    clock_tree_changed();
+  }
+  return status;
 }
 
 /***************************************************************************//**
@@ -311,7 +414,12 @@ __WEAK void sl_clock_manager_hfxo_notify_consecutive_failed_startups(void)
  ******************************************************************************/
 sl_status_t sl_clock_manager_set_ext_flash_clk(sl_oscillator_t oscillator)
 {
-  return sli_clock_manager_hal_set_ext_flash_clk(oscillator);
+  sl_status_t status = sli_clock_manager_hal_set_ext_flash_clk(oscillator);
+
+  if (status == SL_STATUS_OK) {
+    clock_tree_changed();
+  }
+  return status;
 }
 
 /***************************************************************************//**
@@ -321,3 +429,58 @@ sl_status_t sl_clock_manager_get_ext_flash_clk(sl_oscillator_t *oscillator)
 {
   return sli_clock_manager_hal_get_ext_flash_clk(oscillator);
 }
+
+/***************************************************************************//**
+ * Registers a callback called after the clock tree changed.
+ ******************************************************************************/
+void sl_clock_manager_subscribe_clock_tree_change(sl_clock_manager_clock_tree_change_handle_t *handle,
+                                                  sl_clock_manager_clock_tree_change_callback_t callback,
+                                                  void *context)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT((handle != NULL) && (callback != NULL));
+
+  handle->callback = callback;
+  handle->context = context;
+  CORE_ENTER_CRITICAL();
+  sl_slist_push(&clock_tree_change_list, &handle->node);
+  CORE_EXIT_CRITICAL();
+}
+
+/***************************************************************************//**
+ * Unregisters a clock tree change callback.
+ ******************************************************************************/
+void sl_clock_manager_unsubscribe_clock_tree_change(sl_clock_manager_clock_tree_change_handle_t *handle)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  EFM_ASSERT(handle != NULL);
+
+  CORE_ENTER_CRITICAL();
+  sl_slist_remove(&clock_tree_change_list, &handle->node);
+  CORE_EXIT_CRITICAL();
+}
+
+/***************************************************************************//**
+ * Invalidates the cached clock branch frequencies.
+ ******************************************************************************/
+void sli_clock_manager_invalidate_clock_branch_cache(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  for (uint32_t i = 0; i < CLOCK_BRANCH_VALID_WORD_COUNT; i++) {
+    clock_branch_valid[i] = 0;
+  }
+  clock_tree_generation++;
+  CORE_EXIT_ATOMIC();
+}
+
+/***************************************************************************//**
+ * Signals a clock tree change made outside the Clock Manager.
+ ******************************************************************************/
+void sl_clock_manager_notify_clock_tree_change(void)
+{
+  clock_tree_changed();
+}
@@ -29,6 +29,7 @@
  ******************************************************************************/
 
 #include "sl_clock_manager_init.h"
+#include "sl_clock_manager.h"
 #include "sli_clock_manager_init_hal.h"
 
 /***************************************************************************//**
@@ -36,5 +37,9 @@
  ******************************************************************************/
 sl_status_t sl_clock_manager_init(void)
 {
-  return sli_clock_manager_hal_init();
+  sl_status_t status = sli_clock_manager_hal_init();
+
+  // Drop frequencies that may have been cached before the clock tree was set up.
+  sl_clock_manager_notify_clock_tree_change();
+  return status;
 }
@@ -47,6 +47,19 @@
 // <i> Default: 1
 #define SL_MEMORY_MANAGER_STATISTICS_API_ENABLE  1
 
+// <o SL_MEMORY_MANAGER_STATISTICS_SCAN_BLOCK_COUNT> Heap blocks scanned per atomic section
+// <1-256:1>
+// <i> The largest and smallest block sizes are recomputed by scanning the heap after its layout changed.
+// <i> Interrupts are masked for at most this number of blocks at a time during the scan.
+// <i> Default: 16
+#define SL_MEMORY_MANAGER_STATISTICS_SCAN_BLOCK_COUNT  16
+
+// <q SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE> Cross-checks the statistics with a full heap scan.
+// <i> sl_memory_get_heap_info() walks the whole heap with interrupts masked and asserts that the
+// <i> incrementally maintained statistics match. Intended for tests only.
+// <i> Default: 0
+#define SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE  0
+
 // </h>
 
 // <<< end of configuration section >>>
@@ -31,6 +31,7 @@
 #ifndef SL_MEMORY_MANAGER_H_
 #define SL_MEMORY_MANAGER_H_
 
+#include <stdbool.h>
 #include <stddef.h>
 #include <stdint.h>
 
@@ -114,6 +115,8 @@ extern "C" {
  *   - Dynamically allocating and freeing blocks.
  *   - Creating and deleting memory pools. Allocating and freeing fixed-size
  * blocks from a given pool.
+ *   - Creating and deleting memory arenas. Allocating blocks from a given arena
+ * and freeing them all at once.
  *   - Reserving and releasing blocks.
  *   - Getting statistics about the heap usage and the stack.
  *   - Retargeting the standard C library memory functions malloc()/free()/
@@ -331,6 +334,58 @@ extern "C" {
  * }
  * @endcode
  *
+ * ### Memory Arena
+ *
+ * The memory arena API allows to:
+ *   - Create an arena taking a chunk of a given size from the heap: sl_memory_create_arena().
+ *   - Delete an arena, returning all its chunks to the heap: sl_memory_delete_arena().
+ *   - Get a block from the arena: sl_memory_arena_alloc().
+ *   - Free all the arena's blocks at once: sl_memory_arena_reset().
+ *
+ * Memory arenas suit bursts of short-lived allocations that are all released
+ * together, for instance a parsed frame with its sub-objects. A block is
+ * allocated by advancing a pointer in the current chunk, there is neither a
+ * free block search nor per-block metadata, and the blocks cannot be freed
+ * individually. An arena created as growable takes a new chunk from the heap
+ * when the current one is full. Resetting the arena returns the additional
+ * chunks to the heap and keeps the first one for the next burst.
+ *
+ * An arena is not thread-safe, it must be used by one context at a time.
+ *
+ * The following code snippet shows a typical memory arena API sequence:
+ * @code{.c}
+ * uint8_t *ptr8;
+ * sl_status_t status;
+ * sl_memory_arena_t arena1_handle = { 0 };
+ *
+ * // Create a growable arena taking chunks of 1024 bytes from the heap.
+ * status = sl_memory_create_arena(1024, true, &arena1_handle);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ *
+ * status = sl_memory_arena_alloc(&arena1_handle,
+ *                                100,
+ *                                SL_MEMORY_BLOCK_ALIGN_DEFAULT,
+ *                                (void **)&ptr8);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ *
+ * memset(ptr8, 0xAA, 100);
+ *
+ * // Free all blocks allocated from the arena.
+ * status = sl_memory_arena_reset(&arena1_handle);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ *
+ * status = sl_memory_delete_arena(&arena1_handle);
+ * if (status != SL_STATUS_OK) {
+ *   // Process the error condition.
+ * }
+ * @endcode
+ *
  * ### Dynamic Reservation
  *
  * The dynamic reservation is a special construct allowing to reserve a block
@@ -430,6 +485,14 @@ extern "C" {
  * functions. Refer to the description of @ref sl_memory_heap_info_t
  * "sl_memory_heap_info_t{}" for more information of each field.
  *
+ * The used and free sizes and the block counts are updated on each allocation,
+ * free and merge, so reading them is cheap. The largest and smallest block
+ * sizes are cached and only recomputed after the heap layout changed. The heap
+ * is then scanned in chunks of SL_MEMORY_MANAGER_STATISTICS_SCAN_BLOCK_COUNT
+ * blocks, and interrupts are allowed to run between chunks. Setting
+ * SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE makes sl_memory_get_heap_info()
+ * walk the whole heap and assert that the counters match. Use it in tests only.
+ *
  * If you want to know the start address and the total size of the program's
  * stack and/or heap, simply call respectively the function sl_memory_get_stack_region()
  * and/or sl_memory_get_heap_region().
@@ -569,6 +632,9 @@ struct sl_memory_heap_t {
   size_t used_size;                 ///< Used size of the heap memory, in bytes.
   size_t high_watermark;            ///< High watermark of the used heap memory, in bytes.
   uint32_t free_blocks_number;      ///< Number of free blocks in the heap.
+  uint32_t used_blocks_number;      ///< Number of used blocks in the heap.
+  size_t free_size;                 ///< Free size of the heap memory, in bytes. Excludes free block metadata.
+  uint32_t layout_generation;       ///< Incremented each time the heap layout changes.
   void *free_lt_list_head;          ///< Long-term free blocks list head pointer.
   void *free_st_list_head;          ///< Short-term free blocks list head pointer.
   sl_memory_block_attrib_t attrib;  ///< Heap attributes.
@@ -633,6 +699,25 @@ typedef struct sl_memory_pool {
   size_t block_size;                   ///< Size of each block.
 } sl_memory_pool_t;
 
+/// @cond DO_NOT_INCLUDE_WITH_DOXYGEN
+/// @brief Arena chunk list typedef.
+typedef struct sli_memory_arena_chunk sli_memory_arena_chunk_t;
+/// @endcond
+
+/// @brief Memory arena handle.
+typedef struct sl_memory_arena {
+  sl_memory_heap_t *heap;                 ///< Heap the chunks are taken from.
+  sli_memory_arena_chunk_t *chunk_head;   ///< Current chunk, head of the arena's chunks list.
+  uint8_t *alloc_ptr;                     ///< Next free byte in the current chunk.
+  uint8_t *alloc_end;                     ///< End of the current chunk.
+  size_t chunk_size;                      ///< Size of the chunks taken from the heap, in bytes.
+  bool growable;                          ///< Take a new chunk when the current one is full.
+  uint32_t chunk_count;                   ///< Number of chunks held by the arena.
+  size_t size;                            ///< Size of the chunks held by the arena, in bytes.
+  size_t used_size;                       ///< Allocated size since the last reset, including alignment padding, in bytes.
+  size_t high_watermark;                  ///< High watermark of the allocated size, in bytes.
+} sl_memory_arena_t;
+
 // ----------------------------------------------------------------------------
 // PROTOTYPES
 
@@ -988,6 +1073,97 @@ uint32_t sl_memory_pool_get_free_block_count(const sl_memory_pool_t *pool_handle
  ******************************************************************************/
 uint32_t sl_memory_pool_get_used_block_count(const sl_memory_pool_t *pool_handle);
 
+/***************************************************************************//**
+ * Creates a memory arena in the general purpose heap.
+ *
+ * @param[in] chunk_size    Size of each chunk taken from the heap, in bytes.
+ * @param[in] growable      If true, a new chunk is taken from the heap when
+ *                          the current one cannot satisfy an allocation.
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @note  The first chunk is taken from the heap by this function.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_memory_create_arena(size_t chunk_size,
+                                   bool growable,
+                                   sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Deletes a memory arena.
+ *
+ * @param[in] arena_handle Handle to the memory arena.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note All the arena's chunks are returned to the heap, the blocks allocated
+ *       from the arena must no longer be used.
+ *
+ * @note The arena_handle provided is neither freed or invalidated. It can be
+ *       reused in a new call to sl_memory_create_arena() to create another arena.
+ ******************************************************************************/
+sl_status_t sl_memory_delete_arena(sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Allocates a block from a memory arena.
+ *
+ * @param[in]  arena_handle Handle to the memory arena.
+ * @param[in]  size         Size of the block, in bytes.
+ * @param[in]  align        Required alignment for the block, in bytes.
+ * @param[out] block        Pointer to a variable that will receive the address
+ *                          of the allocated block. NULL in case of error
+ *                          condition.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note  Required alignment of memory block (in bytes) MUST be a power of 2
+ *        and can range from 1 to 512 bytes.
+ *        The define SL_MEMORY_BLOCK_ALIGN_DEFAULT can be specified to select
+ *        the default alignment.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_alloc(sl_memory_arena_t *arena_handle,
+                                  size_t size,
+                                  size_t align,
+                                  void **block);
+
+/***************************************************************************//**
+ * Frees all blocks allocated from a memory arena.
+ *
+ * @param[in] arena_handle Handle to the memory arena.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ *
+ * @note The chunks taken when the arena grew are returned to the heap, the
+ *       first chunk is kept for the next allocations. The high watermark is
+ *       not reset.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_reset(sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Gets the size allocated from a memory arena since its last reset.
+ *
+ * @param[in] arena_handle Handle to the memory arena.
+ *
+ * @return  Allocated size in bytes, including alignment padding.
+ ******************************************************************************/
+size_t sl_memory_arena_get_used_size(const sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Gets a memory arena's high watermark.
+ *
+ * @param[in] arena_handle Handle to the memory arena.
+ *
+ * @return  Highest size allocated from the arena between two resets, in bytes.
+ ******************************************************************************/
+size_t sl_memory_arena_get_high_watermark(const sl_memory_arena_t *arena_handle);
+
+/***************************************************************************//**
+ * Reset a memory arena's high watermark to its current allocated size.
+ *
+ * @param[in] arena_handle Handle to the memory arena.
+ ******************************************************************************/
+void sl_memory_arena_reset_high_watermark(sl_memory_arena_t *arena_handle);
+
 /***************************************************************************//**
  * Populates an sl_memory_heap_info_t{} structure with the current status of
  * the heap.
@@ -1177,6 +1353,22 @@ sl_status_t sl_memory_heap_create_pool(sl_memory_heap_t *heap,
                                        uint32_t block_count,
                                        sl_memory_pool_t *pool_handle);
 
+/***************************************************************************//**
+ * Creates a memory arena in a specific heap instance.
+ *
+ * @param[in] heap          Handle to the heap instance.
+ * @param[in] chunk_size    Size of each chunk taken from the heap, in bytes.
+ * @param[in] growable      If true, a new chunk is taken from the heap when
+ *                          the current one cannot satisfy an allocation.
+ * @param[in] arena_handle  Handle to the memory arena.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+sl_status_t sl_memory_heap_create_arena(sl_memory_heap_t *heap,
+                                        size_t chunk_size,
+                                        bool growable,
+                                        sl_memory_arena_t *arena_handle);
+
 /** @} (end addtogroup memory_manager) */
 
 #ifdef __cplusplus
@@ -86,6 +86,22 @@ sl_memory_heap_t sli_general_purpose_heap;
 bool reserve_no_retention_first = true;
 #endif
 
+#if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
+// Maximum number of times a chunked heap scan restarts because the heap changed.
+#define HEAP_SCAN_RESTART_MAX  4u
+
+// Default for configuration files generated before the chunked scan existed.
+#if !defined(SL_MEMORY_MANAGER_STATISTICS_SCAN_BLOCK_COUNT)
+#define SL_MEMORY_MANAGER_STATISTICS_SCAN_BLOCK_COUNT  16
+#endif
+
+// Block statistics of the general purpose heap from the last scan and the heap
+// layout generation they were computed for.
+static sl_memory_heap_info_t heap_extremes;
+static uint32_t heap_extremes_generation;
+static bool heap_extremes_valid = false;
+#endif
+
 /*******************************************************************************
  ***************************   LOCAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -94,6 +110,18 @@ static sli_block_metadata_t *memory_manage_data_alignment(sl_memory_heap_t *heap
                                                           sli_block_metadata_t *current_block_metadata,
                                                           size_t block_align);
 
+#if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
+static void heap_scan_block(const sli_block_metadata_t *block_metadata,
+                            sl_memory_heap_info_t *scan_info);
+
+static void heap_refresh_block_extremes(sl_memory_heap_t *heap,
+                                        uint32_t chunk_block_count);
+
+#if defined(SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE == 1)
+static void heap_deep_scan(sl_memory_heap_t *heap);
+#endif
+#endif
+
 /*******************************************************************************
  **************************   GLOBAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -249,6 +277,9 @@ sl_status_t sl_memory_reserve_no_retention(size_t size,
       return SL_STATUS_ALLOCATION_FAILED;
     }
 
+    SLI_HEAP_STATS_FREE_SIZE_SUB(&sli_general_purpose_heap, (SLI_BLOCK_LEN_BYTE_TO_DWORD(block_size_remaining) - block_len_dw));
+    SLI_HEAP_STATS_LAYOUT_CHANGED(&sli_general_purpose_heap);
+
     status = SL_STATUS_OK;
   } else {
     status = SL_STATUS_ALLOCATION_FAILED;
@@ -474,21 +505,15 @@ sl_status_t sl_memory_realloc(void *ptr,
 /***************************************************************************//**
  * Populates an sl_memory_heap_info_t{} structure with the current status of
  * the heap.
+ *
+ * @note (1) Sizes and block counts are maintained incrementally. The block
+ *           size extremes are cached for a given heap layout generation and
+ *           refreshed with a chunked scan only when the layout changed.
  ******************************************************************************/
 sl_status_t sl_memory_get_heap_info(sl_memory_heap_info_t *heap_info)
 {
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
   sl_memory_region_t heap_region = sl_memory_get_heap_region();
-  sli_block_metadata_t *block_metadata = (sli_block_metadata_t *)heap_region.addr;
-  bool compute = true;
-  size_t block_len_dw = 0u;
-  size_t remaining_size = 0u;
-  size_t free_block_count = 0u;
-  size_t used_block_count = 0u;
-  size_t largest_free_size = 0u;
-  size_t smallest_free_size = SIZE_MAX;
-  size_t largest_used_size = 0u;
-  size_t smallest_used_size = SIZE_MAX;
 
   if (heap_info == NULL) {
     return SL_STATUS_NULL_POINTER;
@@ -497,50 +522,28 @@ sl_status_t sl_memory_get_heap_info(sl_memory_heap_info_t *heap_info)
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
 
-  do {
-    block_len_dw = sli_block_len_dword_decode(block_metadata);
-    // Calculate the smallest and largest used size and the remaining heap sizes.
-    if (block_metadata->block_in_use == 0) {
-      remaining_size += SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw);
-      largest_free_size = SL_MAX(SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw), largest_free_size);
-      smallest_free_size = SL_MIN(SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw), smallest_free_size);
-      free_block_count++;
-    } else {
-      largest_used_size = SL_MAX(SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw), largest_used_size);
-      smallest_used_size = SL_MIN(SLI_BLOCK_LEN_DWORD_TO_BYTE(block_len_dw), smallest_used_size);
-      used_block_count++;
-    }
-
-    // If no used block, set the smallest used size to 0.
-    if (smallest_used_size == SIZE_MAX) {
-      smallest_used_size = 0u;
-    }
-
-    // If no free block, set the smallest free size to 0.
-    if (smallest_free_size == SIZE_MAX) {
-      smallest_free_size = 0u;
-    }
-
-    // Get the next block.
-    if (sli_block_offset_next_dword_decode(block_metadata) == 0) {
-      compute = false;
-    } else {
-      block_metadata = (sli_block_metadata_t *)((uint64_t *)block_metadata + sli_block_offset_next_dword_decode(block_metadata));
-    }
-  } while (compute);
+#if defined(SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE == 1)
+  heap_deep_scan(&sli_general_purpose_heap);
+#endif
 
-  CORE_EXIT_ATOMIC();
+  // See Note #1.
+  if (heap_extremes_generation != sli_general_purpose_heap.layout_generation
+      || !heap_extremes_valid) {
+    heap_refresh_block_extremes(&sli_general_purpose_heap, SL_MEMORY_MANAGER_STATISTICS_SCAN_BLOCK_COUNT);
+  }
 
   heap_info->base_addr = (size_t)heap_region.addr;
   heap_info->total_size = heap_region.size;
   heap_info->used_size = sli_general_purpose_heap.used_size;
-  heap_info->free_size = remaining_size;
-  heap_info->free_block_count = free_block_count;
-  heap_info->free_block_largest_size = largest_free_size;
-  heap_info->free_block_smallest_size = smallest_free_size;
-  heap_info->used_block_count = used_block_count;
-  heap_info->used_block_largest_size = largest_used_size;
-  heap_info->used_block_smallest_size = smallest_used_size;
+  heap_info->free_size = sli_general_purpose_heap.free_size;
+  heap_info->free_block_count = sli_general_purpose_heap.free_blocks_number;
+  heap_info->free_block_largest_size = heap_extremes.free_block_largest_size;
+  heap_info->free_block_smallest_size = heap_extremes.free_block_smallest_size;
+  heap_info->used_block_count = sli_general_purpose_heap.used_blocks_number;
+  heap_info->used_block_largest_size = heap_extremes.used_block_largest_size;
+  heap_info->used_block_smallest_size = heap_extremes.used_block_smallest_size;
+
+  CORE_EXIT_ATOMIC();
 #else
   (void) heap_info;
 #endif
@@ -568,11 +571,14 @@ size_t sl_memory_get_total_heap_size(void)
 size_t sl_memory_get_free_heap_size(void)
 {
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
-  sl_memory_heap_info_t heap_info;
+  size_t heap_free_size_value;
 
-  sl_memory_get_heap_info(&heap_info);
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_ATOMIC();
+  heap_free_size_value = sli_general_purpose_heap.free_size;
+  CORE_EXIT_ATOMIC();
 
-  return heap_info.free_size;
+  return heap_free_size_value;
 #else
   return 0;
 #endif
@@ -618,12 +624,9 @@ size_t sl_memory_get_heap_high_watermark(void)
 void sl_memory_reset_heap_high_watermark(void)
 {
 #if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
-  sl_memory_heap_info_t heap_info;
-
-  sl_memory_get_heap_info(&heap_info);
   CORE_DECLARE_IRQ_STATE;
   CORE_ENTER_ATOMIC();
-  sli_general_purpose_heap.high_watermark = heap_info.used_size;
+  sli_general_purpose_heap.high_watermark = sli_general_purpose_heap.used_size;
   CORE_EXIT_ATOMIC();
 #endif
 }
@@ -729,8 +732,11 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
   // Prepare found block.
   allocated_blk = current_block_metadata;
 
-  // Update counter of free blocks.
+  // Update counters of free and used blocks.
   heap->free_blocks_number--;
+  heap->used_blocks_number++;
+  SLI_HEAP_STATS_FREE_SIZE_SUB(heap, block_len_dw);
+  SLI_HEAP_STATS_LAYOUT_CHANGED(heap);
 
   // Split allocated block if possible.
   if (block_size_remaining >= SLI_BLOCK_ALLOCATION_MIN_SIZE) {
@@ -751,6 +757,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       sli_memory_metadata_init(new_free_blk);
       block_len_dw = sli_block_len_dword_decode(current_block_metadata);
       sli_block_len_dword_encode(new_free_blk, (block_len_dw - SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real + SLI_BLOCK_METADATA_SIZE_BYTE)));
+      SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(new_free_blk));
 
       sli_block_offset_prev_dword_encode(new_free_blk, SLI_BLOCK_LEN_BYTE_TO_DWORD(new_free_blk_offset));
 
@@ -799,6 +806,7 @@ sl_status_t sl_memory_heap_alloc_advanced(sl_memory_heap_t *heap,
       // Update original found block which becomes a free block.
       new_free_blk = current_block_metadata;
       sli_block_len_dword_encode(new_free_blk, SLI_BLOCK_LEN_BYTE_TO_DWORD(block_size_remaining - SLI_BLOCK_METADATA_SIZE_BYTE));
+      SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(new_free_blk));
 
       sli_block_offset_next_dword_encode(new_free_blk, sli_block_offset_prev_dword_decode(allocated_blk));
 
@@ -935,8 +943,10 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
   // Include metadata as it is part of the allocation for the bank counters.
   DECREMENT_BANK_COUNTER(heap, (uint8_t *)current_metadata, (uint8_t *)block + SLI_BLOCK_LEN_DWORD_TO_BYTE(current_metadata->length));
 
-  // Update counter with block being freed.
+  // Update counters with block being freed.
   heap->free_blocks_number++;
+  heap->used_blocks_number--;
+  SLI_HEAP_STATS_LAYOUT_CHANGED(heap);
 
   // Check if previous block exists and is free.
   if (sli_block_offset_prev_dword_decode(current_metadata) > 0) {
@@ -951,6 +961,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
       // Merge current block to free with previous adjacent block.
       free_block = metadata_prev_blk;
       total_size_free_block_dw += prev_blk_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD;
+      SLI_HEAP_STATS_FREE_SIZE_SUB(heap, prev_blk_len_dw);
 
       // 2 free blocks have been merged, account for 1 free block only.
       heap->free_blocks_number--;
@@ -990,6 +1001,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
       // Merge block with next adjacent block.
       block_len_dw = sli_block_len_dword_decode(next_block);
       total_size_free_block_dw += block_len_dw + SLI_BLOCK_METADATA_SIZE_DWORD;
+      SLI_HEAP_STATS_FREE_SIZE_SUB(heap, block_len_dw);
       // Invalidate the next block metadata.
       sli_block_len_dword_encode(next_block, 0);
       // Get the "next" block adjacent to the invalidated next block.
@@ -1012,6 +1024,7 @@ sl_status_t sl_memory_heap_free(sl_memory_heap_t *heap,
   // Update accordingly the metadata block considered as free.
   sli_block_len_dword_encode(free_block, (total_size_free_block_dw - SLI_BLOCK_METADATA_SIZE_DWORD));
   free_block->block_in_use = 0;
+  SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(free_block));
   if (next_block != NULL) {
     // Update implicit double linked-list.
     sli_block_offset_next_dword_encode(free_block, SLI_BLOCK_LEN_BYTE_TO_DWORD((size_t)next_block - (size_t)free_block));
@@ -1195,6 +1208,9 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
         // Remove free block metadata from bank counter as free block will be merged with adjacent block or removed.
         DECREMENT_BANK_COUNTER(heap, (uint8_t*)next_block, (uint8_t*)next_block + SLI_BLOCK_METADATA_SIZE_BYTE);
 
+        SLI_HEAP_STATS_FREE_SIZE_SUB(heap, sli_block_len_dword_decode(next_block));
+        SLI_HEAP_STATS_LAYOUT_CHANGED(heap);
+
         if (next_block_len_remaining >= SL_MEMORY_MANAGER_BLOCK_ALLOCATION_MIN_SIZE) {
           // Enough space left in next block to leave a smaller free block.
 
@@ -1206,6 +1222,7 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
           sli_block_offset_next_dword_encode(current_block, (sli_block_len_dword_decode(current_block) + SLI_BLOCK_METADATA_SIZE_DWORD));
           sli_memory_metadata_init(adjusted_next_block);
           sli_block_len_dword_encode(adjusted_next_block, SLI_BLOCK_LEN_BYTE_TO_DWORD(next_block_len_remaining));
+          SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(adjusted_next_block));
           sli_block_offset_prev_dword_encode(adjusted_next_block, sli_block_offset_next_dword_decode(current_block));
 
           // Increment bank counter for new free block metadata.
@@ -1330,12 +1347,16 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
         // Compute adjusted adjacent free block location.
         sli_block_metadata_t *adjusted_next_block = (sli_block_metadata_t *)((uint8_t *)current_block + SLI_BLOCK_METADATA_SIZE_BYTE + size_real);
 
+        SLI_HEAP_STATS_FREE_SIZE_SUB(heap, sli_block_len_dword_decode(next_block));
+        SLI_HEAP_STATS_LAYOUT_CHANGED(heap);
+
         // Update all relevant metadata fields of current block, next block, next next block (if applicable).
         sli_block_len_dword_encode(current_block, SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real));
         sli_block_offset_next_dword_encode(current_block, (sli_block_len_dword_decode(current_block) + SLI_BLOCK_METADATA_SIZE_DWORD));
         sli_memory_metadata_init(adjusted_next_block);
         sli_block_len_dword_encode(adjusted_next_block, (SLI_BLOCK_LEN_BYTE_TO_DWORD(current_block_remaining_len)
                                                          + sli_block_len_dword_decode(next_block)));
+        SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(adjusted_next_block));
         sli_block_offset_prev_dword_encode(adjusted_next_block, sli_block_offset_next_dword_decode(current_block));
 
         // Remove free block metadata from bank counter as free block is merged with previous block.
@@ -1381,6 +1402,8 @@ sl_status_t sl_memory_heap_realloc(sl_memory_heap_t *heap,
         sli_block_offset_next_dword_encode(current_block, (sli_block_len_dword_decode(current_block) + SLI_BLOCK_METADATA_SIZE_DWORD));
         sli_memory_metadata_init(adjusted_next_block);
         sli_block_len_dword_encode(adjusted_next_block, SLI_BLOCK_LEN_BYTE_TO_DWORD(current_block_remaining_len - SLI_BLOCK_METADATA_SIZE_BYTE));
+        SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(adjusted_next_block));
+        SLI_HEAP_STATS_LAYOUT_CHANGED(heap);
         sli_block_offset_prev_dword_encode(adjusted_next_block, sli_block_offset_next_dword_decode(current_block));
 
         // Increment bank counter for new free block metadata.
@@ -1480,6 +1503,9 @@ static sli_block_metadata_t *memory_manage_data_alignment(sl_memory_heap_t *heap
     // all computations in malloc()/free() valid. For ST split block, the lost space is back into
     // a free block space.
     sli_block_len_dword_encode(prev_block, (block_len_dw + align_offset));
+    if (prev_block->block_in_use == 0) {
+      SLI_HEAP_STATS_FREE_SIZE_ADD(heap, align_offset);
+    }
   } else {
     // Special case where the block data payload being aligned is at the heap start. A special flag in the block metadata
     // is used to identify this special block in sl_memory_free() and accordingly perform the merge with previous adjacent block.
@@ -1503,3 +1529,120 @@ static sli_block_metadata_t *memory_manage_data_alignment(sl_memory_heap_t *heap
 
   return current_block_metadata;
 }
+
+#if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
+/***************************************************************************//**
+ * Accounts a heap block in the statistics being scanned.
+ *
+ * @param[in]     block_metadata  Pointer to block metadata.
+ *
+ * @param[in,out] scan_info       Statistics accumulated by the scan.
+ ******************************************************************************/
+static void heap_scan_block(const sli_block_metadata_t *block_metadata,
+                            sl_memory_heap_info_t *scan_info)
+{
+  size_t block_len = SLI_BLOCK_LEN_DWORD_TO_BYTE(sli_block_len_dword_decode(block_metadata));
+
+  if (block_metadata->block_in_use == 0) {
+    scan_info->free_size += block_len;
+    scan_info->free_block_largest_size = SL_MAX(block_len, scan_info->free_block_largest_size);
+    scan_info->free_block_smallest_size = SL_MIN(block_len, scan_info->free_block_smallest_size);
+    scan_info->free_block_count++;
+  } else {
+    scan_info->used_block_largest_size = SL_MAX(block_len, scan_info->used_block_largest_size);
+    scan_info->used_block_smallest_size = SL_MIN(block_len, scan_info->used_block_smallest_size);
+    scan_info->used_block_count++;
+  }
+}
+
+/***************************************************************************//**
+ * Recomputes the largest and smallest block sizes of a heap.
+ *
+ * @param[in]  heap               Heap handle.
+ *
+ * @param[in]  chunk_block_count  Number of blocks scanned before letting
+ *                                pending interrupts run.
+ *
+ * @note (1) Must be called inside an atomic section. The section is briefly
+ *           exited every chunk_block_count blocks. If the heap layout changed
+ *           meanwhile, the scan restarts from the heap start.
+ *
+ * @note (2) A heap modified faster than it can be scanned would restart the
+ *           scan forever. After a few restarts, the scan completes without
+ *           leaving the atomic section.
+ ******************************************************************************/
+static void heap_refresh_block_extremes(sl_memory_heap_t *heap,
+                                        uint32_t chunk_block_count)
+{
+  const sli_block_metadata_t *block_metadata;
+  sl_memory_heap_info_t scan_info;
+  uint32_t generation;
+  uint32_t restart_count = 0u;
+  uint32_t block_count;
+  bool done;
+
+  do {
+    // (Re)start the scan from the heap start.
+    memset(&scan_info, 0, sizeof(scan_info));
+    scan_info.free_block_smallest_size = SIZE_MAX;
+    scan_info.used_block_smallest_size = SIZE_MAX;
+    generation = heap->layout_generation;
+    block_metadata = (const sli_block_metadata_t *)heap->base_addr;
+    block_count = 0u;
+    done = false;
+
+    while (!done) {
+      heap_scan_block(block_metadata, &scan_info);
+
+      // Get the next block.
+      if (sli_block_offset_next_dword_decode(block_metadata) == 0) {
+        done = true;
+      } else {
+        block_metadata = (const sli_block_metadata_t *)((const uint64_t *)block_metadata + sli_block_offset_next_dword_decode(block_metadata));
+
+        // See Note #1 and #2.
+        block_count++;
+        if ((block_count >= chunk_block_count) && (restart_count < HEAP_SCAN_RESTART_MAX)) {
+          block_count = 0u;
+          CORE_YIELD_ATOMIC();
+          if (heap->layout_generation != generation) {
+            restart_count++;
+            break;
+          }
+        }
+      }
+    }
+  } while (!done);
+
+  // If no free or used block, set the smallest size to 0.
+  if (scan_info.free_block_smallest_size == SIZE_MAX) {
+    scan_info.free_block_smallest_size = 0u;
+  }
+  if (scan_info.used_block_smallest_size == SIZE_MAX) {
+    scan_info.used_block_smallest_size = 0u;
+  }
+
+  heap_extremes = scan_info;
+  heap_extremes_generation = generation;
+  heap_extremes_valid = true;
+}
+
+#if defined(SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_DEEP_SCAN_ENABLE == 1)
+/***************************************************************************//**
+ * Walks the whole heap and checks the incrementally maintained statistics.
+ *
+ * @param[in]  heap  Heap handle.
+ *
+ * @note (1) Must be called inside an atomic section. The scan isn't chunked so
+ *           that the counters can't change while being checked.
+ ******************************************************************************/
+static void heap_deep_scan(sl_memory_heap_t *heap)
+{
+  heap_refresh_block_extremes(heap, UINT32_MAX);
+
+  EFM_ASSERT(heap_extremes.free_size == heap->free_size);
+  EFM_ASSERT(heap_extremes.free_block_count == heap->free_blocks_number);
+  EFM_ASSERT(heap_extremes.used_block_count == heap->used_blocks_number);
+}
+#endif
+#endif
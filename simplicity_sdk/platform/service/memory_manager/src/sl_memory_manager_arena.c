@@ -0,0 +1,300 @@
+/***************************************************************************//**
+ * @file
+ * @brief Memory Manager Driver's Memory Arena Feature Implementation.
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sl_memory_manager.h"
+#include "sli_memory_manager.h"
+
+/*******************************************************************************
+ *********************************   DEFINES   *********************************
+ ******************************************************************************/
+
+// Chunk header size, rounded up so that the chunk data keeps the heap alignment.
+#define SLI_MEM_ARENA_CHUNK_HEADER_SIZE  ((sizeof(sli_memory_arena_chunk_t) + SLI_BLOCK_ALLOC_MIN_ALIGN - 1u) \
+                                          & ~(size_t)(SLI_BLOCK_ALLOC_MIN_ALIGN - 1u))
+
+/*******************************************************************************
+ *******************************   DATA TYPES   ********************************
+ ******************************************************************************/
+
+// Header at the start of each chunk taken from the heap.
+struct sli_memory_arena_chunk {
+  sli_memory_arena_chunk_t *next;  // Next chunk, taken earlier.
+  size_t size;                     // Size of the chunk data, in bytes.
+};
+
+/*******************************************************************************
+ ***************************   LOCAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Takes a new chunk from the heap and makes it the arena's current chunk.
+ *
+ * @param[in] arena_handle  Handle to the memory arena.
+ * @param[in] min_size      Minimum size of the chunk data, in bytes.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+static sl_status_t arena_add_chunk(sl_memory_arena_t *arena_handle,
+                                   size_t min_size)
+{
+  sli_memory_arena_chunk_t *chunk;
+  size_t data_size = (min_size > arena_handle->chunk_size) ? min_size : arena_handle->chunk_size;
+  void *block;
+  sl_status_t status;
+
+  if (data_size > (SIZE_MAX - SLI_MEM_ARENA_CHUNK_HEADER_SIZE)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  // Chunks outlive the bursts of allocations, they are long-term blocks.
+  status = sl_memory_heap_alloc(arena_handle->heap,
+                                SLI_MEM_ARENA_CHUNK_HEADER_SIZE + data_size,
+                                BLOCK_TYPE_LONG_TERM,
+                                &block);
+  if (status != SL_STATUS_OK) {
+    return status;
+  }
+
+  chunk = (sli_memory_arena_chunk_t *)block;
+  chunk->next = arena_handle->chunk_head;
+  chunk->size = data_size;
+
+  arena_handle->chunk_head = chunk;
+  arena_handle->alloc_ptr = (uint8_t *)block + SLI_MEM_ARENA_CHUNK_HEADER_SIZE;
+  arena_handle->alloc_end = arena_handle->alloc_ptr + data_size;
+  arena_handle->chunk_count++;
+  arena_handle->size += data_size;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Returns the chunks of an arena to the heap, keeping the first one if asked.
+ *
+ * @param[in] arena_handle  Handle to the memory arena.
+ * @param[in] keep_first    True to keep the chunk taken at creation.
+ *
+ * @return  SL_STATUS_OK if successful. Error code otherwise.
+ ******************************************************************************/
+static sl_status_t arena_free_chunks(sl_memory_arena_t *arena_handle,
+                                     bool keep_first)
+{
+  sli_memory_arena_chunk_t *chunk;
+  sl_status_t status;
+
+  while ((arena_handle->chunk_head != NULL)
+         && (!keep_first || (arena_handle->chunk_head->next != NULL))) {
+    chunk = arena_handle->chunk_head;
+    arena_handle->chunk_head = chunk->next;
+    arena_handle->chunk_count--;
+    arena_handle->size -= chunk->size;
+
+    status = sl_memory_heap_free(arena_handle->heap, chunk);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+  }
+
+  if (arena_handle->chunk_head != NULL) {
+    arena_handle->alloc_ptr = (uint8_t *)arena_handle->chunk_head + SLI_MEM_ARENA_CHUNK_HEADER_SIZE;
+    arena_handle->alloc_end = arena_handle->alloc_ptr + arena_handle->chunk_head->size;
+  } else {
+    arena_handle->alloc_ptr = NULL;
+    arena_handle->alloc_end = NULL;
+  }
+  arena_handle->used_size = 0;
+
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ **************************   GLOBAL FUNCTIONS   *******************************
+ ******************************************************************************/
+
+/***************************************************************************//**
+ * Creates a memory arena in the general purpose heap.
+ ******************************************************************************/
+sl_status_t sl_memory_create_arena(size_t chunk_size,
+                                   bool growable,
+                                   sl_memory_arena_t *arena_handle)
+{
+  return sl_memory_heap_create_arena(&sli_general_purpose_heap, chunk_size, growable, arena_handle);
+}
+
+/***************************************************************************//**
+ * Creates a memory arena in a specific heap instance.
+ ******************************************************************************/
+sl_status_t sl_memory_heap_create_arena(sl_memory_heap_t *heap,
+                                        size_t chunk_size,
+                                        bool growable,
+                                        sl_memory_arena_t *arena_handle)
+{
+  if ((heap == NULL) || (arena_handle == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  if (chunk_size == 0) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  arena_handle->heap = heap;
+  arena_handle->chunk_head = NULL;
+  arena_handle->alloc_ptr = NULL;
+  arena_handle->alloc_end = NULL;
+  arena_handle->chunk_size = chunk_size;
+  arena_handle->growable = growable;
+  arena_handle->chunk_count = 0;
+  arena_handle->size = 0;
+  arena_handle->used_size = 0;
+  arena_handle->high_watermark = 0;
+
+  return arena_add_chunk(arena_handle, chunk_size);
+}
+
+/***************************************************************************//**
+ * Deletes a memory arena.
+ ******************************************************************************/
+sl_status_t sl_memory_delete_arena(sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  return arena_free_chunks(arena_handle, false);
+}
+
+/***************************************************************************//**
+ * Allocates a block from a memory arena.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_alloc(sl_memory_arena_t *arena_handle,
+                                  size_t size,
+                                  size_t align,
+                                  void **block)
+{
+  uintptr_t addr;
+  sl_status_t status;
+
+  if ((arena_handle == NULL) || (block == NULL)) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  // No block allocated yet.
+  *block = NULL;
+
+  if (align == SL_MEMORY_BLOCK_ALIGN_DEFAULT) {
+    align = SLI_BLOCK_ALLOC_MIN_ALIGN;
+  }
+
+  if ((size == 0)
+      || (align == 0)
+      || ((align & (align - 1)) != 0)
+      || (align > SL_MEMORY_BLOCK_ALIGN_512_BYTES)
+      || (size > (SIZE_MAX - align))) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  if (arena_handle->chunk_head == NULL) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  addr = ((uintptr_t)arena_handle->alloc_ptr + (align - 1)) & ~(uintptr_t)(align - 1);
+
+  if ((addr > (uintptr_t)arena_handle->alloc_end)
+      || (size > ((uintptr_t)arena_handle->alloc_end - addr))) {
+    if (!arena_handle->growable) {
+      return SL_STATUS_ALLOCATION_FAILED;
+    }
+
+    // The rest of the current chunk stays unused until the next reset.
+    status = arena_add_chunk(arena_handle, size + align - 1);
+    if (status != SL_STATUS_OK) {
+      return status;
+    }
+    addr = ((uintptr_t)arena_handle->alloc_ptr + (align - 1)) & ~(uintptr_t)(align - 1);
+  }
+
+  arena_handle->used_size += (addr + size) - (uintptr_t)arena_handle->alloc_ptr;
+  if (arena_handle->used_size > arena_handle->high_watermark) {
+    arena_handle->high_watermark = arena_handle->used_size;
+  }
+  arena_handle->alloc_ptr = (uint8_t *)(addr + size);
+
+  *block = (void *)addr;
+
+  return SL_STATUS_OK;
+}
+
+/***************************************************************************//**
+ * Frees all blocks allocated from a memory arena.
+ ******************************************************************************/
+sl_status_t sl_memory_arena_reset(sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+
+  return arena_free_chunks(arena_handle, true);
+}
+
+/***************************************************************************//**
+ * Gets the size allocated from a memory arena since its last reset.
+ ******************************************************************************/
+size_t sl_memory_arena_get_used_size(const sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return 0;
+  }
+
+  return arena_handle->used_size;
+}
+
+/***************************************************************************//**
+ * Gets a memory arena's high watermark.
+ ******************************************************************************/
+size_t sl_memory_arena_get_high_watermark(const sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return 0;
+  }
+
+  return arena_handle->high_watermark;
+}
+
+/***************************************************************************//**
+ * Reset a memory arena's high watermark to its current allocated size.
+ ******************************************************************************/
+void sl_memory_arena_reset_high_watermark(sl_memory_arena_t *arena_handle)
+{
+  if (arena_handle == NULL) {
+    return;
+  }
+
+  arena_handle->high_watermark = arena_handle->used_size;
+}
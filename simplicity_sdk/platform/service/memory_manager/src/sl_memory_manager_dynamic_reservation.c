@@ -143,6 +143,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
       new_free_block = prev_block;
       prev_block = (sli_block_metadata_t *)((uint64_t *)prev_block - sli_block_offset_prev_dword_decode(prev_block));
       new_free_block_length += sli_block_len_dword_decode(new_free_block) + SLI_BLOCK_METADATA_SIZE_DWORD;
+      SLI_HEAP_STATS_FREE_SIZE_SUB(heap, sli_block_len_dword_decode(new_free_block));
     } else {
       // Create a new free block, because previous block is a dynamic allocation, a reserved block or the start of the heap.
       // Layout around the reserved block to free (aka R1) will be:
@@ -164,6 +165,7 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
     if ((next_block->block_in_use == 0) && (reserved_block_offset < SLI_BLOCK_RESERVATION_MIN_SIZE_DWORD)) {
       // New freed block's following block is free, so merge both free blocks.
       new_free_block_length += sli_block_len_dword_decode(next_block) + reserved_block_offset + SLI_BLOCK_METADATA_SIZE_DWORD;
+      SLI_HEAP_STATS_FREE_SIZE_SUB(heap, sli_block_len_dword_decode(next_block));
       // Invalidate the next block metadata.
       sli_block_len_dword_encode(next_block, 0);
       // 2 free blocks have been merged, account for 1 free block only.
@@ -185,6 +187,8 @@ sl_status_t sl_memory_release_block(sl_memory_reservation_t *handle)
   // Update the new free metadata block accordingly.
   sli_memory_metadata_init(new_free_block);
   sli_block_len_dword_encode(new_free_block, new_free_block_length);
+  SLI_HEAP_STATS_FREE_SIZE_ADD(heap, new_free_block_length);
+  SLI_HEAP_STATS_LAYOUT_CHANGED(heap);
 
   if (next_block != NULL) {
     sli_block_offset_next_dword_encode(new_free_block, ((uint64_t *)next_block - (uint64_t *)new_free_block));
@@ -363,6 +367,8 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
   block_size_remaining = (current_block_len + SLI_BLOCK_METADATA_SIZE_BYTE) - size_adjusted;
 
   heap->free_blocks_number--;
+  SLI_HEAP_STATS_FREE_SIZE_SUB(heap, sli_block_len_dword_decode(free_block_metadata));
+  SLI_HEAP_STATS_LAYOUT_CHANGED(heap);
 
   // Split free and reserved blocks if possible.
   if (block_size_remaining >= SLI_BLOCK_RESERVATION_MIN_SIZE_BYTE) {
@@ -370,6 +376,7 @@ sl_status_t sl_memory_heap_reserve_block(sl_memory_heap_t *heap,
 
     // Changes size of free block.
     sli_block_len_dword_encode(free_block_metadata, (block_len_dw - SLI_BLOCK_LEN_BYTE_TO_DWORD(size_real)));
+    SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(free_block_metadata));
 
     // Create a new block = reserved block returned to requester. This new block is the nearest to the heap end.
     reserved_blk = (sli_block_metadata_t *)((uint8_t *)free_block_metadata + block_size_remaining);
@@ -143,6 +143,17 @@ extern "C" {
 #define DECREMENT_BANK_COUNTER(heap, start_addr, end_addr)
 #endif
 
+// Macros to maintain the incremental heap statistics. Block lengths are in double words.
+#if defined(SL_MEMORY_MANAGER_STATISTICS_API_ENABLE) && (SL_MEMORY_MANAGER_STATISTICS_API_ENABLE == 1)
+#define SLI_HEAP_STATS_FREE_SIZE_ADD(heap, len_dw) ((heap)->free_size += SLI_BLOCK_LEN_DWORD_TO_BYTE(len_dw))
+#define SLI_HEAP_STATS_FREE_SIZE_SUB(heap, len_dw) ((heap)->free_size -= SLI_BLOCK_LEN_DWORD_TO_BYTE(len_dw))
+#define SLI_HEAP_STATS_LAYOUT_CHANGED(heap)        ((heap)->layout_generation++)
+#else
+#define SLI_HEAP_STATS_FREE_SIZE_ADD(heap, len_dw)
+#define SLI_HEAP_STATS_FREE_SIZE_SUB(heap, len_dw)
+#define SLI_HEAP_STATS_LAYOUT_CHANGED(heap)
+#endif
+
 /*******************************************************************************
  *********************************   TYPEDEF   *********************************
  ******************************************************************************/
@@ -407,6 +407,9 @@ sl_status_t sli_memory_create_heap(void *base_addr,
   heap->used_size = 0;
   heap->high_watermark = 0;
   heap->free_blocks_number = 0;
+  heap->used_blocks_number = 0;
+  heap->free_size = 0;
+  heap->layout_generation = 0;
   heap->attrib = attrib;
   heap->next_handle = NULL;
 
@@ -420,6 +423,7 @@ sl_status_t sli_memory_create_heap(void *base_addr,
   sli_memory_metadata_init(free_lt_list_head);
   sli_block_len_dword_encode(free_lt_list_head, (SLI_BLOCK_LEN_BYTE_TO_DWORD(size - SLI_BLOCK_METADATA_SIZE_BYTE)));
   heap->free_blocks_number++;
+  SLI_HEAP_STATS_FREE_SIZE_ADD(heap, sli_block_len_dword_decode(free_lt_list_head));
 
 #if defined(SL_CATALOG_BANK_RETENTION_CONTROL_PRESENT)
   sli_memory_manager_hal_init(heap);
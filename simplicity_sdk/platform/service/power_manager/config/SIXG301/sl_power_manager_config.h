@@ -79,6 +79,17 @@
 // <i> Default: 1
 #define SL_POWER_MANAGER_SYSCLK_SWITCH_TO_HFXO_IN_SLEEP_EN  1
 // </e>
+
+// <e SL_POWER_MANAGER_SLEEP_GOVERNOR_EN> Enable predictive sleep governor
+// <i> Learn the sleep durations that follow each wake-up interrupt and stay in EM1 when the next sleep
+// <i> is predicted to be shorter than the measured EM2/EM3 exit cost plus the minimum off-time.
+// <i> Default: 0
+#define SL_POWER_MANAGER_SLEEP_GOVERNOR_EN  0
+
+// <o SL_POWER_MANAGER_SLEEP_GOVERNOR_SOURCE_COUNT> Number of wake-up interrupts tracked by the governor <1-32>
+// <i> Default: 4
+#define SL_POWER_MANAGER_SLEEP_GOVERNOR_SOURCE_COUNT  4
+// </e>
 // </h>
 
 #endif /* SL_POWER_MANAGER_CONFIG_H */
@@ -106,6 +106,15 @@ typedef struct {
   const sl_power_manager_em_transition_event_info_t *info;  ///< Handle event info.
 } sl_power_manager_em_transition_event_handle_t;
 
+/// @brief Sleep governor statistics
+typedef struct {
+  uint32_t em1_decisions;        ///< Sleeps kept in EM1 by the governor although EM2/EM3 was allowed.
+  uint32_t deepsleep_decisions;  ///< Sleeps the governor let enter EM2/EM3.
+  uint32_t good_decisions;       ///< Decisions confirmed by the measured sleep duration.
+  uint32_t bad_decisions;        ///< Decisions contradicted by the measured sleep duration.
+  uint32_t restore_cost_tick;    ///< Measured EM2/EM3 exit cost, in sleeptimer ticks.
+} sl_power_manager_sleep_governor_statistics_t;
+
 /// On ISR Exit Hook answer
 SL_ENUM(sl_power_manager_on_isr_exit_t) {
   SL_POWER_MANAGER_IGNORE = (1UL << 0UL),     ///< The module did not trigger an ISR and it doesn't want to contribute to the decision
@@ -364,6 +373,33 @@ void sl_power_manager_em23_voltage_scaling_enable_fast_wakeup(bool enable);
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 bool sl_power_manager_is_latest_wakeup_internal(void);
 
+/***************************************************************************//**
+ * Gets the sleep governor decision counters and the measured EM2/EM3 exit
+ * cost.
+ *
+ * @param statistics  Pointer to the structure receiving the statistics.
+ *
+ * @note  When SL_POWER_MANAGER_SLEEP_GOVERNOR_EN is enabled, the governor
+ *        keeps an idle duration histogram per wake-up interrupt. Before
+ *        entering EM2/EM3, it keeps the device in EM1 if most sleeps that
+ *        followed the last wake-up interrupt were shorter than the measured
+ *        exit cost plus the minimum off-time. A decision is counted as good
+ *        when the sleep that follows confirms it. Sleeps kept in EM1 by a
+ *        requirement or by an upcoming sleeptimer event are not decisions
+ *        and are neither counted nor added to the histograms.
+ *
+ * @note The counters stay at zero unless SL_POWER_MANAGER_SLEEP_GOVERNOR_EN
+ *       is enabled.
+ ******************************************************************************/
+void sl_power_manager_sleep_governor_get_statistics(sl_power_manager_sleep_governor_statistics_t *statistics);
+
+/***************************************************************************//**
+ * Clears the sleep governor idle duration histograms and decision counters.
+ *
+ * @note The measured EM2/EM3 exit cost is kept.
+ ******************************************************************************/
+void sl_power_manager_sleep_governor_reset(void);
+
 /***************************************************************************//**
  * Enter energy mode 4 (EM4).
  *
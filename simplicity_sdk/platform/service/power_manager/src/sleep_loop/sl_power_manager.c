@@ -59,6 +59,31 @@
 // functionality.
 #define SCHEDULE_WAKEUP_DEFAULT_RESTORE_TIME_OVERHEAD_TICK  0
 
+#if defined(SL_POWER_MANAGER_SLEEP_GOVERNOR_EN) && (SL_POWER_MANAGER_SLEEP_GOVERNOR_EN == 1) \
+  && !defined(SL_CATALOG_POWER_MANAGER_NO_DEEPSLEEP_PRESENT)
+#define SLEEP_GOVERNOR_PRESENT
+#endif
+
+#if defined(SLEEP_GOVERNOR_PRESENT)
+#ifndef SL_POWER_MANAGER_SLEEP_GOVERNOR_SOURCE_COUNT
+#define SL_POWER_MANAGER_SLEEP_GOVERNOR_SOURCE_COUNT  4
+#endif
+
+// Number of idle duration buckets kept per wake source; bucket n holds
+// durations in [2^(n-1), 2^n) sleeptimer ticks.
+#define SLEEP_GOVERNOR_BUCKET_COUNT    16
+
+// Number of samples after which a wake source histogram is halved so that it
+// follows changes of the workload.
+#define SLEEP_GOVERNOR_HISTORY_LENGTH  64
+
+// Minimum number of samples before a wake source histogram is trusted.
+#define SLEEP_GOVERNOR_MIN_SAMPLES     8
+
+// Wake source recorded when no enabled interrupt is pending on wake-up.
+#define SLEEP_GOVERNOR_UNKNOWN_SOURCE  0xFFFF
+#endif
+
 // Determine if the device supports EM1P
 #if !defined(SLI_DEVICE_SUPPORTS_EM1P) && defined(_SILICON_LABS_32B_SERIES_2_CONFIG) && (_SILICON_LABS_32B_SERIES_2_CONFIG >= 2)
 #define SLI_DEVICE_SUPPORTS_EM1P
@@ -124,6 +149,34 @@ static volatile bool is_restored_from_hfxo_isr = false;
 static volatile bool is_restored_from_hfxo_isr_internal = false;
 #endif
 
+#if defined(SLEEP_GOVERNOR_PRESENT)
+// Idle duration histogram of a wake source.
+typedef struct {
+  uint16_t irq;                                   // Interrupt number of the wake source
+  uint16_t sample_count;                          // Number of samples in the histogram
+  uint16_t bucket[SLEEP_GOVERNOR_BUCKET_COUNT];   // Idle durations, log2 sleeptimer ticks
+} sleep_governor_source_t;
+
+static sleep_governor_source_t governor_sources[SL_POWER_MANAGER_SLEEP_GOVERNOR_SOURCE_COUNT];
+
+// Next histogram to replace when a new wake source is seen.
+static uint8_t governor_next_source = 0;
+
+// Histogram of the source of the last wake-up, used to predict the next idle duration.
+static sleep_governor_source_t *governor_last_source = NULL;
+
+// Governor counters and measured EM2/EM3 exit cost.
+static sl_power_manager_sleep_governor_statistics_t governor_statistics = { 0 };
+
+// Set when the governor decided the energy mode of the current sleep, and which one.
+// Sleeps kept in EM1 for any other reason are not scored nor sampled.
+static bool governor_decision_pending = false;
+static bool governor_kept_em1 = false;
+
+// Sleeptimer tick count when the current sleep was entered.
+static uint32_t governor_sleep_start_tick = 0;
+#endif
+
 /*******************************************************************************
  **************************   LOCAL FUNCTIONS   ********************************
  ******************************************************************************/
@@ -149,6 +202,17 @@ SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 static void clock_restore(void);
 #endif
 
+#if defined(SLEEP_GOVERNOR_PRESENT)
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+static bool governor_predicts_short_sleep(void);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+static void governor_on_wakeup(void);
+
+SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
+static void governor_update_restore_cost(uint32_t restore_tick);
+#endif
+
 // Use PriMask to enter critical section by disabling interrupts.
 SL_CODE_CLASSIFY(SL_CODE_COMPONENT_POWER_MANAGER, SL_CODE_CLASS_TIME_CRITICAL)
 static CORE_irqState_t enter_critical_with_primask();
@@ -315,9 +379,18 @@ __NO_INLINE void sl_power_manager_sleep(void)
       is_states_saved = true;
     }
 
+#if defined(SLEEP_GOVERNOR_PRESENT)
+    governor_sleep_start_tick = sl_sleeptimer_get_tick_count();
+#endif
+
     // Apply lowest reachable energy mode
     sli_power_manager_apply_em(current_em);
 
+#if defined(SLEEP_GOVERNOR_PRESENT)
+    // Learn the idle duration while the wake-up interrupt is still pending
+    governor_on_wakeup();
+#endif
+
     // In case we are waiting for the restore from an early wake-up,
     // we put back the current EM to the one before the early wake-up to do the next notification correctly.
     if (is_sleeping_waiting_for_clock_restore == true) {
@@ -349,6 +422,10 @@ __NO_INLINE void sl_power_manager_sleep(void)
 #endif
 
   if (is_states_saved == true) {
+#if defined(SLEEP_GOVERNOR_PRESENT)
+    uint32_t restore_start_tick = sl_sleeptimer_get_tick_count();
+    bool is_restore_measured = is_hf_x_oscillator_not_preserved;
+#endif
     is_sleeping_waiting_for_clock_restore = false;
     // Restore clocks
     if (is_hf_x_oscillator_not_preserved) {
@@ -362,6 +439,11 @@ __NO_INLINE void sl_power_manager_sleep(void)
     }
     sli_power_manager_restore_states();
     is_states_saved = false;
+#if defined(SLEEP_GOVERNOR_PRESENT)
+    if (is_restore_measured) {
+      governor_update_restore_cost(sl_sleeptimer_get_tick_count() - restore_start_tick);
+    }
+#endif
   }
 
   evaluate_wakeup(SL_POWER_MANAGER_EM0);
@@ -607,6 +689,51 @@ bool sli_power_manager_get_clock_restore_status(void)
 }
 #endif
 
+/***************************************************************************//**
+ * Gets the sleep governor decision counters and the measured EM2/EM3 exit cost.
+ *
+ * @param statistics  Pointer to the structure receiving the statistics.
+ *
+ * @note The counters stay at zero unless SL_POWER_MANAGER_SLEEP_GOVERNOR_EN
+ *       is enabled.
+ ******************************************************************************/
+void sl_power_manager_sleep_governor_get_statistics(sl_power_manager_sleep_governor_statistics_t *statistics)
+{
+  EFM_ASSERT(statistics != NULL);
+
+#if defined(SLEEP_GOVERNOR_PRESENT)
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  *statistics = governor_statistics;
+  CORE_EXIT_CRITICAL();
+#else
+  memset(statistics, 0, sizeof(*statistics));
+#endif
+}
+
+/***************************************************************************//**
+ * Clears the sleep governor idle duration histograms and decision counters.
+ ******************************************************************************/
+void sl_power_manager_sleep_governor_reset(void)
+{
+#if defined(SLEEP_GOVERNOR_PRESENT)
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_CRITICAL();
+  memset(governor_sources, 0, sizeof(governor_sources));
+  governor_next_source = 0;
+  governor_last_source = NULL;
+  governor_decision_pending = false;
+  governor_kept_em1 = false;
+  governor_statistics.em1_decisions = 0;
+  governor_statistics.deepsleep_decisions = 0;
+  governor_statistics.good_decisions = 0;
+  governor_statistics.bad_decisions = 0;
+  CORE_EXIT_CRITICAL();
+#endif
+}
+
 /***************************************************************************//**
  * Get configurable overhead value for early restore time in Sleeptimer ticks
  * when a schedule wake-up is set.
@@ -847,6 +974,18 @@ static void evaluate_wakeup(sl_power_manager_em_t to)
 
     case SL_POWER_MANAGER_EM2:
     case SL_POWER_MANAGER_EM3:
+#if defined(SLEEP_GOVERNOR_PRESENT)
+      // Stay in EM1 if the last wake source usually wakes us up again before
+      // deepsleep pays off.
+      governor_kept_em1 = governor_predicts_short_sleep();
+      if (governor_kept_em1) {
+        governor_decision_pending = true;
+        governor_statistics.em1_decisions++;
+        update_em1_requirement(true);
+        requirement_on_em1_added = true;
+        break;
+      }
+#endif
       // Get the time remaining until the next sleeptimer requiring early wake-up
       status = sl_sleeptimer_get_remaining_time_of_first_timer(0, &tick_remaining);
       if (status == SL_STATUS_OK) {
@@ -883,6 +1022,13 @@ static void evaluate_wakeup(sl_power_manager_em_t to)
           }
         }
       }
+#if defined(SLEEP_GOVERNOR_PRESENT)
+      // Only count the decision if the sleeptimer did not force EM1 after all.
+      if (!requirement_on_em1_added) {
+        governor_decision_pending = true;
+        governor_statistics.deepsleep_decisions++;
+      }
+#endif
       break;
 
     default:
@@ -1050,6 +1196,148 @@ static void on_clock_wakeup_timeout(sl_sleeptimer_timer_handle_t *handle,
 }
 #endif
 
+#if defined(SLEEP_GOVERNOR_PRESENT)
+/***************************************************************************//**
+ * Gets the idle duration bucket of the given number of sleeptimer ticks.
+ ******************************************************************************/
+__STATIC_INLINE uint8_t governor_get_bucket(uint32_t tick)
+{
+  uint32_t bucket = (tick == 0) ? 0 : (32 - __CLZ(tick));
+
+  return (uint8_t)((bucket < SLEEP_GOVERNOR_BUCKET_COUNT) ? bucket : (SLEEP_GOVERNOR_BUCKET_COUNT - 1));
+}
+
+/***************************************************************************//**
+ * Gets the minimum idle duration, in sleeptimer ticks, for which EM2/EM3 is
+ * worth its exit cost.
+ ******************************************************************************/
+static uint32_t governor_get_break_even_tick(void)
+{
+  if (governor_statistics.restore_cost_tick == 0) {
+    // Nothing measured yet, start from the configured wake-up delay
+    int32_t wakeup_delay = wakeup_time_config_overhead_tick
+                           + sli_power_manager_get_wakeup_process_time_overhead();
+    governor_statistics.restore_cost_tick = (wakeup_delay > 0) ? (uint32_t)wakeup_delay : 1;
+  }
+
+  return governor_statistics.restore_cost_tick + high_frequency_min_offtime_tick;
+}
+
+/***************************************************************************//**
+ * Predicts if the next sleep will be too short to pay off in EM2/EM3.
+ *
+ * @return  true if most of the idle durations that followed the last wake
+ *          source were shorter than the break-even time, false otherwise.
+ *
+ * @note Must be called in a critical section.
+ ******************************************************************************/
+static bool governor_predicts_short_sleep(void)
+{
+  const sleep_governor_source_t *source = governor_last_source;
+  uint32_t short_count = 0;
+  uint8_t break_even_bucket;
+
+  if ((source == NULL) || (source->sample_count < SLEEP_GOVERNOR_MIN_SAMPLES)) {
+    return false;
+  }
+
+  // Only buckets entirely below the break-even time count as short sleeps.
+  break_even_bucket = governor_get_bucket(governor_get_break_even_tick());
+  for (uint8_t i = 0; i < break_even_bucket; i++) {
+    short_count += source->bucket[i];
+  }
+
+  return (short_count * 2) > source->sample_count;
+}
+
+/***************************************************************************//**
+ * Gets the interrupt that ended the last sleep.
+ *
+ * @return  Lowest pending enabled interrupt number, or
+ *          SLEEP_GOVERNOR_UNKNOWN_SOURCE if none is pending.
+ ******************************************************************************/
+static uint16_t governor_get_wake_source(void)
+{
+  for (uint32_t i = 0; i < ((EXT_IRQ_COUNT + 31) / 32); i++) {
+    uint32_t pending = NVIC->ISPR[i] & NVIC->ISER[i];
+    if (pending != 0) {
+      return (uint16_t)((i * 32) + __CLZ(__RBIT(pending)));
+    }
+  }
+
+  return SLEEP_GOVERNOR_UNKNOWN_SOURCE;
+}
+
+/***************************************************************************//**
+ * Records the duration of the sleep that just ended in the histogram of its
+ * wake source and scores the governor decision taken for it.
+ *
+ * @note Only sleeps for which the governor decided the energy mode are
+ *       sampled. Sleeps held in EM1 by a requirement or by the next sleeptimer
+ *       event would mix EM1-only wake-ups into the EM2/EM3 predictions. Their
+ *       wake source is still used for the next prediction. Sleeps the governor
+ *       kept in EM1 are sampled, so that a source it predicts as short can be
+ *       learned again.
+ *
+ * @note Must be called in a critical section, right after waking up.
+ ******************************************************************************/
+static void governor_on_wakeup(void)
+{
+  uint32_t idle_tick = sl_sleeptimer_get_tick_count() - governor_sleep_start_tick;
+  uint16_t irq = governor_get_wake_source();
+  sleep_governor_source_t *source = NULL;
+
+  for (uint8_t i = 0; i < SL_POWER_MANAGER_SLEEP_GOVERNOR_SOURCE_COUNT; i++) {
+    if ((governor_sources[i].sample_count != 0) && (governor_sources[i].irq == irq)) {
+      source = &governor_sources[i];
+      break;
+    }
+  }
+  if (!governor_decision_pending) {
+    governor_last_source = source;
+    return;
+  }
+  if (source == NULL) {
+    source = &governor_sources[governor_next_source];
+    governor_next_source = (governor_next_source + 1) % SL_POWER_MANAGER_SLEEP_GOVERNOR_SOURCE_COUNT;
+    memset(source, 0, sizeof(*source));
+    source->irq = irq;
+  }
+
+  if (source->sample_count >= SLEEP_GOVERNOR_HISTORY_LENGTH) {
+    source->sample_count = 0;
+    for (uint8_t i = 0; i < SLEEP_GOVERNOR_BUCKET_COUNT; i++) {
+      source->bucket[i] /= 2;
+      source->sample_count += source->bucket[i];
+    }
+  }
+  source->bucket[governor_get_bucket(idle_tick)]++;
+  source->sample_count++;
+  governor_last_source = source;
+
+  if ((idle_tick >= governor_get_break_even_tick()) != governor_kept_em1) {
+    governor_statistics.good_decisions++;
+  } else {
+    governor_statistics.bad_decisions++;
+  }
+  governor_decision_pending = false;
+}
+
+/***************************************************************************//**
+ * Updates the measured EM2/EM3 exit cost with a new restore duration.
+ *
+ * @param restore_tick  Duration of the last clock restore in sleeptimer ticks.
+ ******************************************************************************/
+static void governor_update_restore_cost(uint32_t restore_tick)
+{
+  uint32_t cost = governor_statistics.restore_cost_tick;
+
+  // Exponential moving average with a 1/8 weight on the new sample.
+  cost = (cost == 0) ? restore_tick : (((cost * 7) + restore_tick + 4) / 8);
+  governor_statistics.restore_cost_tick = (cost != 0) ? cost : 1;
+}
+#endif
+
 /***************************************************************************//**
  * HFXO ready notification callback for internal use with power manager
  *
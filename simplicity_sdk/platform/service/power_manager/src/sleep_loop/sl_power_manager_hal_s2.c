@@ -40,6 +40,8 @@
 #include "sl_sleeptimer.h"
 #include "sli_sleeptimer.h"
 #include "sl_power_manager_config.h"
+#include "sl_clock_manager.h"
+#include "sli_clock_manager.h"
 
 #if defined(_SILICON_LABS_32B_SERIES_2_CONFIG_2)
 #include "em_iadc.h"
@@ -364,6 +366,7 @@ void EMU_EM23PresleepHook(void)
 #endif
 
     SystemCoreClockUpdate();
+    sli_clock_manager_invalidate_clock_branch_cache();
   }
   // Clear HFXO IEN RDY before entering sleep to prevent HFXO HW requests from waking up the system
   HFXO0->IEN_CLR = HFXO_IEN_RDY;
@@ -414,6 +417,7 @@ void EMU_EM23PostsleepHook(void)
     // Switch SYSCLK to HFXO to measure restore time
     CMU->SYSCLKCTRL = (CMU->SYSCLKCTRL & ~_CMU_SYSCLKCTRL_CLKSEL_MASK) | cmuSelect_HFXO;
     SystemCoreClockUpdate();
+    sli_clock_manager_invalidate_clock_branch_cache();
 #else
     sli_hfxo_manager_begin_startup_measurement();
 
@@ -468,6 +472,7 @@ void sli_power_manager_restore_high_freq_accuracy_clk(void)
     // Switch SYSCLK to HFXO to measure restore time
     CMU->SYSCLKCTRL = (CMU->SYSCLKCTRL & ~_CMU_SYSCLKCTRL_CLKSEL_MASK) | cmuSelect_HFXO;
     SystemCoreClockUpdate();
+    sli_clock_manager_invalidate_clock_branch_cache();
 #else
     // Start measure HFXO restore time
     sli_hfxo_manager_begin_startup_measurement();
@@ -557,6 +562,8 @@ void sli_power_manager_restore_states(void)
   }
 
   SystemCoreClockUpdate();
+  // EMU_EnterEM2(false) notified the switch to HFRCO, notify the restored tree.
+  sl_clock_manager_notify_clock_tree_change();
 }
 #endif
 
@@ -138,11 +138,18 @@ void sli_power_manager_apply_em(sl_power_manager_em_t em)
       }
       // Apply HCLK and PCLK divisions
       CMU->SYSCLKCTRL = (CMU->SYSCLKCTRL & ~(_CMU_SYSCLKCTRL_HCLKPRESC_MASK | _CMU_SYSCLKCTRL_PCLKPRESC_MASK)) | clk_division_value;
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+      sli_clock_manager_invalidate_clock_branch_cache();
+#endif
       // Enter sleep mode
       SCB->SCR &= ~SCB_SCR_SLEEPDEEP_Msk;
       __WFI();
       // Restore HCLK and PCLK prescaler
       CMU->SYSCLKCTRL = (CMU->SYSCLKCTRL & ~(_CMU_SYSCLKCTRL_HCLKPRESC_MASK | _CMU_SYSCLKCTRL_PCLKPRESC_MASK)) | sysclk_prescalers_value;
+#if defined(SL_CATALOG_CLOCK_MANAGER_PRESENT)
+      // Subscribers only see the restored prescalers, nothing runs while they are divided.
+      sl_clock_manager_notify_clock_tree_change();
+#endif
       break;
 #endif
 
@@ -517,6 +517,56 @@ struct qspi_func_s {
   void (*RSI_QSPI_UpdateOperatingMode_and_ResetType)(qspi_reg_t *qspi_reg, uint32_t operating_mode);
 };
 
+// Operation types accepted by the non-blocking program/erase queue
+typedef enum qspi_flash_async_op_type_e {
+  QSPI_ASYNC_PAGE_PROGRAM = 0, // program up to one page, must not cross a page boundary
+  QSPI_ASYNC_SECTOR_ERASE,     // erase the sector containing addr
+  QSPI_ASYNC_BLOCK_ERASE,      // erase the block containing addr
+  QSPI_ASYNC_CHIP_ERASE,       // erase the whole flash, addr is ignored
+  QSPI_ASYNC_OP_TYPES
+} qspi_flash_async_op_type_t;
+
+typedef struct qspi_flash_async_op_s qspi_flash_async_op_t;
+
+// Completion callback, called from the context running qspi_flash_async_process()
+typedef void (*qspi_flash_async_callback_t)(qspi_flash_async_op_t *op, uint32_t status, void *user_data);
+
+// One queued program/erase operation. The caller owns the storage and must
+// keep it (and the data buffer of a page program) valid until the callback runs.
+struct qspi_flash_async_op_s {
+  qspi_flash_async_op_type_t type;      // operation type
+  uint32_t addr;                        // flash address
+  const uint8_t *data;                  // data to program, page program only
+  uint32_t len;                         // number of bytes to program, page program only
+  qspi_flash_async_callback_t callback; // completion callback, may be NULL
+  void *user_data;                      // passed back to the callback
+  uint32_t issue_ticks;                 // filled by the driver: tick count when the command was issued
+  uint32_t complete_ticks;              // filled by the driver: tick count when the flash reported idle
+  uint32_t polls;                       // filled by the driver: status reads until the flash reported idle
+  qspi_flash_async_op_t *next;          // queue link, owned by the driver
+};
+
+// Per operation type timing statistics
+typedef struct qspi_flash_async_stats_s {
+  uint32_t count;       // completed operations
+  uint32_t total_ticks; // sum of issue-to-idle times
+  uint32_t max_ticks;   // longest issue-to-idle time
+  uint32_t total_polls; // sum of status reads
+} qspi_flash_async_stats_t;
+
+// Non-blocking program/erase context, one per flash device
+typedef struct qspi_flash_async_s {
+  qspi_reg_t *qspi_reg;                                 // qspi register pointer
+  spi_config_t *spi_config;                             // SPI configuration of the flash
+  uint32_t (*get_ticks)(void);                          // free running tick source for the statistics, may be NULL
+  uint16_t page_size;                                   // flash page size in bytes, power of two
+  uint8_t dis_hw_ctrl;                                  // disable hardware control while an operation runs
+  uint8_t prev_state;                                   // auto mode was enabled when the operation was issued
+  qspi_flash_async_op_t *head;                          // operation in flight
+  qspi_flash_async_op_t *tail;                          // last queued operation
+  qspi_flash_async_stats_t stats[QSPI_ASYNC_OP_TYPES]; // statistics per operation type
+} qspi_flash_async_t;
+
 // SPI API LIST
 
 uint32_t qspi_flash_reg_read(qspi_reg_t *qspi_reg, uint8_t reg_read_cmd, uint32_t cs_no, spi_config_t *spi_config);
@@ -590,6 +640,20 @@ void qspi_spi_read(qspi_reg_t *qspi_reg,
                    void *udmaHandle,
                    void *rpdmaHandle);
 
+uint32_t qspi_flash_async_init(qspi_flash_async_t *ctx,
+                               qspi_reg_t *qspi_reg,
+                               spi_config_t *spi_config,
+                               uint16_t page_size,
+                               uint32_t dis_hw_ctrl,
+                               uint32_t (*get_ticks)(void));
+
+uint32_t qspi_flash_async_submit(qspi_flash_async_t *ctx, qspi_flash_async_op_t *op);
+
+uint32_t qspi_flash_async_process(qspi_flash_async_t *ctx);
+
+const qspi_flash_async_stats_t *qspi_flash_async_get_stats(const qspi_flash_async_t *ctx,
+                                                           qspi_flash_async_op_type_t type);
+
 uint32_t RSI_QSPI_Aes_Encrypt_Decrypt_Standalone(qspi_reg_t *qspi_reg,
                                                  qspi_standalone_config_t *configs,
                                                  uint32_t *in_data,
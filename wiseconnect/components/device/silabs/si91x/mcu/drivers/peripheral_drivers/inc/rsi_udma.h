@@ -100,6 +100,7 @@ extern "C" {
 #define UDMA_MODE_MEM_SCATTER_GATHER     0x4
 #define UDMA_MODE_MEM_ALT_SCATTER_GATHER 0x5
 #define UDMA_MODE_PER_SCATTER_GATHER     0x6
+#define UDMA_MODE_PER_ALT_SCATTER_GATHER 0x7
 #define UDMA_MODE_ALT_SELECT             0x1
 #define UDMA_SOFTWARE_TRIGG              0X2
 
@@ -267,6 +268,51 @@ typedef PRE_PACK struct POST_PACK {
   uint32_t periAck;         // dma ACK for peripheral
   uint32_t dmaCh;
 } RSI_UDMA_CHA_CFG_T;
+
+#define UDMA_SG_POOL_MAX_BLOCKS      32   // Maximum number of chains a descriptor pool can hold
+#define UDMA_SG_MAX_CHAIN_LENGTH     255  // Maximum number of segments in one scatter-gather chain
+#define UDMA_SG_MAX_SEGMENT_TRANSFER 1024 // Maximum number of items in one segment
+
+// brief Scatter-gather segment, one entry of a chain
+typedef struct {
+  void *pSrc;           // Source start address
+  volatile void *pDst;  // Destination start address
+  uint32_t length;      // Number of items to transfer (1 to 1024)
+  uint8_t width;        // Item size, SRC_SIZE_8, SRC_SIZE_16 or SRC_SIZE_32
+  uint8_t srcNoInc;     // Set for a fixed source address, e.g. a peripheral FIFO
+  uint8_t dstNoInc;     // Set for a fixed destination address, e.g. a peripheral FIFO
+  uint8_t rPower;       // Arbitration size, ARBSIZE_1 to ARBSIZE_1024
+} RSI_UDMA_SG_SEGMENT_T;
+
+// brief Scatter-gather chain built from a descriptor pool
+typedef struct {
+  RSI_UDMA_DESC_T *pTaskList; // Task list inside the pool
+  uint32_t taskCount;         // Number of tasks in the list
+  uint32_t transferType;      // UDMA_MODE_MEM_SCATTER_GATHER or UDMA_MODE_PER_SCATTER_GATHER
+  uint32_t block;             // Pool block holding the task list
+} RSI_UDMA_SG_CHAIN_T;
+
+// brief Per channel scatter-gather counters
+typedef struct {
+  uint32_t chainsStarted;     // Chains started on the channel
+  uint32_t chainsCompleted;   // Chains completed on the channel
+  uint32_t segments;          // Sum of the lengths of all started chains
+  uint32_t maxChainLength;    // Longest chain started
+  uint32_t totalLatencyTicks; // Sum of start-to-completion times
+  uint32_t maxLatencyTicks;   // Longest start-to-completion time
+} RSI_UDMA_SG_CHANNEL_STATS_T;
+
+// brief Scatter-gather descriptor pool
+typedef struct {
+  RSI_UDMA_DESC_T *pDesc;                              // Descriptor storage, blockCount * blockSize entries
+  uint32_t blockCount;                                 // Number of chains the pool can hold
+  uint32_t blockSize;                                  // Maximum chain length
+  volatile uint32_t freeMap;                           // Bit n set when block n is free
+  uint32_t (*getTicks)(void);                          // Free running tick source for latency, may be NULL
+  RSI_UDMA_SG_CHAIN_T *pActive[UDMA_CHANNEL_NUM];      // Chain running on each channel
+  uint32_t startTicks[UDMA_CHANNEL_NUM];               // Tick count when the chain was started
+  RSI_UDMA_SG_CHANNEL_STATS_T stats[UDMA_CHANNEL_NUM]; // Counters of each channel
+} RSI_UDMA_SG_POOL_T;
 /** @addtogroup SOC18
 * @{
 */
@@ -570,6 +616,24 @@ rsi_error_t RSI_UDMA_ChannelControlsDisable(RSI_UDMA_HANDLE_T pHandle, const RSI
 void RSI_UDMA_SetSingleRequest(RSI_UDMA_HANDLE_T pHandle);
 void RSI_UDMA_AckEnable(const void *pHandle, uint32_t peripheral);
 
+rsi_error_t udma_sg_pool_init(RSI_UDMA_SG_POOL_T *pPool,
+                              RSI_UDMA_DESC_T *pDesc,
+                              uint32_t blockCount,
+                              uint32_t blockSize,
+                              uint32_t (*getTicks)(void));
+rsi_error_t udma_sg_chain_build(RSI_UDMA_SG_POOL_T *pPool,
+                                const RSI_UDMA_SG_SEGMENT_T *pSegments,
+                                uint32_t segmentCount,
+                                uint32_t transferType,
+                                RSI_UDMA_SG_CHAIN_T *pChain);
+rsi_error_t udma_sg_chain_start(RSI_UDMA_HANDLE_T pHandle,
+                                RSI_UDMA_SG_POOL_T *pPool,
+                                uint8_t dmaCh,
+                                RSI_UDMA_SG_CHAIN_T *pChain);
+rsi_error_t udma_sg_chain_complete(RSI_UDMA_SG_POOL_T *pPool, uint8_t dmaCh);
+rsi_error_t udma_sg_chain_release(RSI_UDMA_SG_POOL_T *pPool, RSI_UDMA_SG_CHAIN_T *pChain);
+const RSI_UDMA_SG_CHANNEL_STATS_T *udma_sg_get_channel_stats(const RSI_UDMA_SG_POOL_T *pPool, uint8_t dmaCh);
+
 #ifdef __cplusplus
 }
 #endif
@@ -3190,3 +3190,414 @@ uint32_t RSI_QSPI_Aes_Encrypt_Decrypt_Standalone(qspi_reg_t *qspi_reg,
                                       configs->flip_data);
   return status;
 }
+
+/*==============================================*/
+/**
+ * @fn           static void qspi_flash_async_write_cmd(qspi_reg_t *qspi_reg,
+ *                                                      spi_config_t *spi_config,
+ *                                                      uint32_t cmd,
+ *                                                      uint32_t cmd2)
+ * @brief        This API used to send write enable/disable command to the flash
+ * @param[in]    qspi_reg        :   qspi register pointer
+ * @param[in]    spi_config      :   pointer to the SPI configuration
+ * @param[in]    cmd             :   WREN or WRDI
+ * @param[in]    cmd2            :   second byte of the 16 bit command, WREN2 or WRDI2
+ * @return       none
+ */
+static void qspi_flash_async_write_cmd(qspi_reg_t *qspi_reg, spi_config_t *spi_config, uint32_t cmd, uint32_t cmd2)
+{
+  uint32_t cs_no = spi_config->spi_config_2.cs_no;
+#ifdef CHIP_9118
+  if (spi_config->spi_config_3.ddr_mode_en) {
+    if (spi_config->spi_config_1.flash_type == MX_OCTA_FLASH) {
+      qspi_write_to_flash(qspi_reg, QSPI_16BIT_LEN, (cmd << 8) | cmd2, cs_no);
+    } else {
+      qspi_write_to_flash(qspi_reg, QSPI_8BIT_LEN, cmd, cs_no);
+    }
+  } else {
+    qspi_write_to_flash(qspi_reg, CMD_LEN, cmd, cs_no);
+    if (spi_config->spi_config_3._16bit_cmd_valid) {
+      qspi_write_to_flash(qspi_reg, CMD_LEN, cmd2, cs_no);
+    }
+  }
+#else
+  qspi_write_to_flash(qspi_reg, CMD_LEN, cmd, cs_no);
+  if (spi_config->spi_config_3._16bit_cmd_valid) {
+    qspi_write_to_flash(qspi_reg, CMD_LEN, cmd2, cs_no);
+  }
+#endif
+  DEASSERT_CSN;
+}
+
+/*==============================================*/
+/**
+ * @fn           static uint32_t qspi_flash_async_is_busy(qspi_reg_t *qspi_reg, spi_config_t *spi_config)
+ * @brief        This API used to read the flash status register once and check the busy bit.
+ *               Unlike qspi_wait_flash_status_Idle() it returns immediately.
+ * @param[in]    qspi_reg        :   qspi register pointer
+ * @param[in]    spi_config      :   pointer to the SPI configuration
+ * @return       non zero if the flash is still busy, 0 if idle
+ */
+static uint32_t qspi_flash_async_is_busy(qspi_reg_t *qspi_reg, spi_config_t *spi_config)
+{
+  uint32_t tmp_dummy, cmd_len, dummy_bytes = 0;
+  uint32_t cs_no, qspi_operational_mode, status_reg_read_cmd;
+  volatile uint32_t flash_status;
+
+  cs_no                 = spi_config->spi_config_2.cs_no;
+  status_reg_read_cmd   = spi_config->spi_config_7.status_reg_read_cmd;
+  qspi_operational_mode = QSPI_MANUAL_BUS_SIZE(cs_no);
+
+  // ensure previous operation is terminated
+  DEASSERT_CSN;
+
+  cmd_len = ((spi_config->spi_config_3._16bit_cmd_valid) && (qspi_operational_mode == OCTA_MODE)) ? 16 : 8;
+  if ((cmd_len == 8) && (spi_config->spi_config_3._16bit_cmd_valid)) {
+    status_reg_read_cmd >>= 8;
+  }
+  qspi_write_to_flash(qspi_reg, cmd_len, status_reg_read_cmd, cs_no);
+
+  if ((spi_config->spi_config_1.flash_type == MX_OCTA_FLASH) && (qspi_operational_mode == OCTA_MODE)) {
+    qspi_write_to_flash(qspi_reg, QSPI_8BIT_LEN * 4, 0x00, cs_no);
+  }
+  if ((qspi_operational_mode == OCTA_MODE) || (qspi_operational_mode == QUAD_MODE)) {
+    dummy_bytes = spi_config->spi_config_5.dummy_bytes_for_rdsr;
+  }
+  while (dummy_bytes) {
+    tmp_dummy = (dummy_bytes & 0x3) ? (dummy_bytes & 3) : 4;
+    qspi_write_to_flash(qspi_reg, (QSPI_8BIT_LEN * tmp_dummy), 0x00, cs_no);
+    dummy_bytes -= tmp_dummy;
+  }
+
+#ifdef CHIP_9118
+  if (QSPI_DATA_DDR_MODE) {
+    READ_4M_FLASH(2, cs_no, _16BIT);
+  } else {
+    READ_4M_FLASH(1, cs_no, 0);
+  }
+#else
+  READ_4M_FLASH(1, cs_no, 0);
+#endif
+  // wait till the fifo empty is deasserted
+  while (qspi_reg->QSPI_STATUS_REG & QSPI_FIFO_EMPTY_RFIFO_S)
+    ;
+#ifdef CHIP_9118
+  if (QSPI_DATA_DDR_MODE) {
+    flash_status = (uint16_t)qspi_reg->QSPI_MANUAL_RD_WR_DATA_REG;
+  } else {
+    flash_status = (uint8_t)qspi_reg->QSPI_MANUAL_RD_WR_DATA_REG;
+  }
+#else
+  flash_status = (uint8_t)qspi_reg->QSPI_MANUAL_RD_WR_DATA_REG;
+#endif
+
+  qspi_switch_qspi2(qspi_reg, qspi_operational_mode, cs_no);
+  DEASSERT_CSN;
+
+  return flash_status & BIT(spi_config->spi_config_5.busy_bit_pos);
+}
+
+/*==============================================*/
+/**
+ * @fn           static void qspi_flash_async_issue(qspi_flash_async_t *ctx, qspi_flash_async_op_t *op)
+ * @brief        This API used to take the controller out of auto mode and issue the
+ *               program/erase command of op. It returns as soon as the command and
+ *               data are on the bus, without waiting for the flash to finish.
+ * @param[in]    ctx             :   non-blocking program/erase context
+ * @param[in]    op              :   operation to issue
+ * @return       none
+ */
+static void qspi_flash_async_issue(qspi_flash_async_t *ctx, qspi_flash_async_op_t *op)
+{
+  qspi_reg_t *qspi_reg     = ctx->qspi_reg;
+  spi_config_t *spi_config = ctx->spi_config;
+  uint32_t cs_no           = spi_config->spi_config_2.cs_no;
+  uint32_t addr            = op->addr;
+  uint32_t cmd_len, cmd_to_drive, index;
+
+  // Ignoring bits more than address width.
+  if (spi_config->spi_config_2.addr_width == 4) {
+    addr &= 0x3FFFFFF;
+  } else {
+    addr &= (uint32_t)((1 << (spi_config->spi_config_2.addr_width * 8)) - 1);
+  }
+
+  ctx->prev_state = 0;
+  // Check if already auto mode enabled
+  if (qspi_reg->QSPI_BUS_MODE_REG & AUTO_MODE) {
+    qspi_reg->QSPI_BUS_MODE_REG &= ~AUTO_MODE;
+    while (qspi_reg->QSPI_STATUS_REG & AUTO_MODE_ENABLED)
+      ;
+    ctx->prev_state = 1;
+  }
+  if (spi_config->spi_config_4.continue_fetch_en) {
+    qspi_reg->QSPI_AUTO_CONITNUE_FETCH_CTRL_REG &= ~CONTINUE_FETCH_EN;
+  }
+
+  // switch qspi to inst mode
+  qspi_switch_qspi2(qspi_reg, spi_config->spi_config_3.wr_inst_mode, cs_no);
+
+  // if hardware control needs to be disabled, do it here.
+  if (ctx->dis_hw_ctrl) {
+    qspi_reg->QSPI_MANUAL_CONFIG_REG &= ~HW_CTRL_MODE;
+    while (qspi_reg->QSPI_STATUS_REG & HW_CTRLD_QSPI_MODE_CTRL_SCLK)
+      ;
+  }
+
+  qspi_flash_async_write_cmd(qspi_reg, spi_config, WREN, WREN2);
+
+  if (op->type == QSPI_ASYNC_PAGE_PROGRAM) {
+#ifdef CHIP_9118
+    if (spi_config->spi_config_3.ddr_mode_en && (spi_config->spi_config_1.flash_type == MX_OCTA_FLASH)) {
+      qspi_write_to_flash(qspi_reg,
+                          QSPI_16BIT_LEN,
+                          ((spi_config->spi_config_3.wr_cmd << 8) | spi_config->spi_config_4._16bit_wr_cmd_msb),
+                          cs_no);
+    } else
+#endif
+    {
+      qspi_write_to_flash(qspi_reg, CMD_LEN, spi_config->spi_config_3.wr_cmd, cs_no);
+      if (spi_config->spi_config_3._16bit_cmd_valid) {
+        qspi_write_to_flash(qspi_reg, QSPI_8BIT_LEN, spi_config->spi_config_4._16bit_wr_cmd_msb, cs_no);
+      }
+    }
+    qspi_switch_qspi2(qspi_reg, spi_config->spi_config_3.wr_addr_mode, cs_no);
+    qspi_write_to_flash(qspi_reg, ADDR_LEN, addr, cs_no);
+
+    // write swap en is done only for data
+    qspi_switch_qspi2(qspi_reg, spi_config->spi_config_3.wr_data_mode, cs_no);
+    qspi_reg->QSPI_MANUAL_CONFIG_2_REG = (qspi_reg->QSPI_MANUAL_CONFIG_2_REG & (uint32_t)~0xF)
+                                         | (spi_config->spi_config_2.swap_en << cs_no);
+    index = 0;
+    // word writes while the buffer is aligned and at least a word is left
+    if (!((uint32_t)op->data & 0x3)) {
+      for (; (op->len - index) >= 4; index += 4) {
+        qspi_write_to_flash(qspi_reg, 32, *(const uint32_t *)(op->data + index), cs_no);
+      }
+    }
+    for (; index < op->len; index++) {
+      qspi_write_to_flash(qspi_reg, 8, op->data[index], cs_no);
+    }
+    qspi_reg->QSPI_MANUAL_CONFIG_2_REG &= (uint32_t)~0xF;
+  } else {
+    cmd_len = spi_config->spi_config_3._16bit_cmd_valid ? 16 : 8;
+    if (op->type == QSPI_ASYNC_SECTOR_ERASE) {
+      cmd_to_drive = spi_config->spi_config_6.sector_erase_cmd;
+    } else if (op->type == QSPI_ASYNC_BLOCK_ERASE) {
+      cmd_to_drive = spi_config->spi_config_5.block_erase_cmd;
+    } else {
+      cmd_to_drive = spi_config->spi_config_6.chip_erase_cmd;
+    }
+    qspi_write_to_flash(qspi_reg, cmd_len, cmd_to_drive, cs_no);
+    if (op->type != QSPI_ASYNC_CHIP_ERASE) {
+      qspi_write_to_flash(qspi_reg, ADDR_LEN, addr, cs_no);
+    }
+  }
+  DEASSERT_CSN;
+  qspi_switch_qspi2(qspi_reg, spi_config->spi_config_1.inst_mode, cs_no);
+
+  op->polls       = 0;
+  op->issue_ticks = ctx->get_ticks ? ctx->get_ticks() : 0;
+}
+
+/*==============================================*/
+/**
+ * @fn           static void qspi_flash_async_finish(qspi_flash_async_t *ctx, qspi_flash_async_op_t *op)
+ * @brief        This API used to close an operation once the flash reported idle: it
+ *               disables writes, restores auto mode and records the timing statistics.
+ * @param[in]    ctx             :   non-blocking program/erase context
+ * @param[in]    op              :   operation that completed
+ * @return       none
+ */
+static void qspi_flash_async_finish(qspi_flash_async_t *ctx, qspi_flash_async_op_t *op)
+{
+  qspi_reg_t *qspi_reg     = ctx->qspi_reg;
+  spi_config_t *spi_config = ctx->spi_config;
+  qspi_flash_async_stats_t *stats;
+  uint32_t elapsed;
+
+  op->complete_ticks = ctx->get_ticks ? ctx->get_ticks() : 0;
+
+  qspi_flash_async_write_cmd(qspi_reg, spi_config, WRDI, WRDI2);
+
+  // if hardware control was disabled, enable it here
+  if (ctx->dis_hw_ctrl) {
+    qspi_reg->QSPI_MANUAL_CONFIG_REG |= HW_CTRL_MODE;
+    while (!(qspi_reg->QSPI_STATUS_REG & HW_CTRLD_QSPI_MODE_CTRL_SCLK))
+      ;
+  }
+  if (ctx->prev_state == 1) {
+    qspi_reg->QSPI_BUS_MODE_REG |= AUTO_MODE;
+    while (!(qspi_reg->QSPI_STATUS_REG & AUTO_MODE_ENABLED))
+      ;
+  }
+  if (spi_config->spi_config_4.continue_fetch_en) {
+    qspi_reg->QSPI_AUTO_CONITNUE_FETCH_CTRL_REG |= CONTINUE_FETCH_EN;
+  }
+
+  // tick counter wrap around is handled by the unsigned subtraction
+  elapsed = op->complete_ticks - op->issue_ticks;
+  stats   = &ctx->stats[op->type];
+  stats->count++;
+  stats->total_ticks += elapsed;
+  stats->total_polls += op->polls;
+  if (elapsed > stats->max_ticks) {
+    stats->max_ticks = elapsed;
+  }
+}
+
+/*==============================================*/
+/**
+ * @fn           uint32_t qspi_flash_async_init(qspi_flash_async_t *ctx,
+ *                                              qspi_reg_t *qspi_reg,
+ *                                              spi_config_t *spi_config,
+ *                                              uint16_t page_size,
+ *                                              uint32_t dis_hw_ctrl,
+ *                                              uint32_t (*get_ticks)(void))
+ * @brief        This API used to initialize a non-blocking program/erase context.
+ *               Operations queued on the context are issued by qspi_flash_async_submit()
+ *               and completed by qspi_flash_async_process(), which polls the flash
+ *               status once per call instead of spinning until the flash is idle.
+ *               Dual flash mode is not supported.
+ * @param[in]    ctx             :   context to initialize
+ * @param[in]    qspi_reg        :   qspi register pointer
+ * @param[in]    spi_config      :   pointer to the SPI configuration, flash must already be initialized
+ * @param[in]    page_size       :   flash page size in bytes, power of two
+ * @param[in]    dis_hw_ctrl     :   hardware control needs to be disabled while an operation runs
+ * @param[in]    get_ticks       :   free running tick source used for the statistics, may be NULL
+ * @return       RSI_OK on success, RSI_FAIL on invalid parameters
+ */
+uint32_t qspi_flash_async_init(qspi_flash_async_t *ctx,
+                               qspi_reg_t *qspi_reg,
+                               spi_config_t *spi_config,
+                               uint16_t page_size,
+                               uint32_t dis_hw_ctrl,
+                               uint32_t (*get_ticks)(void))
+{
+  if ((ctx == NULL) || (qspi_reg == NULL) || (spi_config == NULL)) {
+    return (uint32_t)RSI_FAIL;
+  }
+  if ((page_size == 0) || (page_size & (page_size - 1)) || spi_config->spi_config_4.dual_flash_mode) {
+    return (uint32_t)RSI_FAIL;
+  }
+  ctx->qspi_reg    = qspi_reg;
+  ctx->spi_config  = spi_config;
+  ctx->page_size   = page_size;
+  ctx->dis_hw_ctrl = (uint8_t)(dis_hw_ctrl ? 1 : 0);
+  ctx->get_ticks   = get_ticks;
+  ctx->prev_state  = 0;
+  ctx->head        = NULL;
+  ctx->tail        = NULL;
+  for (uint32_t type = 0; type < QSPI_ASYNC_OP_TYPES; type++) {
+    ctx->stats[type].count       = 0;
+    ctx->stats[type].total_ticks = 0;
+    ctx->stats[type].max_ticks   = 0;
+    ctx->stats[type].total_polls = 0;
+  }
+  return RSI_OK;
+}
+
+/*==============================================*/
+/**
+ * @fn           uint32_t qspi_flash_async_submit(qspi_flash_async_t *ctx, qspi_flash_async_op_t *op)
+ * @brief        This API used to queue a program/erase operation. If the flash is idle
+ *               the command is issued right away, otherwise it is issued by
+ *               qspi_flash_async_process() when the previous operation completes.
+ *               While an operation is outstanding the controller stays in manual mode,
+ *               so code must not execute in place from the same flash.
+ * @param[in]    ctx             :   non-blocking program/erase context
+ * @param[in]    op              :   operation to queue, must stay valid until its callback runs
+ * @return       RSI_OK on success, RSI_FAIL on invalid parameters
+ */
+uint32_t qspi_flash_async_submit(qspi_flash_async_t *ctx, qspi_flash_async_op_t *op)
+{
+  uint32_t primask;
+
+  if ((ctx == NULL) || (op == NULL) || (op->type >= QSPI_ASYNC_OP_TYPES)) {
+    return (uint32_t)RSI_FAIL;
+  }
+  if (op->type == QSPI_ASYNC_PAGE_PROGRAM) {
+    // a page program wraps around inside the page, so it must not cross a page boundary
+    if ((op->data == NULL) || (op->len == 0)
+        || (((op->addr & (ctx->page_size - 1)) + op->len) > ctx->page_size)) {
+      return (uint32_t)RSI_FAIL;
+    }
+  }
+  op->next = NULL;
+
+  // the queue and the controller are shared with the context running qspi_flash_async_process()
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (ctx->tail == NULL) {
+    ctx->head = op;
+    ctx->tail = op;
+    qspi_flash_async_issue(ctx, op);
+  } else {
+    ctx->tail->next = op;
+    ctx->tail       = op;
+  }
+  __set_PRIMASK(primask);
+
+  return RSI_OK;
+}
+
+/*==============================================*/
+/**
+ * @fn           uint32_t qspi_flash_async_process(qspi_flash_async_t *ctx)
+ * @brief        This API used to advance the program/erase queue. It reads the flash
+ *               status once; when the operation in flight is done it restores the
+ *               controller, calls the completion callback and issues the next queued
+ *               operation. Call it periodically from a timer interrupt or the main loop.
+ * @param[in]    ctx             :   non-blocking program/erase context
+ * @return       0 when the queue is empty, non zero while operations are outstanding
+ */
+uint32_t qspi_flash_async_process(qspi_flash_async_t *ctx)
+{
+  qspi_flash_async_op_t *op;
+  uint32_t primask;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  op = ctx->head;
+  if (op == NULL) {
+    __set_PRIMASK(primask);
+    return 0;
+  }
+  op->polls++;
+  if (qspi_flash_async_is_busy(ctx->qspi_reg, ctx->spi_config)) {
+    __set_PRIMASK(primask);
+    return 1;
+  }
+  qspi_flash_async_finish(ctx, op);
+  ctx->head = op->next;
+  if (ctx->head == NULL) {
+    ctx->tail = NULL;
+  } else {
+    qspi_flash_async_issue(ctx, ctx->head);
+  }
+  __set_PRIMASK(primask);
+
+  // callback runs with interrupts restored so it may submit further operations
+  if (op->callback != NULL) {
+    op->callback(op, RSI_OK, op->user_data);
+  }
+  return (ctx->head != NULL);
+}
+
+/*==============================================*/
+/**
+ * @fn           const qspi_flash_async_stats_t *qspi_flash_async_get_stats(const qspi_flash_async_t *ctx,
+ *                                                                          qspi_flash_async_op_type_t type)
+ * @brief        This API used to get the timing statistics of one operation type
+ * @param[in]    ctx             :   non-blocking program/erase context
+ * @param[in]    type            :   operation type
+ * @return       pointer to the statistics, NULL on invalid parameters
+ */
+const qspi_flash_async_stats_t *qspi_flash_async_get_stats(const qspi_flash_async_t *ctx,
+                                                           qspi_flash_async_op_type_t type)
+{
+  if ((ctx == NULL) || (type >= QSPI_ASYNC_OP_TYPES)) {
+    return NULL;
+  }
+  return &ctx->stats[type];
+}
@@ -28,8 +28,6 @@
 ******************************************************************************/
 
 #include "rsi_ccp_user_config.h"
-#ifndef UDMA_ROMDRIVER_PRESENT
-
 #include "rsi_rom_udma.h"
 #include "rsi_udma.h"
 
@@ -37,6 +35,8 @@
 extern "C" {
 #endif
 
+#ifndef UDMA_ROMDRIVER_PRESENT
+
 /*==============================================*/
 /**
  * @fn          RSI_DRIVER_VERSION_M4 RSI_UDMA_GetVersion(void)
@@ -716,10 +716,266 @@ void udma_interrupt_handler(RSI_UDMA_HANDLE_T pHandle)
     return;
   }
 }
+#endif //UDMA_ROMDRIVER_PRESENT
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t udma_sg_pool_init(RSI_UDMA_SG_POOL_T *pPool,
+ *                                            RSI_UDMA_DESC_T *pDesc,
+ *                                            uint32_t blockCount,
+ *                                            uint32_t blockSize,
+ *                                            uint32_t (*getTicks)(void))
+ * @brief		This API is used to initialize a scatter-gather descriptor pool. The pool
+ *              is split into blockCount blocks of blockSize descriptors, each block holds
+ *              the task list of one chain.
+ * @param[in]	pPool	   :  Pointer to the pool
+ * @param[in]	pDesc	   :  Descriptor storage of blockCount * blockSize entries, 4 byte aligned
+ * @param[in]	blockCount :  Number of chains the pool can hold (1 to 32)
+ * @param[in]	blockSize  :  Maximum chain length (1 to 255)
+ * @param[in]	getTicks   :  Free running tick source used for the latency counters, may be NULL
+ * @return 		RSI_OK - if success
+ */
+rsi_error_t udma_sg_pool_init(RSI_UDMA_SG_POOL_T *pPool,
+                              RSI_UDMA_DESC_T *pDesc,
+                              uint32_t blockCount,
+                              uint32_t blockSize,
+                              uint32_t (*getTicks)(void))
+{
+  if ((pPool == NULL) || (pDesc == NULL) || (((uint32_t)pDesc & 0x3) != 0)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  if ((blockCount == 0) || (blockCount > UDMA_SG_POOL_MAX_BLOCKS) || (blockSize == 0)
+      || (blockSize > UDMA_SG_MAX_CHAIN_LENGTH)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  memset(pPool, 0, sizeof(RSI_UDMA_SG_POOL_T));
+  pPool->pDesc      = pDesc;
+  pPool->blockCount = blockCount;
+  pPool->blockSize  = blockSize;
+  pPool->getTicks   = getTicks;
+  pPool->freeMap    = (blockCount == UDMA_SG_POOL_MAX_BLOCKS) ? 0xFFFFFFFF : (SET_BIT(blockCount) - 1);
+  return RSI_OK;
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t udma_sg_chain_build(RSI_UDMA_SG_POOL_T *pPool,
+ *                                              const RSI_UDMA_SG_SEGMENT_T *pSegments,
+ *                                              uint32_t segmentCount,
+ *                                              uint32_t transferType,
+ *                                              RSI_UDMA_SG_CHAIN_T *pChain)
+ * @brief		This API is used to build a scatter-gather chain from a list of segments.
+ *              A task list is taken from the pool and filled with one alternate
+ *              descriptor per segment; every task but the last one uses the alternate
+ *              scatter-gather mode, the last one ends the chain in auto (memory) or
+ *              basic (peripheral) mode.
+ * @param[in]	pPool	     :  Pointer to the pool
+ * @param[in]	pSegments	 :  Segment list
+ * @param[in]	segmentCount :  Number of segments (1 to pool block size)
+ * @param[in]	transferType :  UDMA_MODE_MEM_SCATTER_GATHER or UDMA_MODE_PER_SCATTER_GATHER
+ * @param[out]	pChain	     :  Chain, ready for udma_sg_chain_start()
+ * @return 		RSI_OK - if success, ERROR_UDMA_INVALID_ARG on bad arguments or when the pool is exhausted
+ */
+rsi_error_t udma_sg_chain_build(RSI_UDMA_SG_POOL_T *pPool,
+                                const RSI_UDMA_SG_SEGMENT_T *pSegments,
+                                uint32_t segmentCount,
+                                uint32_t transferType,
+                                RSI_UDMA_SG_CHAIN_T *pChain)
+{
+  RSI_UDMA_CHA_CONFIG_DATA_T vsUDMAChaConfigData;
+  RSI_UDMA_DESC_T *pTask;
+  const RSI_UDMA_SG_SEGMENT_T *pSeg;
+  uint32_t block, primask, index, lastOffset;
+
+  if ((pPool == NULL) || (pSegments == NULL) || (pChain == NULL)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  if ((segmentCount == 0) || (segmentCount > pPool->blockSize)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  if ((transferType != UDMA_MODE_MEM_SCATTER_GATHER) && (transferType != UDMA_MODE_PER_SCATTER_GATHER)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  for (index = 0; index < segmentCount; index++) {
+    if ((pSegments[index].length == 0) || (pSegments[index].length > UDMA_SG_MAX_SEGMENT_TRANSFER)
+        || (pSegments[index].width > SRC_SIZE_32)) {
+      return ERROR_UDMA_INVALID_ARG;
+    }
+  }
+
+  // take the lowest free block, the pool is shared with the completion interrupt
+  primask = __get_PRIMASK();
+  __disable_irq();
+  if (pPool->freeMap == 0) {
+    __set_PRIMASK(primask);
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  block = __CLZ(__RBIT(pPool->freeMap));
+  pPool->freeMap &= ~SET_BIT(block);
+  __set_PRIMASK(primask);
+
+  pTask = &pPool->pDesc[block * pPool->blockSize];
+  for (index = 0; index < segmentCount; index++, pTask++) {
+    pSeg       = &pSegments[index];
+    lastOffset = (pSeg->length - 1) << pSeg->width;
+
+    // end pointers point at the last item of the segment
+    pTask->pSrcEndAddr = pSeg->srcNoInc ? pSeg->pSrc : (uint8_t *)pSeg->pSrc + lastOffset;
+    pTask->pDstEndAddr = pSeg->dstNoInc ? pSeg->pDst : (volatile uint8_t *)pSeg->pDst + lastOffset;
+
+    if (index == (segmentCount - 1)) {
+      vsUDMAChaConfigData.transferType =
+        (transferType == UDMA_MODE_MEM_SCATTER_GATHER) ? UDMA_MODE_AUTO : UDMA_MODE_BASIC;
+    } else {
+      vsUDMAChaConfigData.transferType = (transferType == UDMA_MODE_MEM_SCATTER_GATHER)
+                                           ? UDMA_MODE_MEM_ALT_SCATTER_GATHER
+                                           : UDMA_MODE_PER_ALT_SCATTER_GATHER;
+    }
+    vsUDMAChaConfigData.nextBurst          = 0x0;
+    vsUDMAChaConfigData.totalNumOfDMATrans = (unsigned int)((pSeg->length - 1) & 0x03FF);
+    vsUDMAChaConfigData.rPower             = (unsigned int)(pSeg->rPower & 0x0F);
+    vsUDMAChaConfigData.srcProtCtrl        = 0x0;
+    vsUDMAChaConfigData.dstProtCtrl        = 0x0;
+    vsUDMAChaConfigData.srcSize            = pSeg->width;
+    vsUDMAChaConfigData.srcInc             = pSeg->srcNoInc ? SRC_INC_NONE : pSeg->width;
+    vsUDMAChaConfigData.dstSize            = pSeg->width;
+    vsUDMAChaConfigData.dstInc             = pSeg->dstNoInc ? DST_INC_NONE : pSeg->width;
+
+    pTask->vsUDMAChaConfigData1 = vsUDMAChaConfigData;
+    pTask->Spare                = 0;
+  }
+
+  pChain->pTaskList    = &pPool->pDesc[block * pPool->blockSize];
+  pChain->taskCount    = segmentCount;
+  pChain->transferType = transferType;
+  pChain->block        = block;
+  return RSI_OK;
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t udma_sg_chain_start(RSI_UDMA_HANDLE_T pHandle,
+ *                                              RSI_UDMA_SG_POOL_T *pPool,
+ *                                              uint8_t dmaCh,
+ *                                              RSI_UDMA_SG_CHAIN_T *pChain)
+ * @brief		This API is used to load a chain into the primary descriptor of a channel.
+ *              The channel must already be configured with udma_setup_channel(); it is
+ *              enabled and triggered by the caller as for any other transfer. Call
+ *              udma_sg_chain_complete() from the completion callback of the channel.
+ * @param[in]	pHandle	 :  Pointer to driver context handle
+ * @param[in]	pPool	 :  Pointer to the pool the chain was built from
+ * @param[in]	dmaCh	 :  DMA channel
+ * @param[in]	pChain	 :  Chain returned by udma_sg_chain_build()
+ * @return 		RSI_OK - if success
+ */
+rsi_error_t udma_sg_chain_start(RSI_UDMA_HANDLE_T pHandle,
+                                RSI_UDMA_SG_POOL_T *pPool,
+                                uint8_t dmaCh,
+                                RSI_UDMA_SG_CHAIN_T *pChain)
+{
+  RSI_UDMA_SG_CHANNEL_STATS_T *pStats;
+  rsi_error_t status;
+
+  if ((pPool == NULL) || (pChain == NULL) || (dmaCh > CHNL_31) || (pPool->pActive[dmaCh] != NULL)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  status = RSI_UDMA_SetChannelScatterGatherTransfer(pHandle,
+                                                    dmaCh,
+                                                    (uint8_t)pChain->taskCount,
+                                                    pChain->pTaskList,
+                                                    pChain->transferType);
+  if (status != RSI_OK) {
+    return status;
+  }
+
+  pStats = &pPool->stats[dmaCh];
+  pStats->chainsStarted++;
+  pStats->segments += pChain->taskCount;
+  if (pChain->taskCount > pStats->maxChainLength) {
+    pStats->maxChainLength = pChain->taskCount;
+  }
+  pPool->startTicks[dmaCh] = pPool->getTicks ? pPool->getTicks() : 0;
+  pPool->pActive[dmaCh]    = pChain;
+  return RSI_OK;
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t udma_sg_chain_complete(RSI_UDMA_SG_POOL_T *pPool, uint8_t dmaCh)
+ * @brief		This API is used to retire the chain running on a channel. It updates the
+ *              latency counters and returns the task list to the pool. It is meant to
+ *              be called from the UDMA completion callback.
+ * @param[in]	pPool	 :  Pointer to the pool
+ * @param[in]	dmaCh	 :  DMA channel
+ * @return 		RSI_OK - if success, ERROR_UDMA_INVALID_ARG if no chain runs on the channel
+ */
+rsi_error_t udma_sg_chain_complete(RSI_UDMA_SG_POOL_T *pPool, uint8_t dmaCh)
+{
+  RSI_UDMA_SG_CHANNEL_STATS_T *pStats;
+  RSI_UDMA_SG_CHAIN_T *pChain;
+  uint32_t latency;
+
+  if ((pPool == NULL) || (dmaCh > CHNL_31) || (pPool->pActive[dmaCh] == NULL)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  pChain                = pPool->pActive[dmaCh];
+  pPool->pActive[dmaCh] = NULL;
+
+  // tick counter wrap around is handled by the unsigned subtraction
+  latency = pPool->getTicks ? (pPool->getTicks() - pPool->startTicks[dmaCh]) : 0;
+  pStats  = &pPool->stats[dmaCh];
+  pStats->chainsCompleted++;
+  pStats->totalLatencyTicks += latency;
+  if (latency > pStats->maxLatencyTicks) {
+    pStats->maxLatencyTicks = latency;
+  }
+
+  return udma_sg_chain_release(pPool, pChain);
+}
+
+/*==============================================*/
+/**
+ * @fn          rsi_error_t udma_sg_chain_release(RSI_UDMA_SG_POOL_T *pPool, RSI_UDMA_SG_CHAIN_T *pChain)
+ * @brief		This API is used to return the task list of a chain to the pool without
+ *              running it. Chains that were started are released by udma_sg_chain_complete().
+ * @param[in]	pPool	 :  Pointer to the pool
+ * @param[in]	pChain	 :  Chain returned by udma_sg_chain_build()
+ * @return 		RSI_OK - if success
+ */
+rsi_error_t udma_sg_chain_release(RSI_UDMA_SG_POOL_T *pPool, RSI_UDMA_SG_CHAIN_T *pChain)
+{
+  uint32_t primask;
+
+  if ((pPool == NULL) || (pChain == NULL) || (pChain->block >= pPool->blockCount)) {
+    return ERROR_UDMA_INVALID_ARG;
+  }
+  primask = __get_PRIMASK();
+  __disable_irq();
+  pPool->freeMap |= SET_BIT(pChain->block);
+  __set_PRIMASK(primask);
+
+  pChain->pTaskList = NULL;
+  pChain->taskCount = 0;
+  return RSI_OK;
+}
+
+/*==============================================*/
+/**
+ * @fn          const RSI_UDMA_SG_CHANNEL_STATS_T *udma_sg_get_channel_stats(const RSI_UDMA_SG_POOL_T *pPool,
+ *                                                                         uint8_t dmaCh)
+ * @brief		This API is used to get the chain length and completion latency counters of a channel
+ * @param[in]	pPool	 :  Pointer to the pool
+ * @param[in]	dmaCh	 :  DMA channel
+ * @return 		Pointer to the counters, NULL on bad arguments
+ */
+const RSI_UDMA_SG_CHANNEL_STATS_T *udma_sg_get_channel_stats(const RSI_UDMA_SG_POOL_T *pPool, uint8_t dmaCh)
+{
+  if ((pPool == NULL) || (dmaCh > CHNL_31)) {
+    return NULL;
+  }
+  return &pPool->stats[dmaCh];
+}
 
 #ifdef __cplusplus
 }
 #endif
-#else
-typedef int dummy; // To remove empty translation unit warning.
-#endif //UDMA_ROMDRIVER_PRESENT
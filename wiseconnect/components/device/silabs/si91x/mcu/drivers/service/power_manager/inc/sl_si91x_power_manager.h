@@ -925,6 +925,16 @@ boolean_t sl_si91x_power_manager_is_ok_to_sleep(void);
 *  ```
 *   to any application code source file that adds and removes requirements.
 *
+*   ***Transition profiler***
+*
+*   By setting the define SL_SI91X_POWER_MANAGER_PROFILER to 1, each power state transition is timed
+*   phase by phase (preparation, clock switch, supply, flash, retention, resume, notification) and
+*   aggregated per from/to pair as count, min/avg/max and a histogram. Wakeups are also attributed to
+*   their wakeup source. The profile is read with @ref sl_si91x_power_manager_profiler_get_transition() and
+*   @ref sl_si91x_power_manager_profiler_get_wakeup(), or printed with @ref sl_si91x_power_manager_profiler_print(),
+*   also every SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL wakeups when that define is not 0.
+*   The API is declared in sl_si91x_power_manager_profiler.h.
+*
 *
 *   @n @section POWER-MANAGER_Config Configuration
 *
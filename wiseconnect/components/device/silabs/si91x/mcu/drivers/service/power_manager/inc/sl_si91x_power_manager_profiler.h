@@ -0,0 +1,222 @@
+/***************************************************************************/ /**
+ * @file sl_si91x_power_manager_profiler.h
+ * @brief Power Manager Transition Profiler API
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#ifndef SL_SI91X_POWER_MANAGER_PROFILER_H
+#define SL_SI91X_POWER_MANAGER_PROFILER_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#include "sl_si91x_power_manager.h"
+
+/***************************************************************************/
+/**
+ * @addtogroup POWER-MANAGER Power Manager
+ * @ingroup SI91X_SERVICE_APIS
+ * @{
+ ******************************************************************************/
+
+// -----------------------------------------------------------------------------
+// Defines
+
+#ifndef SL_SI91X_POWER_MANAGER_PROFILER_MAX_TRANSITIONS
+#define SL_SI91X_POWER_MANAGER_PROFILER_MAX_TRANSITIONS 16 ///< Number of from/to pairs that can be profiled.
+#endif
+
+#ifndef SL_SI91X_POWER_MANAGER_PROFILER_HISTOGRAM_BUCKETS
+#define SL_SI91X_POWER_MANAGER_PROFILER_HISTOGRAM_BUCKETS 16 ///< Number of log2 histogram buckets of a transition.
+#endif
+
+#ifndef SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL
+#define SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL 0 ///< Wakeups from sleep between two prints, 0 to disable.
+#endif
+
+// -----------------------------------------------------------------------------
+// Data Types
+
+/// @brief Enumeration for the phases of a power state transition.
+typedef enum {
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_PREPARE,      ///< Low power hardware and wakeup source configuration.
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH, ///< Clock switch to the frequency of the new state.
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_SUPPLY,       ///< PMU, LDO and reference clock changes.
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_FLASH,        ///< Flash and NWP re-initialization after PS2.
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_RETENTION,    ///< Retention and PLL configuration before sleep.
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_RESUME,       ///< Restore of the M4 active status after wakeup.
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_NOTIFY,       ///< Transition event subscriber callbacks.
+  SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT,        ///< Last enum for validation.
+} sl_power_manager_profiler_phase_t;
+
+/// @brief Enumeration for the wakeup sources that wakeups are attributed to.
+typedef enum {
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_DST,        ///< Deep Sleep Timer.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_WIRELESS,   ///< Wireless.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_GPIO,       ///< UULP GPIO.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COMPARATOR, ///< Comparator.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_SYSRTC,     ///< Sysrtc.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_ULPSS,      ///< ULP peripheral.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_SDCSS,      ///< SDC (Sensor data collector).
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_ALARM,      ///< Calendar alarm.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_SEC,        ///< Calendar second.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_MSEC,       ///< Calendar milli second.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_WDT,        ///< Watchdog interrupt.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_UNKNOWN,    ///< No source could be identified.
+  SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COUNT,      ///< Last enum for validation.
+} sl_power_manager_profiler_wakeup_t;
+
+/// @brief Structure to store the duration statistics of a transition or phase, in nanoseconds.
+typedef struct {
+  uint32_t count;  ///< Number of samples.
+  uint32_t min_ns; ///< Shortest sample.
+  uint32_t max_ns; ///< Longest sample.
+  uint32_t avg_ns; ///< Average sample, computed when the statistics are read.
+  uint64_t sum_ns; ///< Sum of all samples.
+} sl_power_manager_profiler_stats_t;
+
+/// @brief Structure to store the profile of one from/to power state transition.
+typedef struct {
+  sl_power_state_t from;                   ///< Power state left.
+  sl_power_state_t to;                     ///< Power state entered.
+  sl_power_manager_profiler_stats_t total; ///< Whole transition, sum of its phases.
+  sl_power_manager_profiler_stats_t
+    phase[SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT]; ///< Each phase, counted when it took place.
+  uint32_t
+    histogram[SL_SI91X_POWER_MANAGER_PROFILER_HISTOGRAM_BUCKETS]; ///< Bucket n counts totals below 2^n us, the last all above.
+} sl_power_manager_profiler_transition_t;
+
+// -----------------------------------------------------------------------------
+// Prototypes
+
+/***************************************************************************/
+/**
+ * @brief To get the profile of a power state transition.
+ *
+ * @details Transitions are recorded from the first time they happen once the profiler is enabled
+ *          with SL_SI91X_POWER_MANAGER_PROFILER. A transition to sleep covers the time until the
+ *          M4 stops, and the wakeup is recorded separately as a transition from
+ *          SL_SI91X_POWER_MANAGER_SLEEP (or SL_SI91X_POWER_MANAGER_PS1) from the time the M4 resumes.
+ *          Durations are measured with the DWT cycle counter. A phase that changes the core clock
+ *          is converted at the slower of the two clocks, so its duration is an upper bound.
+ *
+ * @param[in]  from    Power state left (of type \ref sl_power_state_t).
+ * @param[in]  to      Power state entered (of type \ref sl_power_state_t).
+ * @param[out] profile Copy of the transition profile, with the averages computed.
+ *
+ * @return Status code indicating the result:
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_NULL_POINTER  - Null pointer is passed.
+ *         - SL_STATUS_INVALID_PARAMETER  - Invalid parameter is passed.
+ *         - SL_STATUS_NOT_FOUND  - The transition has not been recorded.
+ *
+ * For more information on status codes, see [SL STATUS DOCUMENTATION](https://docs.silabs.com/gecko-platform/latest/platform-common/status).
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_profiler_get_transition(sl_power_state_t from,
+                                                           sl_power_state_t to,
+                                                           sl_power_manager_profiler_transition_t *profile);
+
+/***************************************************************************/
+/**
+ * @brief To get the profile of a recorded transition by index.
+ *
+ * @details Recorded transitions are stored in the order they first happened. Used to walk all
+ *          recorded transitions, up to \ref sl_si91x_power_manager_profiler_get_transition_count.
+ *
+ * @param[in]  index   Index of the recorded transition.
+ * @param[out] profile Copy of the transition profile, with the averages computed.
+ *
+ * @return Status code indicating the result:
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_NULL_POINTER  - Null pointer is passed.
+ *         - SL_STATUS_NOT_FOUND  - No transition recorded at this index.
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_profiler_get_transition_by_index(uint32_t index,
+                                                                    sl_power_manager_profiler_transition_t *profile);
+
+/***************************************************************************/
+/**
+ * @brief To get the number of recorded from/to transitions.
+ *
+ * @return Number of recorded transitions, at most SL_SI91X_POWER_MANAGER_PROFILER_MAX_TRANSITIONS.
+ ******************************************************************************/
+uint32_t sl_si91x_power_manager_profiler_get_transition_count(void);
+
+/***************************************************************************/
+/**
+ * @brief To get the wakeup statistics of a wakeup source.
+ *
+ * @details Each wakeup from sleep or PS1 is attributed to the source whose NPSS interrupt is pending
+ *          when the M4 resumes. Sources without an NPSS interrupt (Sysrtc, ULP peripherals) are
+ *          attributed when they are the only such source enabled. The statistics are those of the
+ *          wakeup transitions, from resume to the end of the subscriber callbacks.
+ *
+ * @param[in]  source Wakeup source (of type \ref sl_power_manager_profiler_wakeup_t).
+ * @param[out] stats  Copy of the wakeup statistics, with the average computed.
+ *
+ * @return Status code indicating the result:
+ *         - SL_STATUS_OK  - Success.
+ *         - SL_STATUS_NULL_POINTER  - Null pointer is passed.
+ *         - SL_STATUS_INVALID_PARAMETER  - Invalid parameter is passed.
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_profiler_get_wakeup(sl_power_manager_profiler_wakeup_t source,
+                                                       sl_power_manager_profiler_stats_t *stats);
+
+/***************************************************************************/
+/**
+ * @brief To get the number of transitions which could not be recorded.
+ *
+ * @details Transitions are dropped once SL_SI91X_POWER_MANAGER_PROFILER_MAX_TRANSITIONS different
+ *          from/to pairs have been recorded.
+ *
+ * @return Number of dropped transitions.
+ ******************************************************************************/
+uint32_t sl_si91x_power_manager_profiler_get_dropped_count(void);
+
+/***************************************************************************/
+/**
+ * @brief To clear all the recorded transitions and wakeup statistics.
+ ******************************************************************************/
+void sl_si91x_power_manager_profiler_reset(void);
+
+/***************************************************************************/
+/**
+ * @brief To print all the recorded transitions and wakeup statistics with DEBUGOUT.
+ *
+ * @details Also called every SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL wakeups
+ *          by \ref sl_si91x_power_manager_sleep when that define is not 0.
+ ******************************************************************************/
+void sl_si91x_power_manager_profiler_print(void);
+
+/** @} (end addtogroup POWER-MANAGER) */
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SL_SI91X_POWER_MANAGER_PROFILER_H */
@@ -38,6 +38,9 @@ extern "C" {
 #include "sl_si91x_power_manager.h"
 #include "system_si91x.h"
 #include "rsi_power_save.h"
+#if defined(SL_SI91X_POWER_MANAGER_PROFILER) && (SL_SI91X_POWER_MANAGER_PROFILER == ENABLE)
+#include "sl_si91x_power_manager_profiler.h"
+#endif
 
 /***************************************************************************/
 /**
@@ -241,6 +244,82 @@ void sli_si91x_power_manager_low_power_hw_config(boolean_t is_sleep);
  ******************************************************************************/
 void sli_si91x_power_manager_init_debug(void);
 
+//  The transition profiler hooks are called from the power state transition paths.
+// When the profiler is disabled, they are pre-processor no-ops so that the
+// transitions are not slowed down.
+#if defined(SL_SI91X_POWER_MANAGER_PROFILER) && (SL_SI91X_POWER_MANAGER_PROFILER == ENABLE)
+/***************************************************************************/
+/**
+ * @brief To start timing a power state transition.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ * 
+ * A transition still being timed is recorded first.
+ * 
+ * @param[in] from Power State from which the transition takes place (of type \ref sl_power_state_t).
+ * @param[in] to   Power State to which the transition takes place (of type \ref sl_power_state_t).
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_begin(sl_power_state_t from, sl_power_state_t to);
+
+/***************************************************************************/
+/**
+ * @brief To start timing a wakeup, as soon as the M4 resumes.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ * 
+ * The wakeup source is read from the NPSS interrupt status before it is cleared.
+ * 
+ * @param[in] from Sleep state left, SLEEP or PS1 (of type \ref sl_power_state_t).
+ * @param[in] to   Power State to which the M4 returns (of type \ref sl_power_state_t).
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_begin_wakeup(sl_power_state_t from, sl_power_state_t to);
+
+/***************************************************************************/
+/**
+ * @brief To end a phase of the transition being timed.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ * 
+ * The time since the previous phase ended, or since the transition started, is added to the phase.
+ * 
+ * @param[in] phase Phase which just ended (of type \ref sl_power_manager_profiler_phase_t).
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_mark(sl_power_manager_profiler_phase_t phase);
+
+/***************************************************************************/
+/**
+ * @brief To record the transition being timed.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_end(void);
+
+/***************************************************************************/
+/**
+ * @brief To drop the transition being timed, when it did not take place.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_cancel(void);
+
+/***************************************************************************/
+/**
+ * @brief To print the profile every SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL wakeups.
+ * 
+ * @note FOR INTERNAL USE ONLY.
+ * 
+ * Called on return from sleep, with the interrupts enabled.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_wakeup_done(void);
+#else
+#define sli_si91x_power_manager_profiler_begin(from, to)        /* no-op */
+#define sli_si91x_power_manager_profiler_begin_wakeup(from, to) /* no-op */
+#define sli_si91x_power_manager_profiler_mark(phase)            /* no-op */
+#define sli_si91x_power_manager_profiler_end()                  /* no-op */
+#define sli_si91x_power_manager_profiler_cancel()               /* no-op */
+#define sli_si91x_power_manager_profiler_wakeup_done()          /* no-op */
+#endif
+
 /** @} (end addtogroup POWER-MANAGER) */
 
 #ifdef __cplusplus
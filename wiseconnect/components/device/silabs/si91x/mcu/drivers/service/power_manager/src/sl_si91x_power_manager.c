@@ -245,10 +245,15 @@ sl_status_t sl_si91x_power_manager_sleep(void)
   // After wakeup, clock is set to the particular PS4/PS3/PS2 mode.
   status = sl_si91x_power_manager_set_clock_scaling(clock_scaling_mode);
   if (status != SL_STATUS_OK) {
+    sli_si91x_power_manager_profiler_cancel();
     return status;
   }
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
   // Notifies the state transition who has subscribed to it.
   notify_power_state_transition(SL_SI91X_POWER_MANAGER_SLEEP, current_state);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_NOTIFY);
+  sli_si91x_power_manager_profiler_end();
+  sli_si91x_power_manager_profiler_wakeup_done();
   // If it reaches here, then returns SL_STATUS_OK
   return SL_STATUS_OK;
 }
@@ -262,7 +267,10 @@ void sl_si91x_power_manager_standby(void)
   if (sli_si91x_power_manager_is_valid_transition(current_state, SL_SI91X_POWER_MANAGER_STANDBY)) {
     // Validates the state transition for sleep, if valid it transits to standby mode.
     __WFI();
+    sli_si91x_power_manager_profiler_begin(SL_SI91X_POWER_MANAGER_STANDBY, current_state);
     notify_power_state_transition(SL_SI91X_POWER_MANAGER_STANDBY, current_state);
+    sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_NOTIFY);
+    sli_si91x_power_manager_profiler_end();
   }
 }
 
@@ -428,6 +436,8 @@ sl_status_t sli_si91x_power_manager_update_ps_requirement(sl_power_state_t state
       // It goes to sleep with retention with valid ULP peripheral based wakeup source.
       // Notifies the state transition who has subscribed to it.
       notify_power_state_transition(SL_SI91X_POWER_MANAGER_PS1, SL_SI91X_POWER_MANAGER_PS2);
+      sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_NOTIFY);
+      sli_si91x_power_manager_profiler_end();
       // Clears the PS1 requirement
       requirement_ps_table[SL_SI91X_POWER_MANAGER_PS1] -= 1;
       // Added the PS2 requirement
@@ -437,6 +447,8 @@ sl_status_t sli_si91x_power_manager_update_ps_requirement(sl_power_state_t state
 
     // Notifies the state transition who has subscribed to it.
     notify_power_state_transition(current_state, state);
+    sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_NOTIFY);
+    sli_si91x_power_manager_profiler_end();
     // Updates the current state variable.
     current_state = state;
     // If it reaches here, then returns SL_STATUS_OK
@@ -0,0 +1,536 @@
+/***************************************************************************/ /**
+ * @file sl_si91x_power_manager_profiler.c
+ * @brief Power Manager Transition Profiler implementation
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2024 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * SPDX-License-Identifier: Zlib
+ *
+ * The licensor of this software is Silicon Laboratories Inc.
+ *
+ * This software is provided 'as-is', without any express or implied
+ * warranty. In no event will the authors be held liable for any damages
+ * arising from the use of this software.
+ *
+ * Permission is granted to anyone to use this software for any purpose,
+ * including commercial applications, and to alter it and redistribute it
+ * freely, subject to the following restrictions:
+ *
+ * 1. The origin of this software must not be misrepresented; you must not
+ *    claim that you wrote the original software. If you use this software
+ *    in a product, an acknowledgment in the product documentation would be
+ *    appreciated but is not required.
+ * 2. Altered source versions must be plainly marked as such, and must not be
+ *    misrepresented as being the original software.
+ * 3. This notice may not be removed or altered from any source distribution.
+ *
+ ******************************************************************************/
+
+#include "sli_si91x_power_manager.h"
+
+#if defined(SL_SI91X_POWER_MANAGER_PROFILER) && (SL_SI91X_POWER_MANAGER_PROFILER == ENABLE)
+
+#include "rsi_debug.h"
+#include "rsi_power_save.h"
+#include <string.h>
+
+/*******************************************************************************
+ ***************************  DEFINES / MACROS   ********************************
+ ******************************************************************************/
+#define NS_PER_SECOND 1000000000ULL // Nanoseconds in a second
+#define NS_PER_US     1000          // Nanoseconds in a microsecond
+
+// Wakeup source enable bits of MCU_FSM_SLEEP_CTRLS_AND_WAKEUP_MODE, DST_BASED_WAKEUP to WDT_INTR_BASED_WAKEUP
+#define WAKEUP_SOURCES_MASK (0x3FFFUL << 16)
+
+/*******************************************************************************
+ ***************************  Local Types  ********************************
+ ******************************************************************************/
+
+// Transition being timed
+typedef struct {
+  boolean_t is_open;                                              // A transition is being timed
+  sl_power_state_t from;                                          // Power state left
+  sl_power_state_t to;                                            // Power state entered
+  uint32_t last_cycles;                                           // Cycle count at the end of the previous phase
+  uint32_t last_clock;                                            // Core clock at the end of the previous phase
+  uint32_t phase_mask;                                            // Phases which took place
+  uint32_t phase_ns[SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT]; // Duration of each phase
+  sl_power_manager_profiler_wakeup_t wakeup;                      // Wakeup source, COUNT if not a wakeup
+} profiler_sample_t;
+
+// NPSS interrupt status bits of a wakeup source
+typedef struct {
+  uint32_t npss_interrupt;                   // NPSS interrupt status bits
+  sl_power_manager_profiler_wakeup_t source; // Wakeup source
+} profiler_wakeup_map_t;
+
+/*******************************************************************************
+ *********************   LOCAL FUNCTION PROTOTYPES   ***************************
+ ******************************************************************************/
+static void start_cycle_counter(void);
+static uint32_t cycles_to_ns(uint32_t cycles, uint32_t clock);
+static void add_sample(sl_power_manager_profiler_stats_t *stats, uint32_t ns);
+static void compute_average(sl_power_manager_profiler_stats_t *stats);
+static void copy_transition(const sl_power_manager_profiler_transition_t *record,
+                            sl_power_manager_profiler_transition_t *profile);
+static sl_power_manager_profiler_transition_t *get_record(sl_power_state_t from, sl_power_state_t to);
+static sl_power_manager_profiler_wakeup_t get_wakeup_source(void);
+static void commit_sample(void);
+
+/*******************************************************************************
+ *************************** LOCAL VARIABLES   *******************************
+ ******************************************************************************/
+static profiler_sample_t sample;
+static sl_power_manager_profiler_transition_t transitions[SL_SI91X_POWER_MANAGER_PROFILER_MAX_TRANSITIONS];
+static uint32_t transition_count;
+static uint32_t dropped_count;
+static sl_power_manager_profiler_stats_t wakeups[SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COUNT];
+#if (SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL != 0)
+static uint32_t wakeups_since_print;
+#endif
+
+// Wakeup sources with an NPSS interrupt, in order of precedence
+static const profiler_wakeup_map_t wakeup_map[] = {
+  { NPSS_TO_MCU_WDT_INTR, SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_WDT },
+  { NPSS_TO_MCU_GPIO_INTR_0 | NPSS_TO_MCU_GPIO_INTR_1 | NPSS_TO_MCU_GPIO_INTR_2 | NPSS_TO_MCU_GPIO_INTR_3
+      | NPSS_TO_MCU_GPIO_INTR_4,
+    SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_GPIO },
+  { NPSS_TO_MCU_CMP_INTR_1 | NPSS_TO_MCU_CMP_INTR_2 | NPSS_TO_MCU_CMP_INTR_3 | NPSS_TO_MCU_CMP_INTR_4,
+    SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COMPARATOR },
+  { NPSS_TO_MCU_SDC_INTR, SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_SDCSS },
+  { NPSS_TO_MCU_WIRELESS_INTR, SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_WIRELESS },
+  { NPSS_TO_MCU_ALARM_INTR, SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_ALARM },
+  { NPSS_TO_MCU_SEC_INTR, SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_SEC },
+  { NPSS_TO_MCU_MSEC_INTR, SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_MSEC },
+  { NPSS_TO_MCU_DST_INTR, SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_DST },
+};
+
+// Printable names
+static const char *const state_names[LAST_ENUM_POWER_STATE] = { "PS0", "PS1", "PS2", "PS3",
+                                                                 "PS4", "SLEEP", "STANDBY" };
+static const char *const phase_names[SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT] = {
+  "prepare", "clock switch", "supply", "flash", "retention", "resume", "notify"
+};
+static const char *const wakeup_names[SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COUNT] = {
+  "DST", "WIRELESS", "GPIO", "COMPARATOR", "SYSRTC", "ULPSS",
+  "SDCSS", "ALARM", "SEC", "MSEC", "WDT", "UNKNOWN"
+};
+
+/*******************************************************************************
+***********************  Global function Definitions *************************
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Starts timing a power state transition.
+ * Any transition still being timed is recorded first, so that a wakeup which
+ * is followed by another sleep (sleep on ISR exit) is not lost.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_begin(sl_power_state_t from, sl_power_state_t to)
+{
+  commit_sample();
+  start_cycle_counter();
+
+  memset(&sample, 0, sizeof(sample));
+  sample.from        = from;
+  sample.to          = to;
+  sample.wakeup      = SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COUNT;
+  sample.last_clock  = SystemCoreClock;
+  sample.last_cycles = DWT->CYCCNT;
+  sample.is_open     = true;
+}
+
+/*******************************************************************************
+ * Starts timing a wakeup.
+ * The cycle counter does not run while the M4 is powered down, it is restarted
+ * here and the wakeup source is captured. The sleep entry, left open until the
+ * sleep succeeded, is recorded first.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_begin_wakeup(sl_power_state_t from, sl_power_state_t to)
+{
+  sl_power_manager_profiler_wakeup_t source = get_wakeup_source();
+
+  sli_si91x_power_manager_profiler_begin(from, to);
+  sample.wakeup = source;
+}
+
+/*******************************************************************************
+ * Ends a phase of the transition being timed.
+ * The cycles since the previous phase are converted at the slower of the core
+ * clocks at the start and end of the phase, as the clock may change within it.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_mark(sl_power_manager_profiler_phase_t phase)
+{
+  uint32_t cycles = DWT->CYCCNT;
+  uint32_t clock  = SystemCoreClock;
+
+  if (!sample.is_open || (phase >= SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT)) {
+    return;
+  }
+  sample.phase_ns[phase] += cycles_to_ns(cycles - sample.last_cycles,
+                                         (clock < sample.last_clock) ? clock : sample.last_clock);
+  sample.phase_mask |= (1UL << phase);
+  sample.last_cycles = cycles;
+  sample.last_clock  = clock;
+}
+
+/*******************************************************************************
+ * Records the transition being timed.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_end(void)
+{
+  commit_sample();
+}
+
+/*******************************************************************************
+ * Drops the transition being timed.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_cancel(void)
+{
+  sample.is_open = false;
+}
+
+/*******************************************************************************
+ * Prints the profile every SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL
+ * wakeups from sleep.
+ ******************************************************************************/
+void sli_si91x_power_manager_profiler_wakeup_done(void)
+{
+#if (SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL != 0)
+  wakeups_since_print++;
+  if (wakeups_since_print >= SL_SI91X_POWER_MANAGER_PROFILER_PRINT_INTERVAL) {
+    wakeups_since_print = 0;
+    sl_si91x_power_manager_profiler_print();
+  }
+#endif
+}
+
+/*******************************************************************************
+ * Gets the profile of a power state transition.
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_profiler_get_transition(sl_power_state_t from,
+                                                           sl_power_state_t to,
+                                                           sl_power_manager_profiler_transition_t *profile)
+{
+  uint32_t index;
+
+  if (profile == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if ((from >= LAST_ENUM_POWER_STATE) || (to >= LAST_ENUM_POWER_STATE)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  for (index = 0; index < transition_count; index++) {
+    if ((transitions[index].from == from) && (transitions[index].to == to)) {
+      copy_transition(&transitions[index], profile);
+      return SL_STATUS_OK;
+    }
+  }
+  return SL_STATUS_NOT_FOUND;
+}
+
+/*******************************************************************************
+ * Gets the profile of a recorded transition by index.
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_profiler_get_transition_by_index(uint32_t index,
+                                                                    sl_power_manager_profiler_transition_t *profile)
+{
+  if (profile == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (index >= transition_count) {
+    return SL_STATUS_NOT_FOUND;
+  }
+  copy_transition(&transitions[index], profile);
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Returns the number of recorded from/to transitions.
+ ******************************************************************************/
+uint32_t sl_si91x_power_manager_profiler_get_transition_count(void)
+{
+  return transition_count;
+}
+
+/*******************************************************************************
+ * Gets the wakeup statistics of a wakeup source.
+ ******************************************************************************/
+sl_status_t sl_si91x_power_manager_profiler_get_wakeup(sl_power_manager_profiler_wakeup_t source,
+                                                       sl_power_manager_profiler_stats_t *stats)
+{
+  uint32_t primask;
+
+  if (stats == NULL) {
+    return SL_STATUS_NULL_POINTER;
+  }
+  if (source >= SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COUNT) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *stats = wakeups[source];
+  __set_PRIMASK(primask);
+  compute_average(stats);
+  return SL_STATUS_OK;
+}
+
+/*******************************************************************************
+ * Returns the number of transitions which could not be recorded.
+ ******************************************************************************/
+uint32_t sl_si91x_power_manager_profiler_get_dropped_count(void)
+{
+  return dropped_count;
+}
+
+/*******************************************************************************
+ * Clears all the recorded transitions and wakeup statistics.
+ ******************************************************************************/
+void sl_si91x_power_manager_profiler_reset(void)
+{
+  uint32_t primask = __get_PRIMASK();
+  __disable_irq();
+  memset(transitions, 0, sizeof(transitions));
+  memset(wakeups, 0, sizeof(wakeups));
+  transition_count = 0;
+  dropped_count    = 0;
+  sample.is_open   = false;
+  __set_PRIMASK(primask);
+}
+
+/*******************************************************************************
+ * Prints all the recorded transitions and wakeup statistics.
+ * Durations are printed in microseconds, the histogram only lists the
+ * non-empty buckets as "<upper bound in us>:<count>".
+ ******************************************************************************/
+void sl_si91x_power_manager_profiler_print(void)
+{
+  sl_power_manager_profiler_transition_t profile;
+  sl_power_manager_profiler_stats_t stats;
+  uint32_t index;
+  uint32_t item;
+
+  DEBUGOUT("Power Manager transition profile (us: count min/avg/max)\n");
+  for (index = 0; sl_si91x_power_manager_profiler_get_transition_by_index(index, &profile) == SL_STATUS_OK; index++) {
+    DEBUGOUT("%s -> %s: %lu %lu/%lu/%lu\n",
+             state_names[profile.from],
+             state_names[profile.to],
+             (unsigned long)profile.total.count,
+             (unsigned long)(profile.total.min_ns / NS_PER_US),
+             (unsigned long)(profile.total.avg_ns / NS_PER_US),
+             (unsigned long)(profile.total.max_ns / NS_PER_US));
+    for (item = 0; item < SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT; item++) {
+      if (profile.phase[item].count != 0) {
+        DEBUGOUT("  %s: %lu %lu/%lu/%lu\n",
+                 phase_names[item],
+                 (unsigned long)profile.phase[item].count,
+                 (unsigned long)(profile.phase[item].min_ns / NS_PER_US),
+                 (unsigned long)(profile.phase[item].avg_ns / NS_PER_US),
+                 (unsigned long)(profile.phase[item].max_ns / NS_PER_US));
+      }
+    }
+    DEBUGOUT("  histogram:");
+    for (item = 0; item < SL_SI91X_POWER_MANAGER_PROFILER_HISTOGRAM_BUCKETS; item++) {
+      if (profile.histogram[item] != 0) {
+        DEBUGOUT(" %lu:%lu", (unsigned long)(1UL << item), (unsigned long)profile.histogram[item]);
+      }
+    }
+    DEBUGOUT("\n");
+  }
+  for (item = 0; item < SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COUNT; item++) {
+    sl_si91x_power_manager_profiler_get_wakeup((sl_power_manager_profiler_wakeup_t)item, &stats);
+    if (stats.count != 0) {
+      DEBUGOUT("wakeup %s: %lu %lu/%lu/%lu\n",
+               wakeup_names[item],
+               (unsigned long)stats.count,
+               (unsigned long)(stats.min_ns / NS_PER_US),
+               (unsigned long)(stats.avg_ns / NS_PER_US),
+               (unsigned long)(stats.max_ns / NS_PER_US));
+    }
+  }
+  if (dropped_count != 0) {
+    DEBUGOUT("dropped: %lu\n", (unsigned long)dropped_count);
+  }
+}
+
+/*******************************************************************************
+ **********************  Local Function Definition****************************
+ ******************************************************************************/
+
+/*******************************************************************************
+ * Enables the DWT cycle counter.
+ * It is lost when the M4 is powered down in sleep, so it is checked each time.
+ ******************************************************************************/
+static void start_cycle_counter(void)
+{
+  if (!(DWT->CTRL & DWT_CTRL_CYCCNTENA_Msk)) {
+    CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+    DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+  }
+}
+
+/*******************************************************************************
+ * Converts a number of core clock cycles to nanoseconds, saturated to 32 bits.
+ ******************************************************************************/
+static uint32_t cycles_to_ns(uint32_t cycles, uint32_t clock)
+{
+  uint64_t ns;
+
+  if (clock == 0) {
+    return 0;
+  }
+  ns = ((uint64_t)cycles * NS_PER_SECOND) / clock;
+  return (ns > UINT32_MAX) ? UINT32_MAX : (uint32_t)ns;
+}
+
+/*******************************************************************************
+ * Adds a duration to the statistics.
+ ******************************************************************************/
+static void add_sample(sl_power_manager_profiler_stats_t *stats, uint32_t ns)
+{
+  if ((stats->count == 0) || (ns < stats->min_ns)) {
+    stats->min_ns = ns;
+  }
+  if (ns > stats->max_ns) {
+    stats->max_ns = ns;
+  }
+  stats->count++;
+  stats->sum_ns += ns;
+}
+
+/*******************************************************************************
+ * Computes the average of a copy of the statistics.
+ ******************************************************************************/
+static void compute_average(sl_power_manager_profiler_stats_t *stats)
+{
+  stats->avg_ns = (stats->count != 0) ? (uint32_t)(stats->sum_ns / stats->count) : 0;
+}
+
+/*******************************************************************************
+ * Copies a transition record and computes its averages.
+ ******************************************************************************/
+static void copy_transition(const sl_power_manager_profiler_transition_t *record,
+                            sl_power_manager_profiler_transition_t *profile)
+{
+  uint32_t primask;
+  uint32_t phase;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *profile = *record;
+  __set_PRIMASK(primask);
+
+  compute_average(&profile->total);
+  for (phase = 0; phase < SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT; phase++) {
+    compute_average(&profile->phase[phase]);
+  }
+}
+
+/*******************************************************************************
+ * Returns the record of a from/to transition, a new one if not yet recorded.
+ * Returns NULL if all the records are in use.
+ ******************************************************************************/
+static sl_power_manager_profiler_transition_t *get_record(sl_power_state_t from, sl_power_state_t to)
+{
+  uint32_t index;
+
+  for (index = 0; index < transition_count; index++) {
+    if ((transitions[index].from == from) && (transitions[index].to == to)) {
+      return &transitions[index];
+    }
+  }
+  if (transition_count >= SL_SI91X_POWER_MANAGER_PROFILER_MAX_TRANSITIONS) {
+    return NULL;
+  }
+  transitions[transition_count].from = from;
+  transitions[transition_count].to   = to;
+  return &transitions[transition_count++];
+}
+
+/*******************************************************************************
+ * Returns the source of the last wakeup.
+ * The pending NPSS interrupts identify most sources. Sysrtc and ULP peripherals
+ * have none, they are only identified when a single one of them is enabled.
+ ******************************************************************************/
+static sl_power_manager_profiler_wakeup_t get_wakeup_source(void)
+{
+  uint32_t status = RSI_PS_GetWkpUpStatus();
+  uint32_t sources;
+  uint32_t index;
+
+  for (index = 0; index < (sizeof(wakeup_map) / sizeof(wakeup_map[0])); index++) {
+    if (status & wakeup_map[index].npss_interrupt) {
+      return wakeup_map[index].source;
+    }
+  }
+
+  // The register also holds the sleep controls, only the wakeup source bits are compared.
+  sources = RSI_PS_GetWkpSources() & WAKEUP_SOURCES_MASK;
+  if ((sources != 0) && ((sources & ULPSS_BASED_WAKEUP) == sources)) {
+    return SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_ULPSS;
+  }
+#ifdef SYSRTC_BASED_WAKEUP
+  if ((sources != 0) && ((sources & SYSRTC_BASED_WAKEUP) == sources)) {
+    return SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_SYSRTC;
+  }
+#endif
+  return SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_UNKNOWN;
+}
+
+/*******************************************************************************
+ * Records the transition being timed, if any phase of it took place.
+ * The total is the sum of the phases, the histogram bucket is the number of
+ * significant bits of the total in microseconds.
+ ******************************************************************************/
+static void commit_sample(void)
+{
+  sl_power_manager_profiler_transition_t *record;
+  uint32_t primask;
+  uint32_t total_ns = 0;
+  uint32_t total_us;
+  uint32_t bucket = 0;
+  uint32_t phase;
+
+  if (!sample.is_open) {
+    return;
+  }
+  sample.is_open = false;
+  if (sample.phase_mask == 0) {
+    return;
+  }
+  for (phase = 0; phase < SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT; phase++) {
+    if (sample.phase_ns[phase] > (UINT32_MAX - total_ns)) {
+      total_ns = UINT32_MAX;
+    } else {
+      total_ns += sample.phase_ns[phase];
+    }
+  }
+  total_us = total_ns / NS_PER_US;
+  while ((total_us != 0) && (bucket < (SL_SI91X_POWER_MANAGER_PROFILER_HISTOGRAM_BUCKETS - 1))) {
+    total_us >>= 1;
+    bucket++;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  record = get_record(sample.from, sample.to);
+  if (record == NULL) {
+    dropped_count++;
+  } else {
+    add_sample(&record->total, total_ns);
+    for (phase = 0; phase < SL_SI91X_POWER_MANAGER_PROFILER_PHASE_COUNT; phase++) {
+      if (sample.phase_mask & (1UL << phase)) {
+        add_sample(&record->phase[phase], sample.phase_ns[phase]);
+      }
+    }
+    record->histogram[bucket]++;
+  }
+  if (sample.wakeup < SL_SI91X_POWER_MANAGER_PROFILER_WAKEUP_COUNT) {
+    add_sample(&wakeups[sample.wakeup], total_ns);
+  }
+  __set_PRIMASK(primask);
+}
+
+#endif // SL_SI91X_POWER_MANAGER_PROFILER
@@ -207,6 +207,7 @@ sl_status_t sli_si91x_power_manager_change_power_state(sl_power_state_t from, sl
   if ((to == SL_SI91X_POWER_MANAGER_PS1) || (to == SL_SI91X_POWER_MANAGER_PS0)) {
     SL_SI91X_POWER_MANAGER_CORE_EXIT_CRITICAL;
   }
+  sli_si91x_power_manager_profiler_begin(from, to);
   if (ps_transition[from - PS_OFFSET].to_ps[to].fptr != NULL) {
     // If the from and to state transition function pointer is not null,
     // then it calls the function and state change is performed.
@@ -214,6 +215,7 @@ sl_status_t sli_si91x_power_manager_change_power_state(sl_power_state_t from, sl
     status = SL_STATUS_OK;
   } else {
     // If it reached here, returns Null pointer
+    sli_si91x_power_manager_profiler_cancel();
     status = SL_STATUS_NULL_POINTER;
   }
   return status;
@@ -232,6 +234,7 @@ sl_status_t sli_si91x_power_manager_set_sleep_configuration(sl_power_state_t sta
   if ((state < SL_SI91X_POWER_MANAGER_PS2) || (state > SL_SI91X_POWER_MANAGER_PS4)) {
     return SL_STATUS_INVALID_PARAMETER;
   }
+  sli_si91x_power_manager_profiler_begin(state, SL_SI91X_POWER_MANAGER_SLEEP);
   sli_power_sleep_config_t config;
   config.low_freq_clock          = SLI_SI91X_POWER_MANAGER_DISABLE_LF_MODE;
   config.stack_address           = SL_SLEEP_RAM_USAGE_ADDRESS;
@@ -250,6 +253,7 @@ sl_status_t sli_si91x_power_manager_set_sleep_configuration(sl_power_state_t sta
   // Initializing and configuring the wakeup sources as per UC inputs, if available
   status = sl_si91x_power_manager_wakeup_init();
   if (status != SL_STATUS_OK) {
+    sli_si91x_power_manager_profiler_cancel();
     return status;
   }
 #endif
@@ -261,8 +265,12 @@ sl_status_t sli_si91x_power_manager_set_sleep_configuration(sl_power_state_t sta
   p2p_intr_status_bkp.m4ss_p2p_intr_set_reg_bkp  = M4SS_P2P_INTR_SET_REG;
   P2P_STATUS_REG &= ~M4_is_active;
 #endif
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_PREPARE);
   // Configuring the clocks as per the sleep state
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_SLEEP, SL_SI91X_POWER_MANAGER_POWERSAVE);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
+#else
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_PREPARE);
 #endif
 
   // If any error code, it returns it otherwise goes to sleep with retention.
@@ -270,6 +278,7 @@ sl_status_t sli_si91x_power_manager_set_sleep_configuration(sl_power_state_t sta
   if (status != SL_STATUS_OK) {
     return status;
   }
+  sli_si91x_power_manager_profiler_begin_wakeup(SL_SI91X_POWER_MANAGER_SLEEP, state);
 
 #if defined(SL_SI91X_32KHZ_RC_CALIBRATION_ENABLED) && (SL_SI91X_32KHZ_RC_CALIBRATION_ENABLED)
   // set the wakeup overhead flag.
@@ -288,6 +297,7 @@ sl_status_t sli_si91x_power_manager_set_sleep_configuration(sl_power_state_t sta
   M4SS_P2P_INTR_SET_REG  = p2p_intr_status_bkp.m4ss_p2p_intr_set_reg_bkp;
 #endif
 #endif
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_RESUME);
   return SL_STATUS_OK;
 }
 
@@ -523,10 +533,12 @@ static void ps4_to_ps2_state_change(void)
 {
   // Low power hardware configuration to switch off the components which are not required.
   sli_si91x_power_manager_low_power_hw_config(false);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_PREPARE);
 
   // Change to 20MHz-RC to be used as Processor Clock in PS2 state
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_PS2,
                                                    sl_si91x_power_manager_get_clock_scaling());
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
 
   // Disable 40MHZ clock in case PS2
   RSI_ULPSS_DisableRefClks(MCU_ULP_40MHZ_CLK_EN);
@@ -544,6 +556,7 @@ static void ps4_to_ps2_state_change(void)
                                   DISABLE_STANDBYDC,
                                   DISABLE_TA192K_RAM_RET,
                                   DISABLE_M464K_RAM_RET);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_SUPPLY);
 }
 
 /*******************************************************************************
@@ -553,6 +566,7 @@ static void ps4_to_ps3_state_change(void)
 {
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_PS3,
                                                    sl_si91x_power_manager_get_clock_scaling());
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
 }
 
 /*******************************************************************************
@@ -577,12 +591,15 @@ static void ps4_to_ps0_state_change(void)
   // Initializing and configuring the wakeup sources as per UC inputs, if available
   status_ps4_to_ps0 = sl_si91x_power_manager_wakeup_init();
   if (status_ps4_to_ps0 != SL_STATUS_OK) {
+    sli_si91x_power_manager_profiler_cancel();
     DEBUGOUT("Error Code: 0x%lX, Power State Transition Failed \n", status_ps4_to_ps0);
     return;
   }
 #endif
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_PREPARE);
   // Configuring the clocks as per the sleep state
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_SLEEP, SL_SI91X_POWER_MANAGER_POWERSAVE);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
 #if ((SL_SI91X_TICKLESS_MODE == 1) && (SL_SLEEP_TIMER == 1))
   RSI_PS_ClrWkpSources(SYSRTC_BASED_WAKEUP);
 #endif
@@ -597,6 +614,7 @@ static void ps3_to_ps4_state_change(void)
 {
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_PS4,
                                                    sl_si91x_power_manager_get_clock_scaling());
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
 }
 
 /*******************************************************************************
@@ -608,10 +626,12 @@ static void ps3_to_ps2_state_change(void)
 {
   // Low power hardware configuration to switch off the components which are not required.
   sli_si91x_power_manager_low_power_hw_config(false);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_PREPARE);
 
   // Change to 20MHz-RC to be used as Processor Clock in PS2 state
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_PS2,
                                                    sl_si91x_power_manager_get_clock_scaling());
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
 
   // Disable 40MHz clock in case PS2
   RSI_ULPSS_DisableRefClks(MCU_ULP_40MHZ_CLK_EN);
@@ -629,6 +649,7 @@ static void ps3_to_ps2_state_change(void)
                                   DISABLE_STANDBYDC,
                                   DISABLE_TA192K_RAM_RET,
                                   DISABLE_M464K_RAM_RET);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_SUPPLY);
 }
 
 /*******************************************************************************
@@ -652,12 +673,15 @@ static void ps3_to_ps0_state_change(void)
   // Initializing and configuring the wakeup sources as per UC inputs, if available
   status_ps3_to_ps0 = sl_si91x_power_manager_wakeup_init();
   if (status_ps3_to_ps0 != SL_STATUS_OK) {
+    sli_si91x_power_manager_profiler_cancel();
     DEBUGOUT("Error Code: 0x%lX, Power State Transition Failed \n", status_ps3_to_ps0);
     return;
   }
 #endif
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_PREPARE);
   // Configuring the clocks as per the sleep state
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_SLEEP, SL_SI91X_POWER_MANAGER_POWERSAVE);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
 #if ((SL_SI91X_TICKLESS_MODE == 1) && (SL_SLEEP_TIMER == 1))
   RSI_PS_ClrWkpSources(SYSRTC_BASED_WAKEUP);
 #endif
@@ -673,10 +697,13 @@ static void ps2_to_ps4_state_change(void)
   ps_power_state_change_ps2_to_Ps4(PMU_WAIT_TIME, LDO_WAIT_TIME);
   // Enable 40MHz XTAL clock
   RSI_ULPSS_EnableRefClks(MCU_ULP_40MHZ_CLK_EN, ULP_PERIPHERAL_CLK, 0);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_SUPPLY);
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_PS4,
                                                    sl_si91x_power_manager_get_clock_scaling());
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
   // To initialize the flash
   initialize_flash();
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_FLASH);
 }
 
 /*******************************************************************************
@@ -688,11 +715,14 @@ static void ps2_to_ps3_state_change(void)
   ps_power_state_change_ps2_to_Ps4(PMU_WAIT_TIME, LDO_WAIT_TIME);
   // Enable 40MHz XTAL clock
   RSI_ULPSS_EnableRefClks(MCU_ULP_40MHZ_CLK_EN, ULP_PERIPHERAL_CLK, 0);
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_SUPPLY);
 
   sli_si91x_clock_manager_config_clks_on_ps_change(SL_SI91X_POWER_MANAGER_PS3,
                                                    sl_si91x_power_manager_get_clock_scaling());
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_CLOCK_SWITCH);
   // To initialize the flash
   initialize_flash();
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_FLASH);
 }
 
 /*******************************************************************************
@@ -719,11 +749,16 @@ static void ps2_to_ps1_state_change(void)
     config.mode                    = SLI_SI91X_POWER_MANAGER_WAKEUP_WITH_RETENTION;
 
     // If any error code, it returns it otherwise goes to sleep with retention.
-    trigger_sleep(&config, SLEEP_WITH_RETENTION);
+    if (trigger_sleep(&config, SLEEP_WITH_RETENTION) == SL_STATUS_OK) {
+      sli_si91x_power_manager_profiler_begin_wakeup(SL_SI91X_POWER_MANAGER_PS1, SL_SI91X_POWER_MANAGER_PS2);
+    }
 #if (SL_SI91X_TICKLESS_MODE == 0)
     // Enable the NVIC interrupts.
     __asm volatile("cpsie i" ::: "memory");
 #endif
+  } else {
+    // No ULP wakeup source, PS1 is not entered.
+    sli_si91x_power_manager_profiler_cancel();
   }
 }
 
@@ -764,8 +799,15 @@ static sl_status_t trigger_sleep(sli_power_sleep_config_t *config, uint8_t sleep
     sl_si91x_clock_manager_control_pll(I2S_PLL, DISABLE);
   }
 #endif
+  // The cycle counter is lost while the M4 is powered down, the entry phases are measured now.
+  // The entry is recorded by the wakeup that follows, sleep without retention does not return.
+  sli_si91x_power_manager_profiler_mark(SL_SI91X_POWER_MANAGER_PROFILER_PHASE_RETENTION);
   // According to the sleep type, with retention or without retention it enters the sleep mode.
   error_code = RSI_PS_EnterDeepSleep(sleep_type, config->low_freq_clock);
+  if (error_code != RSI_OK) {
+    // Sleep was not entered, the entry is not recorded.
+    sli_si91x_power_manager_profiler_cancel();
+  }
   // If error is encountered, it is converted to sl error code.
   status = convert_rsi_to_sl_error_code(error_code);
   return status;
@@ -170,6 +170,58 @@ typedef enum {
   DMA_FAIL  ///< DMA transfer failed
 } sl_psram_dma_status_type_t;
 
+/** @brief Maximum number of buffers in a PSRAM stream */
+#define SL_PSRAM_STREAM_MAX_BUFFERS (4)
+
+/**
+ * @brief PSRAM stream direction enum
+ */
+typedef enum {
+  PSRAM_STREAM_READ, ///< Sequential reads from PSRAM
+  PSRAM_STREAM_WRITE ///< Sequential writes to PSRAM
+} sl_psram_stream_direction_type_t;
+
+/**
+ * @brief PSRAM stream statistics
+ */
+typedef struct {
+  uint64_t bytes;                  ///< Bytes transferred by the stream
+  uint64_t busy_cycles;            ///< Core cycles with a stream transfer on the bus
+  uint64_t idle_cycles;            ///< Core cycles the bus sat idle between stream transfers
+  uint32_t stalls;                 ///< Times the application had to wait for a buffer
+  uint32_t throughput_bytes_per_s; ///< Sustained throughput over busy and idle time
+  uint32_t idle_time_us;           ///< Bus idle time in microseconds
+} sl_psram_stream_stats_type_t;
+
+/**
+ * @brief PSRAM stream context. Fields are private to the driver.
+ */
+typedef struct {
+  sl_psram_stream_direction_type_t direction;                        ///< Stream direction
+  uint8_t hSize;                                                     ///< Size of each element
+  uint8_t buffer_count;                                              ///< Number of buffers
+  uint8_t read_ahead;                                                ///< Buffers kept filled ahead of the application
+  uint32_t buffer_length;                                            ///< Capacity of each buffer in elements
+  uint32_t next_address;                                             ///< Next PSRAM address to queue
+  uint32_t end_address;                                              ///< End of the streamed PSRAM region
+  void *buffers[SL_PSRAM_STREAM_MAX_BUFFERS];                        ///< Application buffers
+  uint32_t transfer_address[SL_PSRAM_STREAM_MAX_BUFFERS];            ///< PSRAM address of each queued buffer
+  uint32_t transfer_length[SL_PSRAM_STREAM_MAX_BUFFERS];             ///< Elements in each queued buffer
+  volatile sl_psram_dma_status_type_t status[SL_PSRAM_STREAM_MAX_BUFFERS]; ///< DMA status of each buffer
+  uint8_t app_index;                                                 ///< Next buffer handed to the application
+  uint8_t submit_index;                                              ///< Next buffer to queue for reading
+  volatile uint8_t dma_index;                                        ///< Buffer being transferred
+  volatile uint8_t pending;                                          ///< Buffers queued and not yet transferred
+  uint8_t outstanding;                                               ///< Read buffers queued, filled or held
+  bool app_held;                                                     ///< Application holds the buffer at app_index
+  volatile bool in_flight;                                           ///< A stream transfer is on the bus
+  volatile bool failed;                                              ///< A stream transfer failed
+  bool idle_valid;                                                   ///< last_complete_cycles is valid
+  uint32_t start_cycles;                                             ///< Cycle count at start of current transfer
+  uint32_t last_complete_cycles;                                     ///< Cycle count at end of previous transfer
+  sl_psram_stream_stats_type_t stats;                                ///< Instrumentation
+} sl_psram_stream_type_t;
+
 /** @cond DO_NOT_INCLUDE_WITH_DOXYGEN */
 
 /**
@@ -417,6 +469,155 @@ sl_psram_return_type_t sl_si91x_psram_manual_read_in_dma_mode(uint32_t addr,
                                                               uint32_t length,
                                                               sl_psram_dma_status_type_t *dmaStatus);
 
+/***************************************************************************/
+/**
+ * @brief To start a double-buffered DMA stream over a PSRAM region
+ *
+ * @details The stream moves a contiguous PSRAM region through two or more
+ * application buffers in manual DMA mode. The next transfer is started from
+ * the DMA completion interrupt, so the QSPI bus stays busy while the
+ * application works on the current buffer.
+ *
+ * For a read stream, up to @p read_ahead buffers are filled ahead of the
+ * application, and filling starts when this function is called. For a write
+ * stream, each released buffer is queued behind the ones already queued.
+ *
+ * Only one stream can be active at a time. While it is active, the stream
+ * owns the PSRAM DMA channels and the other DMA mode APIs must not be used.
+ *
+ * @param[out] stream
+ *   Stream context, owned by the driver until @ref sl_si91x_psram_stream_stop
+ * @param[in] direction
+ *   Stream direction
+ * @param[in] addr
+ *   PSRAM start address of the region
+ * @param[in] hSize
+ *   Size of each element
+ * @param[in] length
+ *   Number of elements in the region
+ * @param[in] buffers
+ *   Array of @p buffer_count application buffers
+ * @param[in] buffer_count
+ *   Number of buffers, 2 to @ref SL_PSRAM_STREAM_MAX_BUFFERS
+ * @param[in] buffer_length
+ *   Capacity of each buffer in elements
+ * @param[in] read_ahead
+ *   Read streams only: number of buffers kept filled ahead of the
+ *   application. 0 selects all buffers. Use 1 for plain ping-pong.
+ *
+ * @return Status code indicating the result.
+ *   - PSRAM_SUCCESS: Stream started
+ *   - PSRAM_NOT_INITIALIZED: PSRAM is not initialized
+ *   - PSRAM_INVALID_HSIZE: Invalid element size
+ *   - PSRAM_NULL_ADDRESS: NULL stream or buffer
+ *   - PSRAM_INVALID_ADDRESS_LENGTH: Region outside of PSRAM
+ *   - PSRAM_FAILURE: Invalid buffer configuration or a stream is already active
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_init(sl_psram_stream_type_t *stream,
+                                                  sl_psram_stream_direction_type_t direction,
+                                                  uint32_t addr,
+                                                  uint8_t hSize,
+                                                  uint32_t length,
+                                                  void *const *buffers,
+                                                  uint8_t buffer_count,
+                                                  uint32_t buffer_length,
+                                                  uint8_t read_ahead);
+
+/***************************************************************************/
+/**
+ * @brief To get the next buffer of a PSRAM stream
+ *
+ * @details For a read stream, waits until the next buffer has been filled and
+ * returns it. A NULL buffer with zero length marks the end of the region.
+ * For a write stream, waits until the next buffer is free and returns it with
+ * its capacity. The buffer belongs to the application until
+ * @ref sl_si91x_psram_stream_release.
+ *
+ * @param[in] stream
+ *   Active stream
+ * @param[out] buffer
+ *   The buffer
+ * @param[out] length
+ *   Number of valid elements (read) or capacity in elements (write)
+ *
+ * @return Status code indicating the result.
+ *   - PSRAM_SUCCESS: Buffer returned
+ *   - PSRAM_NULL_ADDRESS: NULL argument
+ *   - PSRAM_FAILURE: A transfer failed, or the previous buffer was not released
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_acquire(sl_psram_stream_type_t *stream,
+                                                     void **buffer,
+                                                     uint32_t *length);
+
+/***************************************************************************/
+/**
+ * @brief To hand a buffer back to a PSRAM stream
+ *
+ * @details For a read stream, the buffer is queued for refilling with the next
+ * part of the region. For a write stream, the first @p length elements are
+ * queued for writing to the next part of the region. A length of 0 returns
+ * the buffer without writing it.
+ *
+ * @param[in] stream
+ *   Active stream
+ * @param[in] length
+ *   Write streams only: number of elements to write
+ *
+ * @return Status code indicating the result.
+ *   - PSRAM_SUCCESS: Buffer released
+ *   - PSRAM_NULL_ADDRESS: NULL stream
+ *   - PSRAM_INVALID_ADDRESS_LENGTH: Write past the end of the region
+ *   - PSRAM_FAILURE: No buffer is held
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_release(sl_psram_stream_type_t *stream, uint32_t length);
+
+/***************************************************************************/
+/**
+ * @brief To wait until all queued transfers of a PSRAM stream are complete
+ *
+ * @param[in] stream
+ *   Active stream
+ *
+ * @return Status code indicating the result.
+ *   - PSRAM_SUCCESS: All transfers complete
+ *   - PSRAM_NULL_ADDRESS: NULL stream
+ *   - PSRAM_FAILURE: A transfer failed
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_flush(sl_psram_stream_type_t *stream);
+
+/***************************************************************************/
+/**
+ * @brief To stop a PSRAM stream
+ *
+ * @details Waits for the transfer on the bus, if any, drops the transfers not
+ * yet started and releases the DMA channels.
+ *
+ * @param[in] stream
+ *   Active stream
+ *
+ * @return Status code indicating the result.
+ *   - PSRAM_SUCCESS: Stream stopped
+ *   - PSRAM_NULL_ADDRESS: NULL stream
+ *   - PSRAM_FAILURE: @p stream is not the active stream
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_stop(sl_psram_stream_type_t *stream);
+
+/***************************************************************************/
+/**
+ * @brief To get the throughput and bus idle statistics of a PSRAM stream
+ *
+ * @param[in] stream
+ *   Stream, active or stopped
+ * @param[out] stats
+ *   Statistics snapshot
+ *
+ * @return Status code indicating the result.
+ *   - PSRAM_SUCCESS: Statistics returned
+ *   - PSRAM_NULL_ADDRESS: NULL argument
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_get_stats(sl_psram_stream_type_t *stream,
+                                                       sl_psram_stream_stats_type_t *stats);
+
 /***************************************************************************/
 /**
  * @brief To put the PSRAM device in sleep mode
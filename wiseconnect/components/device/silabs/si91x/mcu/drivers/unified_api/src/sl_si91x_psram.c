@@ -141,6 +141,9 @@ static volatile struct xferContextType ctx;
 static RSI_UDMA_CHA_CONFIG_DATA_T control;
 static RSI_UDMA_CHA_CFG_T config;
 
+/// Stream owning the DMA channels, if any
+static sl_psram_stream_type_t *volatile active_stream;
+
 /*******************************************************************************
  *********************   LOCAL FUNCTION PROTOTYPES   ***************************
  ******************************************************************************/
@@ -346,6 +349,33 @@ static void qspi_qspiload_key_ext(qspi_reg_t *qspi_reg, uint16_t key_size);
 static void qspi_qspiunload_key_ext(qspi_reg_t *qspi_reg);
 #endif
 
+/***************************************************************************/ /**
+ * @brief
+ *   Start the next queued transfer of a stream if the bus is free. Must be
+ *   called with interrupts masked or from the DMA completion interrupt.
+ *
+ * @param[in] stream
+ *   Active stream
+ ******************************************************************************/
+static void psram_stream_kick(sl_psram_stream_type_t *stream);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Queue read-ahead transfers up to the stream's read-ahead depth. Must be
+ *   called with interrupts masked.
+ *
+ * @param[in] stream
+ *   Active read stream
+ ******************************************************************************/
+static void psram_stream_queue_reads(sl_psram_stream_type_t *stream);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Stream bookkeeping at the end of a DMA transfer. Called from the DMA
+ *   completion interrupt.
+ ******************************************************************************/
+static void psram_stream_transfer_complete(void);
+
 /*******************************************************************************
  ***************************   LOCAL FUNCTIONS   *******************************
  ******************************************************************************/
@@ -410,6 +440,7 @@ static void udma_transfer_complete(uint32_t event, uint32_t ch)
           ctx.xferStatus = FAILED;
           /*Notify the Failure*/
           *ctx.done = DMA_FAIL;
+          psram_stream_transfer_complete();
         }
       } else if ((ctx.xferRemLength > 0) && (ctx.xferStatus == RX_RUNNING)) {
         if (sl_si91x_psram_manual_read_in_dma_mode(ctx.xferNextAddress,
@@ -429,6 +460,7 @@ static void udma_transfer_complete(uint32_t event, uint32_t ch)
           ctx.xferStatus = FAILED;
           /*Notify the Failure*/
           *ctx.done = DMA_FAIL;
+          psram_stream_transfer_complete();
         }
       } else {
 
@@ -449,6 +481,7 @@ static void udma_transfer_complete(uint32_t event, uint32_t ch)
 
         /*Notify the completion*/
         *ctx.done = DMA_DONE;
+        psram_stream_transfer_complete();
       }
     }
   }
@@ -1981,6 +2014,360 @@ sl_psram_return_type_t sl_si91x_psram_manual_read_in_dma_mode(uint32_t addr,
   return PSRAM_SUCCESS;
 }
 
+/* Advance a stream buffer index */
+__STATIC_INLINE uint8_t psram_stream_next(const sl_psram_stream_type_t *stream, uint8_t index)
+{
+  return (uint8_t)((index + 1) == stream->buffer_count ? 0 : (index + 1));
+}
+
+void psram_stream_kick(sl_psram_stream_type_t *stream)
+{
+  sl_psram_return_type_t ret;
+  uint8_t index;
+  uint32_t now;
+
+  if (stream->in_flight || stream->failed || (stream->pending == 0)) {
+    return;
+  }
+
+  index = stream->dma_index;
+  now   = DWT->CYCCNT;
+
+  // Time since the previous transfer ended is bus idle time for the stream
+  if (stream->idle_valid) {
+    stream->stats.idle_cycles += (uint32_t)(now - stream->last_complete_cycles);
+    stream->idle_valid = false;
+  }
+  stream->start_cycles = now;
+  stream->in_flight    = true;
+
+  if (stream->direction == PSRAM_STREAM_READ) {
+    ret = sl_si91x_psram_manual_read_in_dma_mode(stream->transfer_address[index],
+                                                 stream->buffers[index],
+                                                 stream->hSize,
+                                                 stream->transfer_length[index],
+                                                 (sl_psram_dma_status_type_t *)&stream->status[index]);
+  } else {
+    ret = sl_si91x_psram_manual_write_in_dma_mode(stream->transfer_address[index],
+                                                  stream->buffers[index],
+                                                  stream->hSize,
+                                                  stream->transfer_length[index],
+                                                  (sl_psram_dma_status_type_t *)&stream->status[index]);
+  }
+
+  if (ret != PSRAM_SUCCESS) {
+    stream->in_flight     = false;
+    stream->failed        = true;
+    stream->status[index] = DMA_FAIL;
+  }
+}
+
+void psram_stream_queue_reads(sl_psram_stream_type_t *stream)
+{
+  uint32_t remaining;
+  uint32_t xfer_length;
+  uint8_t index;
+
+  while ((stream->outstanding < stream->read_ahead) && (stream->next_address < stream->end_address)) {
+    index       = stream->submit_index;
+    remaining   = (stream->end_address - stream->next_address) / stream->hSize;
+    xfer_length = (remaining < stream->buffer_length) ? remaining : stream->buffer_length;
+
+    stream->transfer_address[index] = stream->next_address;
+    stream->transfer_length[index]  = xfer_length;
+    stream->status[index]           = DMA_NONE;
+
+    stream->next_address += xfer_length * stream->hSize;
+    stream->submit_index = psram_stream_next(stream, index);
+    stream->outstanding++;
+    stream->pending++;
+  }
+
+  psram_stream_kick(stream);
+}
+
+void psram_stream_transfer_complete(void)
+{
+  sl_psram_stream_type_t *stream = active_stream;
+  uint8_t index;
+  uint32_t now;
+
+  if ((stream == NULL) || !stream->in_flight) {
+    return;
+  }
+
+  now   = DWT->CYCCNT;
+  index = stream->dma_index;
+
+  stream->in_flight = false;
+  stream->stats.busy_cycles += (uint32_t)(now - stream->start_cycles);
+  stream->last_complete_cycles = now;
+  stream->idle_valid           = true;
+
+  if (stream->status[index] != DMA_DONE) {
+    stream->failed = true;
+    return;
+  }
+
+  stream->stats.bytes += (uint64_t)stream->transfer_length[index] * stream->hSize;
+  stream->dma_index = psram_stream_next(stream, index);
+  stream->pending--;
+
+  // Start the next queued transfer right away to keep the bus busy
+  psram_stream_kick(stream);
+}
+
+/***************************************************************************/ /**
+ * Start a double-buffered DMA stream over a PSRAM region
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_init(sl_psram_stream_type_t *stream,
+                                                  sl_psram_stream_direction_type_t direction,
+                                                  uint32_t addr,
+                                                  uint8_t hSize,
+                                                  uint32_t length,
+                                                  void *const *buffers,
+                                                  uint8_t buffer_count,
+                                                  uint32_t buffer_length,
+                                                  uint8_t read_ahead)
+{
+  uint32_t primask;
+  sl_psram_return_type_t ret;
+
+  if (PSRAMStatus.state != initialised) {
+    return PSRAM_NOT_INITIALIZED;
+  }
+
+  if (((hSize != sizeof(uint8_t)) && (hSize != sizeof(uint16_t)) && (hSize != sizeof(uint32_t)))) {
+    return PSRAM_INVALID_HSIZE;
+  }
+
+  if ((NULL == stream) || (NULL == buffers)) {
+    return PSRAM_NULL_ADDRESS;
+  }
+
+  if ((buffer_count < 2) || (buffer_count > SL_PSRAM_STREAM_MAX_BUFFERS) || (buffer_length == 0)
+      || ((direction != PSRAM_STREAM_READ) && (direction != PSRAM_STREAM_WRITE))) {
+    return PSRAM_FAILURE;
+  }
+
+  ret = qspi_check_access(addr, length * hSize);
+  if (ret) {
+    return ret;
+  }
+
+  if ((active_stream != NULL) || (ctx.xferStatus == TX_RUNNING) || (ctx.xferStatus == RX_RUNNING)) {
+    return PSRAM_FAILURE;
+  }
+
+  memset(stream, 0, sizeof(*stream));
+
+  for (uint8_t i = 0; i < buffer_count; i++) {
+    if (NULL == buffers[i]) {
+      return PSRAM_NULL_ADDRESS;
+    }
+    stream->buffers[i] = buffers[i];
+    // Write buffers start out free, read buffers start out empty
+    stream->status[i] = (direction == PSRAM_STREAM_WRITE) ? DMA_DONE : DMA_NONE;
+  }
+
+  stream->direction     = direction;
+  stream->hSize         = hSize;
+  stream->buffer_count  = buffer_count;
+  stream->buffer_length = buffer_length;
+  stream->read_ahead    = ((read_ahead == 0) || (read_ahead > buffer_count)) ? buffer_count : read_ahead;
+  stream->next_address  = addr;
+  stream->end_address   = addr + (length * hSize);
+
+  // The cycle counter is used for throughput and idle time instrumentation
+  CoreDebug->DEMCR |= CoreDebug_DEMCR_TRCENA_Msk;
+  DWT->CTRL |= DWT_CTRL_CYCCNTENA_Msk;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  active_stream = stream;
+  if (direction == PSRAM_STREAM_READ) {
+    psram_stream_queue_reads(stream);
+  }
+  __set_PRIMASK(primask);
+
+  return stream->failed ? PSRAM_FAILURE : PSRAM_SUCCESS;
+}
+
+/***************************************************************************/ /**
+ * Get the next buffer of a PSRAM stream
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_acquire(sl_psram_stream_type_t *stream,
+                                                     void **buffer,
+                                                     uint32_t *length)
+{
+  uint8_t index;
+
+  if ((NULL == stream) || (NULL == buffer) || (NULL == length)) {
+    return PSRAM_NULL_ADDRESS;
+  }
+
+  if (stream->app_held || (active_stream != stream)) {
+    return PSRAM_FAILURE;
+  }
+
+  // End of a read stream: everything has been handed out and released
+  if ((stream->direction == PSRAM_STREAM_READ) && (stream->outstanding == 0)) {
+    *buffer = NULL;
+    *length = 0;
+    return PSRAM_SUCCESS;
+  }
+
+  index = stream->app_index;
+
+  // Read: wait until the buffer is filled. Write: wait until it is written.
+  if (stream->status[index] == DMA_NONE) {
+    stream->stats.stalls++;
+    while ((stream->status[index] == DMA_NONE) && !stream->failed)
+      ;
+  }
+
+  if (stream->status[index] != DMA_DONE) {
+    return PSRAM_FAILURE;
+  }
+
+  *buffer          = stream->buffers[index];
+  *length          = (stream->direction == PSRAM_STREAM_READ) ? stream->transfer_length[index] : stream->buffer_length;
+  stream->app_held = true;
+
+  return PSRAM_SUCCESS;
+}
+
+/***************************************************************************/ /**
+ * Hand a buffer back to a PSRAM stream
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_release(sl_psram_stream_type_t *stream, uint32_t length)
+{
+  uint32_t primask;
+  uint8_t index;
+
+  if (NULL == stream) {
+    return PSRAM_NULL_ADDRESS;
+  }
+
+  if (!stream->app_held || (active_stream != stream)) {
+    return PSRAM_FAILURE;
+  }
+
+  index = stream->app_index;
+
+  if (stream->direction == PSRAM_STREAM_WRITE) {
+    if ((length > stream->buffer_length)
+        || (length * stream->hSize > stream->end_address - stream->next_address)) {
+      return PSRAM_INVALID_ADDRESS_LENGTH;
+    }
+    stream->app_held = false;
+    if (length == 0) {
+      return PSRAM_SUCCESS;
+    }
+
+    primask = __get_PRIMASK();
+    __disable_irq();
+    stream->transfer_address[index] = stream->next_address;
+    stream->transfer_length[index]  = length;
+    stream->status[index]           = DMA_NONE;
+    stream->next_address += length * stream->hSize;
+    stream->app_index = psram_stream_next(stream, index);
+    stream->pending++;
+    psram_stream_kick(stream);
+    __set_PRIMASK(primask);
+  } else {
+    primask = __get_PRIMASK();
+    __disable_irq();
+    stream->app_held  = false;
+    stream->app_index = psram_stream_next(stream, index);
+    stream->outstanding--;
+    psram_stream_queue_reads(stream);
+    __set_PRIMASK(primask);
+  }
+
+  return stream->failed ? PSRAM_FAILURE : PSRAM_SUCCESS;
+}
+
+/***************************************************************************/ /**
+ * Wait until all queued transfers of a PSRAM stream are complete
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_flush(sl_psram_stream_type_t *stream)
+{
+  if (NULL == stream) {
+    return PSRAM_NULL_ADDRESS;
+  }
+
+  while ((stream->in_flight || (stream->pending > 0)) && !stream->failed)
+    ;
+
+  return stream->failed ? PSRAM_FAILURE : PSRAM_SUCCESS;
+}
+
+/***************************************************************************/ /**
+ * Stop a PSRAM stream
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_stop(sl_psram_stream_type_t *stream)
+{
+  uint32_t primask;
+
+  if (NULL == stream) {
+    return PSRAM_NULL_ADDRESS;
+  }
+
+  if (active_stream != stream) {
+    return PSRAM_FAILURE;
+  }
+
+  // Drop queued transfers, then let the one on the bus finish
+  primask = __get_PRIMASK();
+  __disable_irq();
+  stream->pending = stream->in_flight ? 1 : 0;
+  __set_PRIMASK(primask);
+
+  while (stream->in_flight && !stream->failed)
+    ;
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  stream->pending  = 0;
+  stream->app_held = false;
+  active_stream    = NULL;
+  __set_PRIMASK(primask);
+
+  return PSRAM_SUCCESS;
+}
+
+/***************************************************************************/ /**
+ * Get the throughput and bus idle statistics of a PSRAM stream
+ ******************************************************************************/
+sl_psram_return_type_t sl_si91x_psram_stream_get_stats(sl_psram_stream_type_t *stream,
+                                                       sl_psram_stream_stats_type_t *stats)
+{
+  uint32_t primask;
+  uint64_t total_cycles;
+
+  if ((NULL == stream) || (NULL == stats)) {
+    return PSRAM_NULL_ADDRESS;
+  }
+
+  primask = __get_PRIMASK();
+  __disable_irq();
+  *stats = stream->stats;
+  __set_PRIMASK(primask);
+
+  total_cycles                  = stats->busy_cycles + stats->idle_cycles;
+  stats->throughput_bytes_per_s = 0;
+  stats->idle_time_us           = 0;
+  if ((total_cycles > 0) && (SystemCoreClock > 0)) {
+    stats->throughput_bytes_per_s = (uint32_t)((stats->bytes * SystemCoreClock) / total_cycles);
+  }
+  if (SystemCoreClock >= 1000000) {
+    stats->idle_time_us = (uint32_t)(stats->idle_cycles / (SystemCoreClock / 1000000));
+  }
+
+  return PSRAM_SUCCESS;
+}
+
 /***************************************************************************/ /**
  * Reset the PSRAM Device
  ******************************************************************************/
@@ -466,6 +466,54 @@ int sl_si91x_recvfrom(int socket,
                       struct sockaddr *fromAddr,
                       socklen_t *fromAddrLen);
 
+/**
+ * @brief Receives data from a socket without copying it out of the driver RX buffer.
+ *
+ * @details
+ * This function behaves like @ref sl_si91x_recvfrom, but instead of copying the payload into a caller buffer,
+ * it loans the driver RX buffer holding the payload to the caller. The loan must be handed back with
+ * @ref sl_si91x_recv_loan_return once the payload has been consumed.
+ *
+ * @param[in] socket 
+ *   The socket ID or file descriptor for the specified socket.
+ *
+ * @param[out] loan 
+ *   Pointer to a @ref sl_si91x_socket_rx_loan_t that receives the payload pointer, length and buffer handle.
+ *
+ * @param[in] max_len 
+ *   Maximum number of bytes to receive.
+ *
+ * @param[in] flags 
+ *   Controls the reception of the data. Note that the flags parameter is not currently supported.
+ *
+ * @param[out] fromAddr 
+ *   Pointer to a @ref sockaddr that will hold the address of the remote peer. May be NULL.
+ *
+ * @param[in, out] fromAddrLen 
+ *   Pointer to a @ref socklen_t that contains the length of the remote peer address (fromAddr).
+ *
+ * @return 
+ *   Returns the number of bytes received on success, or -1 on failure.
+ *
+ * @note
+ *   The number of outstanding loans is limited to SL_WIFI_MAX_LOANED_RX_BUFFERS, which defaults to half of the
+ *   RX buffer quota. When the limit is reached, the function fails with errno set to ENOBUFS.
+ */
+int sl_si91x_recvfrom_loan(int socket,
+                           sl_si91x_socket_rx_loan_t *loan,
+                           size_t max_len,
+                           int32_t flags,
+                           struct sockaddr *fromAddr,
+                           socklen_t *fromAddrLen);
+
+/**
+ * @brief Returns a buffer loaned by @ref sl_si91x_recvfrom_loan to the driver.
+ *
+ * @param[in, out] loan 
+ *   Pointer to the @ref sl_si91x_socket_rx_loan_t to return. The structure is cleared on return.
+ */
+void sl_si91x_recv_loan_return(sl_si91x_socket_rx_loan_t *loan);
+
 /**
  * @brief Disables send or receive operations on a socket.
  *
@@ -558,6 +606,53 @@ int sl_si91x_select(int nfds,
  *   A valid function pointer of type @ref sl_si91x_socket_remote_termination_callback_t that is called when the remote socket is terminated.
  */
 void sl_si91x_set_remote_termination_callback(sl_si91x_socket_remote_termination_callback_t callback);
+
+/**
+ * @brief Registers, modifies, or removes a socket in the host-side readiness monitor.
+ *
+ * @details
+ * The host tracks socket readiness from the receive, accept, transmit and close events it already
+ * receives from the NWP. Sockets registered with this function are reported by @ref sl_si91x_socket_poll_wait
+ * without sending any command to the NWP.
+ *
+ * @param[in] operation
+ *   Operation of type @ref sl_si91x_socket_poll_ctl_t to perform.
+ *
+ * @param[in] socket
+ *   Socket ID to be monitored.
+ *
+ * @param[in] events
+ *   Bitmap of SL_SI91X_SOCKET_POLL_* events to monitor. Ignored for @ref SL_SI91X_SOCKET_POLL_CTL_DEL.
+ *
+ * @return
+ *   Returns 0 on success, or -1 on failure with errno set to EBADF, EINVAL, EEXIST or ENOENT.
+ */
+int sl_si91x_socket_poll_ctl(sl_si91x_socket_poll_ctl_t operation, int socket, uint32_t events);
+
+/**
+ * @brief Waits for registered sockets to become ready.
+ *
+ * @details
+ * Returns the sockets registered with @ref sl_si91x_socket_poll_ctl whose monitored events are ready.
+ * Unlike @ref sl_si91x_select, this function does not send a request to the NWP.
+ *
+ * @param[out] events
+ *   Array of @ref sl_si91x_socket_poll_event_t filled with the ready sockets.
+ *
+ * @param[in] max_events
+ *   Number of entries in the events array.
+ *
+ * @param[in] timeout
+ *   Time in milliseconds to wait for a socket to become ready. Use osWaitForever to wait indefinitely, or 0 to return immediately.
+ *
+ * @return
+ *   Returns the number of ready sockets, 0 if the timeout expired, or -1 on failure.
+ *
+ * @note
+ *   SL_SI91X_SOCKET_POLL_IN and SL_SI91X_SOCKET_POLL_HUP are edge triggered and cleared once reported.
+ *   SL_SI91X_SOCKET_POLL_OUT is reported as long as the socket can queue more transmit data.
+ */
+int sl_si91x_socket_poll_wait(sl_si91x_socket_poll_event_t *events, uint32_t max_events, uint32_t timeout);
 /** @} */
 #ifdef __cplusplus
 }
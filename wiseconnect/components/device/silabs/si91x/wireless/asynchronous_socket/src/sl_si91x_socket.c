@@ -479,32 +479,25 @@ int sl_si91x_recv(int socket, uint8_t *buf, size_t buf_len, int32_t flags)
   return sl_si91x_recvfrom(socket, buf, buf_len, flags, NULL, NULL);
 }
 
-int sl_si91x_recvfrom(int socket,
-                      uint8_t *buf,
-                      size_t buf_len,
-                      int32_t flags,
-                      struct sockaddr *addr,
-                      socklen_t *addr_len)
+// Issue a socket read request to the NWP and return the driver buffer holding the received payload
+static int sli_si91x_read_socket_data(int socket,
+                                      size_t buf_len,
+                                      struct sockaddr *addr,
+                                      socklen_t *addr_len,
+                                      sl_wifi_buffer_t **buffer,
+                                      sl_si91x_socket_metadata_t **response)
 {
-  UNUSED_PARAMETER(flags);
-
   // Initialize variables for socket communication
-  sli_si91x_wait_period_t wait_time    = 0;
-  sli_si91x_req_socket_read_t request  = { 0 };
-  ssize_t bytes_read                   = 0;
-  size_t max_buf_len                   = 0;
-  sl_si91x_socket_metadata_t *response = NULL;
-  sli_si91x_socket_t *si91x_socket     = sli_get_si91x_socket(socket);
-  sl_wifi_buffer_t *buffer             = NULL;
-  sl_wifi_system_packet_t *packet      = NULL;
+  sli_si91x_wait_period_t wait_time   = 0;
+  sli_si91x_req_socket_read_t request = { 0 };
+  size_t max_buf_len                  = 0;
+  sli_si91x_socket_t *si91x_socket    = sli_get_si91x_socket(socket);
+  sl_wifi_system_packet_t *packet     = NULL;
 
   // Check if the socket is valid
   SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket == NULL, EBADF);
   SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket->type == SOCK_STREAM && si91x_socket->state != CONNECTED, ENOTCONN);
 
-  // Check if the buffer pointer is valid
-  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(buf == NULL, EFAULT);
-
   // Check if the specified buffer length is valid
   SLI_SET_ERRNO_AND_RETURN_IF_TRUE(buf_len <= 0, EINVAL);
 
@@ -549,49 +542,48 @@ int sl_si91x_recvfrom(int socket,
                                                      &request,
                                                      sizeof(request),
                                                      wait_time,
-                                                     &buffer);
+                                                     buffer);
 
   // If the command failed and a buffer was allocated, free the buffer
-  if ((status != SL_STATUS_OK) && (buffer != NULL)) {
-    sli_si91x_host_free_buffer(buffer);
+  if ((status != SL_STATUS_OK) && (*buffer != NULL)) {
+    sli_si91x_host_free_buffer(*buffer);
+    *buffer = NULL;
   }
 
   SLI_SOCKET_VERIFY_STATUS_AND_RETURN(status, SL_STATUS_OK, SLI_SI91X_UNDEFINED_ERROR);
 
   // Retrieve the packet from the buffer
-  packet = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
+  packet = sl_si91x_host_get_buffer_data(*buffer, 0, NULL);
 
   // Extract the socket receive response data from the firmware packet
-  response = (sl_si91x_socket_metadata_t *)packet->data;
-
-  // Determine the number of bytes read, considering the buffer length and response length
-  bytes_read = (response->length <= buf_len) ? response->length : buf_len;
-  memcpy(buf, ((uint8_t *)response + response->offset), bytes_read);
+  *response = (sl_si91x_socket_metadata_t *)packet->data;
 
   // If address information is provided, populate it based on the IP version
   if (addr != NULL) {
-    if (response->ip_version == SL_IPV4_ADDRESS_LENGTH && *addr_len >= sizeof(struct sockaddr_in)) {
+    if ((*response)->ip_version == SL_IPV4_ADDRESS_LENGTH && *addr_len >= sizeof(struct sockaddr_in)) {
       struct sockaddr_in *socket_address = (struct sockaddr_in *)addr;
 
-      socket_address->sin_port   = response->dest_port;
+      socket_address->sin_port   = (*response)->dest_port;
       socket_address->sin_family = AF_INET;
-      memcpy(&socket_address->sin_addr.s_addr, response->dest_ip_addr.ipv4_address, SL_IPV4_ADDRESS_LENGTH);
+      memcpy(&socket_address->sin_addr.s_addr, (*response)->dest_ip_addr.ipv4_address, SL_IPV4_ADDRESS_LENGTH);
 
       *addr_len = sizeof(struct sockaddr_in);
-    } else if (response->ip_version == SL_IPV6_ADDRESS_LENGTH && *addr_len >= sizeof(struct sockaddr_in6)) {
+    } else if ((*response)->ip_version == SL_IPV6_ADDRESS_LENGTH && *addr_len >= sizeof(struct sockaddr_in6)) {
       struct sockaddr_in6 *ipv6_socket_address = ((struct sockaddr_in6 *)addr);
 
-      ipv6_socket_address->sin6_port   = response->dest_port;
+      ipv6_socket_address->sin6_port   = (*response)->dest_port;
       ipv6_socket_address->sin6_family = AF_INET;
 #ifdef SLI_SI91X_NETWORK_DUAL_STACK
-      memcpy(&ipv6_socket_address->sin6_addr.un.u8_addr, response->dest_ip_addr.ipv6_address, SL_IPV6_ADDRESS_LENGTH);
+      memcpy(&ipv6_socket_address->sin6_addr.un.u8_addr,
+             (*response)->dest_ip_addr.ipv6_address,
+             SL_IPV6_ADDRESS_LENGTH);
 #else
 #ifndef __ZEPHYR__
       memcpy(&ipv6_socket_address->sin6_addr.__u6_addr.__u6_addr8,
-             response->dest_ip_addr.ipv6_address,
+             (*response)->dest_ip_addr.ipv6_address,
              SL_IPV6_ADDRESS_LENGTH);
 #else
-      memcpy(&ipv6_socket_address->sin6_addr.s6_addr, response->dest_ip_addr.ipv6_address, SL_IPV6_ADDRESS_LENGTH);
+      memcpy(&ipv6_socket_address->sin6_addr.s6_addr, (*response)->dest_ip_addr.ipv6_address, SL_IPV6_ADDRESS_LENGTH);
 #endif
 #endif
 
@@ -601,11 +593,82 @@ int sl_si91x_recvfrom(int socket,
     }
   }
 
+  return SLI_SI91X_NO_ERROR;
+}
+
+int sl_si91x_recvfrom(int socket,
+                      uint8_t *buf,
+                      size_t buf_len,
+                      int32_t flags,
+                      struct sockaddr *addr,
+                      socklen_t *addr_len)
+{
+  UNUSED_PARAMETER(flags);
+
+  ssize_t bytes_read                   = 0;
+  sl_si91x_socket_metadata_t *response = NULL;
+  sl_wifi_buffer_t *buffer             = NULL;
+
+  // Check if the buffer pointer is valid
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(buf == NULL, EFAULT);
+
+  if (sli_si91x_read_socket_data(socket, buf_len, addr, addr_len, &buffer, &response) != SLI_SI91X_NO_ERROR) {
+    return -1;
+  }
+
+  // Determine the number of bytes read, considering the buffer length and response length
+  bytes_read = (response->length <= buf_len) ? response->length : buf_len;
+  memcpy(buf, ((uint8_t *)response + response->offset), bytes_read);
+
   sli_si91x_host_free_buffer(buffer);
 
   return bytes_read;
 }
 
+int sl_si91x_recvfrom_loan(int socket,
+                           sl_si91x_socket_rx_loan_t *loan,
+                           size_t max_len,
+                           int32_t flags,
+                           struct sockaddr *addr,
+                           socklen_t *addr_len)
+{
+  UNUSED_PARAMETER(flags);
+
+  sl_si91x_socket_metadata_t *response = NULL;
+  sl_wifi_buffer_t *buffer             = NULL;
+
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(loan == NULL, EFAULT);
+
+  // Reserve a loan slot up front so that a slow consumer cannot drain the RX buffer pool
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(sli_si91x_host_reserve_buffer_loan() != SL_STATUS_OK, ENOBUFS);
+
+  if (sli_si91x_read_socket_data(socket, max_len, addr, addr_len, &buffer, &response) != SLI_SI91X_NO_ERROR) {
+    sli_si91x_host_release_buffer_loan();
+    return -1;
+  }
+
+  // Hand out the payload in place; the buffer stays owned by the caller until it is returned
+  loan->data   = (uint8_t *)response + response->offset;
+  loan->length = (response->length <= max_len) ? response->length : (uint32_t)max_len;
+  loan->buffer = buffer;
+
+  return (int)loan->length;
+}
+
+void sl_si91x_recv_loan_return(sl_si91x_socket_rx_loan_t *loan)
+{
+  if (loan == NULL || loan->buffer == NULL) {
+    return;
+  }
+
+  sli_si91x_host_free_buffer((sl_wifi_buffer_t *)loan->buffer);
+  sli_si91x_host_release_buffer_loan();
+
+  loan->data   = NULL;
+  loan->length = 0;
+  loan->buffer = NULL;
+}
+
 #ifndef __ZEPHYR__
 int sl_si91x_select(int nfds,
                     fd_set *readfds,
@@ -624,3 +687,13 @@ int sl_si91x_select(int nfds,
 {
   return sli_si91x_select(nfds, readfds, writefds, exceptfds, timeout, callback);
 }
+
+int sl_si91x_socket_poll_ctl(sl_si91x_socket_poll_ctl_t operation, int socket, uint32_t events)
+{
+  return sli_si91x_socket_poll_ctl(operation, socket, events);
+}
+
+int sl_si91x_socket_poll_wait(sl_si91x_socket_poll_event_t *events, uint32_t max_events, uint32_t timeout)
+{
+  return sli_si91x_socket_poll_wait(events, max_events, timeout);
+}
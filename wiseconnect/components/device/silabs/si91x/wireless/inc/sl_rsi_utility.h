@@ -94,6 +94,9 @@ void sli_handle_wifi_beacon(sl_wifi_system_packet_t *packet);
 sl_status_t sli_wifi_get_stored_scan_results(sl_wifi_interface_t interface,
                                              sl_wifi_extended_scan_result_parameters_t *extended_scan_parameters);
 void sli_wifi_flush_scan_results_database(void);
+bool sli_wifi_scan_cache_update(const sl_wifi_scan_result_t *result, uint32_t length);
+void sli_wifi_scan_cache_abort(void);
+sl_status_t sli_si91x_post_wlan_event(uint16_t command, const void *data, uint16_t data_length);
 
 typedef void (*sli_si91x_host_atomic_action_function_t)(void *user_data);
 typedef uint8_t (*sli_si91x_compare_function_t)(sl_wifi_buffer_t *node, void *user_data);
@@ -330,6 +333,12 @@ void *sl_si91x_host_get_buffer_data(sl_wifi_buffer_t *buffer, uint16_t offset, u
 /* Function used to deallocate the memory associated with buffer */
 void sli_si91x_host_free_buffer(sl_wifi_buffer_t *buffer);
 
+/* Function used to reserve one of the RX buffers that may be loaned to the application */
+sl_status_t sli_si91x_host_reserve_buffer_loan(void);
+
+/* Function used to release a loan reserved with sli_si91x_host_reserve_buffer_loan */
+void sli_si91x_host_release_buffer_loan(void);
+
 /* Function enqueues response into corresponding response queue */
 sl_status_t sli_si91x_add_to_queue(sli_si91x_buffer_queue_t *queue, sl_wifi_buffer_t *buffer);
 
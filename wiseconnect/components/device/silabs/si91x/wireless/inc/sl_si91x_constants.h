@@ -687,6 +687,7 @@ typedef enum {
   SLI_WLAN_RSP_GET_STATS            = 0xF1,
   SLI_WLAN_RSP_HTTP_OTAF            = 0xF4,
   SLI_WLAN_RSP_11AX_PARAMS          = 0xFF,
+  SLI_WLAN_RSP_SCAN_CACHE_RESULT    = 0x113, // Host generated, scan result served from the scan cache
 
   // Network command response
   SLI_WLAN_RSP_PING_PACKET           = 0x29,
@@ -49,6 +49,14 @@ static uint8_t quota[SLI_BUFFER_TYPE];
 #define SL_WIFI_BUFFERS_FREE_WAIT_TIME 1000 // wait for 1 second to free all the wi-fi buffer
 #endif
 
+// Maximum number of RX buffers that can be loaned to the application at once.
+// Defaults to half of the RX buffer quota so that the driver always keeps buffers for incoming frames.
+#ifndef SL_WIFI_MAX_LOANED_RX_BUFFERS
+#define SL_WIFI_MAX_LOANED_RX_BUFFERS (quota[SL_WIFI_RX_FRAME_BUFFER] / 2)
+#endif
+
+static uint8_t loaned_buffer_count = 0;
+
 /*---------------Static Function Declaration---------------------------------------*/
 static void sl_si91x_convert_config_structure_to_array(const sl_wifi_buffer_configuration_t *config);
 static sl_status_t sl_si91x_check_for_valid_config(const sl_wifi_buffer_configuration_t *config);
@@ -171,6 +179,29 @@ void *sl_si91x_host_get_buffer_data(sl_wifi_buffer_t *buffer, uint16_t offset, u
   return (void *)&buffer->data[offset];
 }
 
+sl_status_t sli_si91x_host_reserve_buffer_loan(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_CRITICAL();
+  if (loaned_buffer_count >= SL_WIFI_MAX_LOANED_RX_BUFFERS) {
+    CORE_EXIT_CRITICAL();
+    return SL_STATUS_FULL;
+  }
+  loaned_buffer_count++;
+  CORE_EXIT_CRITICAL();
+  return SL_STATUS_OK;
+}
+
+void sli_si91x_host_release_buffer_loan(void)
+{
+  CORE_DECLARE_IRQ_STATE;
+  CORE_ENTER_CRITICAL();
+  if (loaned_buffer_count > 0) {
+    loaned_buffer_count--;
+  }
+  CORE_EXIT_CRITICAL();
+}
+
 void sli_si91x_host_free_buffer(sl_wifi_buffer_t *buffer)
 {
   if (buffer == NULL) {
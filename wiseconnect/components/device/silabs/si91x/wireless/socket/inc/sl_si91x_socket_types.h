@@ -205,6 +205,37 @@ typedef void (*sl_si91x_socket_select_callback_t)(sl_si91x_fdset_t *fd_read,
  */
 typedef void (*sl_si91x_socket_remote_termination_callback_t)(int socket, uint16_t port, uint32_t bytes_sent);
 
+/**
+ * @brief Socket readiness events reported by @ref sl_si91x_socket_poll_wait.
+ *
+ * @details
+ * IN and HUP are latched by the host when the corresponding event is received from the NWP and are cleared
+ * once reported. OUT is level triggered and reported while the socket can queue more transmit data.
+ */
+#define SL_SI91X_SOCKET_POLL_IN  (1 << 0) ///< Data was received, or a connection was accepted on a listening socket.
+#define SL_SI91X_SOCKET_POLL_OUT (1 << 1) ///< Socket is connected and can queue more transmit data.
+#define SL_SI91X_SOCKET_POLL_HUP (1 << 2) ///< Connection was closed by the remote peer or the interface went down.
+
+/// Operations accepted by @ref sl_si91x_socket_poll_ctl.
+typedef enum {
+  SL_SI91X_SOCKET_POLL_CTL_ADD = 0, ///< Start monitoring a socket for the given events.
+  SL_SI91X_SOCKET_POLL_CTL_MOD,     ///< Change the events monitored on an already registered socket.
+  SL_SI91X_SOCKET_POLL_CTL_DEL      ///< Stop monitoring a socket.
+} sl_si91x_socket_poll_ctl_t;
+
+/// Received payload loaned to the application by @ref sl_si91x_recvfrom_loan.
+typedef struct {
+  uint8_t *data;   ///< Pointer to the received payload inside the driver RX buffer.
+  uint32_t length; ///< Length of the received payload, in bytes.
+  void *buffer;    ///< Driver buffer holding the payload. Must not be modified by the application.
+} sl_si91x_socket_rx_loan_t;
+
+/// Ready socket entry returned by @ref sl_si91x_socket_poll_wait.
+typedef struct {
+  int32_t socket;  ///< Socket file descriptor.
+  uint32_t events; ///< Bitmap of SL_SI91X_SOCKET_POLL_* events that are ready.
+} sl_si91x_socket_poll_event_t;
+
 /** @} */
 
 /// Internal  si91x BSD socket status
@@ -294,6 +325,8 @@ typedef struct {
   uint8_t socket_bitmap;                                                   ///< Socket Bitmap
   uint8_t data_buffer_count;               ///< Number of queued data buffers allocated by this socket
   uint8_t data_buffer_limit;               ///< Maximum number of queued data buffers permitted for this socket
+  uint8_t poll_interest;                   ///< SL_SI91X_SOCKET_POLL_* events registered with sl_si91x_socket_poll_ctl
+  uint8_t poll_pending;                    ///< Latched SL_SI91X_SOCKET_POLL_* events not yet reported
   sli_si91x_command_queue_t command_queue; ///< Command queue
   sli_si91x_buffer_queue_t tx_data_queue;  ///< Transmit data queue
   sli_si91x_buffer_queue_t rx_data_queue;  ///< Receive data queue
@@ -306,6 +306,13 @@ sli_si91x_socket_t *sli_si91x_get_socket_from_id(int socket_id,
                                                  sli_si91x_bsd_socket_state_t excluded_state,
                                                  int16_t role);
 
+/**
+ * A internal function to find the socket listening on the given local port
+ * @param port Local port number of the server socket
+ * @return Pointer to the listening socket, or NULL if none is found
+ */
+sli_si91x_socket_t *sli_si91x_get_listening_socket_from_port(uint16_t port);
+
 sl_status_t sli_si91x_send_socket_data(sli_si91x_socket_t *si91x_socket,
                                        const sli_si91x_socket_send_request_t *request,
                                        const void *data);
@@ -313,6 +320,17 @@ int32_t sli_get_socket_command_from_host_packet(sl_wifi_buffer_t *buffer);
 
 void sli_si91x_set_socket_event(uint32_t event_mask);
 
+/**
+ * A internal function to record host-side readiness of a socket and wake up pollers
+ * @param socket Socket that became ready
+ * @param events Bitmap of SL_SI91X_SOCKET_POLL_* events
+ */
+void sli_si91x_socket_set_poll_event(sli_si91x_socket_t *socket, uint8_t events);
+
+int sli_si91x_socket_poll_ctl(sl_si91x_socket_poll_ctl_t operation, int socket, uint32_t events);
+
+int sli_si91x_socket_poll_wait(sl_si91x_socket_poll_event_t *events, uint32_t max_events, uint32_t timeout);
+
 sl_status_t sli_si91x_flush_select_request_table(uint16_t error_code);
 
 sl_status_t sli_si91x_udp_connect_if_unconnected(sli_si91x_socket_t *si91x_socket,
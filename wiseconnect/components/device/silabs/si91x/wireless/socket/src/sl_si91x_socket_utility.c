@@ -52,6 +52,21 @@
 #define SL_SOCKET_DEFAULT_BUFFER_LIMIT 3
 #endif
 
+// Number of slots in the firmware socket ID and local port lookup maps. Must be a power of two.
+#define SLI_SI91X_SOCKET_LOOKUP_MAP_SIZE 32
+#define SLI_SI91X_SOCKET_LOOKUP_SLOT(key) ((uint32_t)(key) & (SLI_SI91X_SOCKET_LOOKUP_MAP_SIZE - 1))
+
+// Each lookup slot is a bitmap of host socket indices, so the socket table must fit in one word.
+#if (SLI_NUMBER_OF_SOCKETS > 32)
+#error "SLI_NUMBER_OF_SOCKETS must not exceed 32"
+#endif
+
+// Event flag raised whenever a monitored socket becomes ready
+#define SLI_SI91X_SOCKET_POLL_READY_EVENT BIT(0)
+
+// Readiness events that stay latched until they are reported by sli_si91x_socket_poll_wait()
+#define SLI_SI91X_SOCKET_POLL_LATCHED_EVENTS (SL_SI91X_SOCKET_POLL_IN | SL_SI91X_SOCKET_POLL_HUP)
+
 /******************************************************
  *                    Structures
  ******************************************************/
@@ -80,6 +95,9 @@ static sli_si91x_select_request_t *sli_si91x_get_available_select_id(void);
  */
 static bool sli_is_port_available(uint16_t port_number);
 
+static void sli_si91x_set_socket_id(sli_si91x_socket_t *socket, int32_t socket_id);
+static void sli_si91x_set_server_socket_port(sli_si91x_socket_t *socket, uint16_t port);
+
 /******************************************************
  *               Variable Definitions
  ******************************************************/
@@ -90,12 +108,18 @@ static uint8_t sli_si91x_max_select_count
 
 static sli_si91x_select_request_t *select_request_table = NULL;
 
+// Bitmaps of host socket indices, keyed by firmware socket ID and by local port of TCP server sockets.
+// Lookups in the RX and event paths only visit the sockets in one slot instead of the whole socket table.
+static uint32_t sli_si91x_socket_id_map[SLI_SI91X_SOCKET_LOOKUP_MAP_SIZE]   = { 0 };
+static uint32_t sli_si91x_socket_port_map[SLI_SI91X_SOCKET_LOOKUP_MAP_SIZE] = { 0 };
+
 sli_si91x_buffer_queue_t sli_si91x_select_response_queue;
 
 extern sli_si91x_command_queue_t cmd_queues[SI91X_CMD_MAX];
 
 osEventFlagsId_t si91x_socket_events        = 0;
 osEventFlagsId_t si91x_socket_select_events = 0;
+static osEventFlagsId_t si91x_socket_poll_events = 0;
 
 extern volatile uint32_t tx_socket_command_queues_status;
 
@@ -115,7 +139,7 @@ void sli_handle_accept_response(sli_si91x_socket_t *si91x_client_socket,
   if (si91x_client_socket == NULL)
     return;
   // Update socket parameters based on the accept response
-  si91x_client_socket->id                         = accept_response->socket_id;
+  sli_si91x_set_socket_id(si91x_client_socket, accept_response->socket_id);
   si91x_client_socket->local_address.sin6_port    = accept_response->src_port_num;
   si91x_client_socket->remote_address.sin6_port   = accept_response->dest_port;
   si91x_client_socket->mss                        = accept_response->mss;
@@ -242,6 +266,14 @@ sl_status_t sli_si91x_socket_init(uint8_t max_select_count)
     }
   }
 
+  // Check if the event flags object for host-side socket readiness is already initialized.
+  if (si91x_socket_poll_events == NULL) {
+    si91x_socket_poll_events = osEventFlagsNew(NULL);
+    if (si91x_socket_poll_events == NULL) {
+      return SL_STATUS_FAIL;
+    }
+  }
+
   /* 
   Allocate memory for the select request table based on the number of select instances.
   Heap memory is allocated for the number of instances of this structure based on 
@@ -281,6 +313,10 @@ sl_status_t sli_si91x_socket_deinit(void)
     osEventFlagsDelete(si91x_socket_select_events);
     si91x_socket_select_events = NULL;
   }
+  if (si91x_socket_poll_events != NULL) {
+    osEventFlagsDelete(si91x_socket_poll_events);
+    si91x_socket_poll_events = NULL;
+  }
   if (select_request_table != NULL) {
     free(select_request_table);
     select_request_table = NULL;
@@ -295,6 +331,7 @@ sl_status_t sli_si91x_vap_shutdown(uint8_t vap_id, sli_si91x_bsd_disconnect_reas
     if ((sli_si91x_sockets[socket_index] != NULL) && (sli_si91x_sockets[socket_index]->vap_id == vap_id)) {
       sli_si91x_sockets[socket_index]->state             = DISCONNECTED;
       sli_si91x_sockets[socket_index]->disconnect_reason = disconnect_reason;
+      sli_si91x_socket_set_poll_event(sli_si91x_sockets[socket_index], SL_SI91X_SOCKET_POLL_HUP);
     }
   }
 
@@ -370,6 +407,12 @@ void sli_si91x_free_socket(int socket)
     return;
   }
 
+  // Drop the socket from the ID and port lookup maps before it is released.
+  CORE_irqState_t state = CORE_EnterAtomic();
+  sli_si91x_socket_id_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(si91x_socket->id)] &= ~(1UL << socket);
+  sli_si91x_socket_port_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(si91x_socket->local_address.sin6_port)] &= ~(1UL << socket);
+  CORE_ExitAtomic(state);
+
   // Check if the socket has associated OS event flags.
   if (si91x_socket->socket_events != NULL) {
     // Delete the OS event flags associated with the socket to free resources.
@@ -395,12 +438,37 @@ sli_si91x_socket_t *sli_get_si91x_socket(int32_t socket)
   return sli_si91x_sockets[socket];
 }
 
+// Update the firmware socket ID of a socket and keep the ID lookup map in sync
+static void sli_si91x_set_socket_id(sli_si91x_socket_t *socket, int32_t socket_id)
+{
+  CORE_irqState_t state = CORE_EnterAtomic();
+  sli_si91x_socket_id_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(socket->id)] &= ~(1UL << socket->index);
+  socket->id = socket_id;
+  sli_si91x_socket_id_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(socket_id)] |= (1UL << socket->index);
+  CORE_ExitAtomic(state);
+}
+
+// Register the local port of a TCP server socket in the port lookup map
+static void sli_si91x_set_server_socket_port(sli_si91x_socket_t *socket, uint16_t port)
+{
+  CORE_irqState_t state = CORE_EnterAtomic();
+  sli_si91x_socket_port_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(socket->local_address.sin6_port)] &= ~(1UL << socket->index);
+  socket->local_address.sin6_port = port;
+  sli_si91x_socket_port_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(port)] |= (1UL << socket->index);
+  CORE_ExitAtomic(state);
+}
+
 sli_si91x_socket_t *sli_si91x_get_socket_from_id(int socket_id,
                                                  sli_si91x_bsd_socket_state_t excluded_state,
                                                  int16_t role)
 {
   sli_si91x_socket_t *possible_socket = NULL;
-  for (uint8_t index = 0; index < SLI_NUMBER_OF_SOCKETS; ++index) {
+  uint32_t candidates                 = sli_si91x_socket_id_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(socket_id)];
+
+  // Visit only the sockets sharing this ID slot, in ascending index order
+  while (candidates != 0) {
+    uint8_t index = (uint8_t)__builtin_ctz(candidates);
+    candidates &= candidates - 1;
     sli_si91x_socket_t *socket = sli_si91x_sockets[index];
     if (socket != NULL && socket->id == socket_id && socket->state != excluded_state
         && (role == -1 || socket->role == role)) {
@@ -416,13 +484,33 @@ sli_si91x_socket_t *sli_si91x_get_socket_from_id(int socket_id,
 
 static sli_si91x_socket_t *sli_si91x_get_socket_from_port(uint16_t src_port)
 {
-  for (int i = 0; i < SLI_NUMBER_OF_SOCKETS; i++) {
-    if (sli_si91x_sockets[i] == NULL) {
+  uint32_t candidates = sli_si91x_socket_port_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(src_port)];
+
+  while (candidates != 0) {
+    uint8_t index = (uint8_t)__builtin_ctz(candidates);
+    candidates &= candidates - 1;
+    if (sli_si91x_sockets[index] == NULL) {
       continue;
     }
-    if ((sli_si91x_sockets[i]->role == SLI_SI91X_SOCKET_TCP_SERVER)
-        && (src_port == sli_si91x_sockets[i]->local_address.sin6_port)) {
-      return sli_si91x_sockets[i];
+    if ((sli_si91x_sockets[index]->role == SLI_SI91X_SOCKET_TCP_SERVER)
+        && (src_port == sli_si91x_sockets[index]->local_address.sin6_port)) {
+      return sli_si91x_sockets[index];
+    }
+  }
+
+  return NULL;
+}
+
+sli_si91x_socket_t *sli_si91x_get_listening_socket_from_port(uint16_t port)
+{
+  uint32_t candidates = sli_si91x_socket_port_map[SLI_SI91X_SOCKET_LOOKUP_SLOT(port)];
+
+  while (candidates != 0) {
+    uint8_t index = (uint8_t)__builtin_ctz(candidates);
+    candidates &= candidates - 1;
+    if (sli_si91x_sockets[index] != NULL && sli_si91x_sockets[index]->local_address.sin6_port == port
+        && sli_si91x_sockets[index]->state == LISTEN) {
+      return sli_si91x_sockets[index];
     }
   }
 
@@ -450,9 +538,9 @@ void sli_get_free_socket(sli_si91x_socket_t **socket, int *socket_fd)
       break;
     }
     memset(sli_si91x_sockets[socket_index], 0, sizeof(sli_si91x_socket_t));
-    sli_si91x_sockets[socket_index]->id                = -1;
     sli_si91x_sockets[socket_index]->index             = socket_index;
     sli_si91x_sockets[socket_index]->data_buffer_limit = SL_SOCKET_DEFAULT_BUFFER_LIMIT;
+    sli_si91x_set_socket_id(sli_si91x_sockets[socket_index], -1);
 
     // If a free socket is found, set the socket pointer to point to it
     *socket = sli_si91x_sockets[socket_index];
@@ -663,11 +751,17 @@ sl_status_t sli_create_and_send_socket_request(int socketIdIndex, int type, cons
   packet                 = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
   socket_create_response = (sli_si91x_socket_create_response_t *)packet->data;
 
-  si91x_bsd_socket->id = (int32_t)(socket_create_response->socket_id[0] | (socket_create_response->socket_id[1] << 8));
-  si91x_bsd_socket->local_address.sin6_port =
-    (uint16_t)(socket_create_response->module_port[0] | (socket_create_response->module_port[1] << 8));
+  sli_si91x_set_socket_id(
+    si91x_bsd_socket,
+    (int32_t)(socket_create_response->socket_id[0] | (socket_create_response->socket_id[1] << 8)));
 
-  if (type != SLI_SI91X_SOCKET_TCP_SERVER) {
+  if (type == SLI_SI91X_SOCKET_TCP_SERVER) {
+    sli_si91x_set_server_socket_port(
+      si91x_bsd_socket,
+      (uint16_t)(socket_create_response->module_port[0] | (socket_create_response->module_port[1] << 8)));
+  } else {
+    si91x_bsd_socket->local_address.sin6_port =
+      (uint16_t)(socket_create_response->module_port[0] | (socket_create_response->module_port[1] << 8));
     si91x_bsd_socket->remote_address.sin6_port =
       (uint16_t)(socket_create_response->dst_port[0] | socket_create_response->dst_port[1] << 8);
   }
@@ -945,6 +1039,8 @@ sl_status_t sli_si91x_socket_event_handler(sl_status_t status,
     sli_si91x_socket_t *client_socket = sli_get_si91x_socket(client_socket_id);
 
     sli_handle_accept_response(client_socket, accept_response);
+    sli_si91x_socket_set_poll_event(server_socket, SL_SI91X_SOCKET_POLL_IN);
+    sli_si91x_socket_set_poll_event(client_socket, SL_SI91X_SOCKET_POLL_OUT);
 
     if (server_socket->user_accept_callback != NULL) {
       // Call the accept callback function with relevant socket information
@@ -970,6 +1066,7 @@ sl_status_t sli_si91x_socket_event_handler(sl_status_t status,
       frame_status = (frame_status == SL_STATUS_OK) ? (SL_STATUS_SI91X_SOCKET_CLOSED & 0xFFFF) : frame_status;
       sli_si91x_flush_socket_command_queues_based_on_queue_type(index, frame_status);
       sli_si91x_flush_socket_data_queues_based_on_queue_type(index);
+      sli_si91x_socket_set_poll_event(socket, SL_SI91X_SOCKET_POLL_IN | SL_SI91X_SOCKET_POLL_HUP);
 
       if (user_remote_socket_termination_callback != NULL) {
         user_remote_socket_termination_callback(socket->id,
@@ -1283,13 +1380,8 @@ int sli_si91x_get_socket_id(sl_wifi_system_packet_t *packet)
     case SLI_WLAN_RSP_SOCKET_CLOSE:
       if (((sl_si91x_socket_close_response_t *)packet->data)->socket_id == 0) {
         const uint16_t port = ((sl_si91x_socket_close_response_t *)packet->data)->port_number;
-        for (int i = 0; i < SLI_NUMBER_OF_SOCKETS; ++i) {
-          if (sli_si91x_sockets[i] != NULL && sli_si91x_sockets[i]->local_address.sin6_port == port
-              && sli_si91x_sockets[i]->state == LISTEN) {
-            return sli_si91x_sockets[i]->id;
-          }
-        }
-        return -1;
+        const sli_si91x_socket_t *listening_socket = sli_si91x_get_listening_socket_from_port(port);
+        return (listening_socket != NULL) ? listening_socket->id : -1;
       } else {
         return ((sl_si91x_socket_close_response_t *)packet->data)->socket_id;
       }
@@ -1699,6 +1791,137 @@ void sli_si91x_set_socket_event(uint32_t event_mask)
   osEventFlagsSet(si91x_socket_events, event_mask);
 }
 
+void sli_si91x_socket_set_poll_event(sli_si91x_socket_t *socket, uint8_t events)
+{
+  if (socket == NULL) {
+    return;
+  }
+
+  CORE_irqState_t state = CORE_EnterAtomic();
+  socket->poll_pending |= (uint8_t)(events & SLI_SI91X_SOCKET_POLL_LATCHED_EVENTS);
+  bool wake_up          = (socket->poll_interest & events) != 0;
+  CORE_ExitAtomic(state);
+
+  // Only wake up pollers if someone is monitoring this socket for the event
+  if (wake_up && si91x_socket_poll_events != NULL) {
+    osEventFlagsSet(si91x_socket_poll_events, SLI_SI91X_SOCKET_POLL_READY_EVENT);
+  }
+}
+
+static uint8_t sli_si91x_socket_get_ready_events(sli_si91x_socket_t *socket)
+{
+  uint8_t ready = socket->poll_pending;
+
+  // Writability is level triggered and derived from the host-side transmit queue
+  if ((socket->state == CONNECTED || socket->state == UDP_UNCONNECTED_READY)
+      && (socket->data_buffer_limit == 0 || socket->data_buffer_count < socket->data_buffer_limit)) {
+    ready |= SL_SI91X_SOCKET_POLL_OUT;
+  }
+
+  return ready & socket->poll_interest;
+}
+
+int sli_si91x_socket_poll_ctl(sl_si91x_socket_poll_ctl_t operation, int socket, uint32_t events)
+{
+  sli_si91x_socket_t *si91x_socket = sli_get_si91x_socket(socket);
+
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket == NULL, EBADF);
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(
+    (events & ~(uint32_t)(SL_SI91X_SOCKET_POLL_IN | SL_SI91X_SOCKET_POLL_OUT | SL_SI91X_SOCKET_POLL_HUP)) != 0,
+    EINVAL);
+
+  switch (operation) {
+    case SL_SI91X_SOCKET_POLL_CTL_ADD:
+      SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket->poll_interest != 0, EEXIST);
+      SLI_SET_ERRNO_AND_RETURN_IF_TRUE(events == 0, EINVAL);
+      break;
+    case SL_SI91X_SOCKET_POLL_CTL_MOD:
+      SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket->poll_interest == 0, ENOENT);
+      SLI_SET_ERRNO_AND_RETURN_IF_TRUE(events == 0, EINVAL);
+      break;
+    case SL_SI91X_SOCKET_POLL_CTL_DEL:
+      SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket->poll_interest == 0, ENOENT);
+      events = 0;
+      break;
+    default:
+      SLI_SET_ERRNO_AND_RETURN_IF_TRUE(true, EINVAL);
+  }
+
+  CORE_irqState_t state      = CORE_EnterAtomic();
+  si91x_socket->poll_interest = (uint8_t)events;
+  bool ready                 = sli_si91x_socket_get_ready_events(si91x_socket) != 0;
+  CORE_ExitAtomic(state);
+
+  // Wake up pollers so that sockets which are already ready get reported
+  if (ready && si91x_socket_poll_events != NULL) {
+    osEventFlagsSet(si91x_socket_poll_events, SLI_SI91X_SOCKET_POLL_READY_EVENT);
+  }
+
+  return SLI_SI91X_NO_ERROR;
+}
+
+static int sli_si91x_socket_collect_ready(sl_si91x_socket_poll_event_t *events, uint32_t max_events)
+{
+  uint32_t count = 0;
+
+  for (uint8_t index = 0; index < SLI_NUMBER_OF_SOCKETS && count < max_events; index++) {
+    sli_si91x_socket_t *socket = sli_si91x_sockets[index];
+    if (socket == NULL || socket->poll_interest == 0) {
+      continue;
+    }
+
+    CORE_irqState_t state = CORE_EnterAtomic();
+    uint8_t ready         = sli_si91x_socket_get_ready_events(socket);
+    // Latched events are consumed once reported
+    socket->poll_pending &= (uint8_t)~ready;
+    CORE_ExitAtomic(state);
+
+    if (ready != 0) {
+      events[count].socket = index;
+      events[count].events = ready;
+      count++;
+    }
+  }
+
+  return (int)count;
+}
+
+int sli_si91x_socket_poll_wait(sl_si91x_socket_poll_event_t *events, uint32_t max_events, uint32_t timeout)
+{
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(events == NULL, EFAULT);
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(max_events == 0, EINVAL);
+  SLI_SET_ERRNO_AND_RETURN_IF_TRUE(si91x_socket_poll_events == NULL, EPERM);
+
+  uint32_t start_time   = osKernelGetTickCount();
+  uint32_t elapsed_time = 0;
+
+  while (true) {
+    // Clear the wake-up flag before scanning so that an event raised during the scan is not lost
+    osEventFlagsClear(si91x_socket_poll_events, SLI_SI91X_SOCKET_POLL_READY_EVENT);
+
+    int count = sli_si91x_socket_collect_ready(events, max_events);
+    if (count != 0) {
+      return count;
+    }
+
+    if (timeout != osWaitForever) {
+      elapsed_time = sl_si91x_host_elapsed_time(start_time);
+      if (elapsed_time >= timeout) {
+        return 0;
+      }
+    }
+
+    uint32_t flags = osEventFlagsWait(si91x_socket_poll_events,
+                                      SLI_SI91X_SOCKET_POLL_READY_EVENT,
+                                      osFlagsWaitAny,
+                                      (timeout == osWaitForever) ? osWaitForever : (timeout - elapsed_time));
+    if (flags == (uint32_t)osErrorTimeout) {
+      return 0;
+    }
+    SLI_SET_ERRNO_AND_RETURN_IF_TRUE((flags & osFlagsError) != 0, EINVAL);
+  }
+}
+
 sl_status_t sli_si91x_flush_select_request_table(uint16_t error_code)
 {
   // Iterate over all entries in the select_request_table
@@ -1787,4 +2010,4 @@ sl_status_t sli_si91x_set_sni_for_embedded_socket(const sl_si91x_socket_type_len
   free(request);
 
   return status;
-}
\ No newline at end of file
+}
\ No newline at end of file
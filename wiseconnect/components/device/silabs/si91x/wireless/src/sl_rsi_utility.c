@@ -171,6 +171,7 @@ osEventFlagsId_t si91x_events       = 0;
 osEventFlagsId_t si91x_bus_events   = 0;
 osEventFlagsId_t si91x_async_events = 0;
 osMutexId_t malloc_free_mutex       = 0;
+osMutexId_t scan_cache_mutex        = 0;
 
 #ifdef SL_SI91X_SIDE_BAND_CRYPTO
 osMutexId_t side_band_crypto_mutex = 0;
@@ -794,6 +795,7 @@ sl_wifi_event_t sli_convert_si91x_event_to_sl_wifi_event(sli_wlan_cmd_response_t
   switch (command) {
     case SLI_WLAN_RSP_BG_SCAN:
     case SLI_WLAN_RSP_SCAN:
+    case SLI_WLAN_RSP_SCAN_CACHE_RESULT:
       return SL_WIFI_SCAN_RESULT_EVENT | fail_indication;
     case SLI_WLAN_RSP_JOIN:
       return SL_WIFI_JOIN_EVENT | fail_indication;
@@ -1104,6 +1106,11 @@ sl_status_t sl_si91x_platform_init(void)
     malloc_free_mutex = osMutexNew(NULL);
   }
 
+  // Create scan cache mutex
+  if (scan_cache_mutex == NULL) {
+    scan_cache_mutex = osMutexNew(NULL);
+  }
+
 #ifdef SL_SI91X_SIDE_BAND_CRYPTO
   // Create side_band_crypto_mutex mutex
   side_band_crypto_mutex = osMutexNew(NULL);
@@ -1152,6 +1159,10 @@ sl_status_t sli_si91x_platform_deinit(void)
   // Delete malloc/free mutex
   osMutexDelete(malloc_free_mutex);
   malloc_free_mutex = NULL;
+
+  // Delete scan cache mutex
+  osMutexDelete(scan_cache_mutex);
+  scan_cache_mutex = NULL;
   return SL_STATUS_OK;
 }
 
@@ -750,6 +750,44 @@ sl_status_t sl_wifi_start_scan(sl_wifi_interface_t interface,
 sl_status_t sl_wifi_get_stored_scan_results(sl_wifi_interface_t interface,
                                             sl_wifi_extended_scan_result_parameters_t *extended_scan_parameters);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Configures the host-side scan result cache used by @ref sl_wifi_start_scan.
+ * @details
+ *   When enabled, results of active and passive 2.4 GHz scans are cached on the host, keyed by BSSID and channel.
+ *   A later scan request whose channels were all scanned within max_age_ms is served from the cache without starting
+ *   a radio scan; the cached result is delivered to the scan results callback from the event handler thread, as for a
+ *   radio scan.
+ *   If refresh_stale_channels_only is set, only the stale channels are scanned and the callback receives the
+ *   fresh results merged with the cached results of the remaining channels.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_wifi_init should be called before this API.
+ * @param[in] configuration
+ *   Scan cache configuration as identified by @ref sl_wifi_scan_cache_configuration_t. A max_age_ms of 0 disables the cache.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ * @note
+ *   Scan requests of type SL_WIFI_SCAN_TYPE_EXTENDED and SL_WIFI_SCAN_TYPE_ADV_SCAN always bypass the cache.
+ ******************************************************************************/
+sl_status_t sl_wifi_set_scan_cache_configuration(const sl_wifi_scan_cache_configuration_t *configuration);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Retrieves the hit, miss and age counters of the host-side scan result cache.
+ * @param[out] statistics
+ *   @ref sl_wifi_scan_cache_statistics_t object that receives the cache statistics.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sl_wifi_get_scan_cache_statistics(sl_wifi_scan_cache_statistics_t *statistics);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Discards all cached scan results and resets the cache statistics.
+ ******************************************************************************/
+void sl_wifi_flush_scan_cache(void);
+
 /***************************************************************************/ /**
  * @brief
  *   Stops an ongoing advanced Wi-Fi scan operation on the specified interface.
@@ -865,6 +903,93 @@ sl_status_t sl_wifi_connect(sl_wifi_interface_t interface,
                             const sl_wifi_client_configuration_t *access_point,
                             uint32_t timeout_ms);
 
+/***************************************************************************/ /**
+ * @brief
+ *   Enable the fast-reconnect cache.
+ *   After a successful connection, the BSSID, channel, security mode and, for WPA/WPA2 personal security, the pairwise
+ *   master key of the access point are cached per credential ID. The next @ref sl_wifi_connect with the same credential ID,
+ *   SSID and security mode scans only the cached channel, joins the cached BSSID and skips the PMK derivation.
+ *   If that attempt fails, the entry is discarded and the normal connection path is used with the remainder of
+ *   timeout_ms.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_wifi_init should be called before this API.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ * @note
+ *   The fast path is only used for synchronous connections (timeout_ms other than 0) with open or personal security.
+ * @note
+ *   Deriving the PMK after the first connection to a WPA/WPA2 network delays the return of @ref sl_wifi_connect once.
+ ******************************************************************************/
+sl_status_t sl_wifi_enable_fast_reconnect(void);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Disable the fast-reconnect cache and discard all cached entries.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sl_wifi_disable_fast_reconnect(void);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Retrieve the fast-reconnect cache entry of a credential ID, without its pairwise master key.
+ * @param[in] credential_id
+ *   Credential ID of the client configuration as identified by @ref sl_wifi_credential_id_t
+ * @param[out] entry
+ *   @ref sl_wifi_fast_reconnect_entry_t object that receives the cached entry. pmk is cleared and pmk_valid is 0.
+ * @return
+ *   sl_status_t. SL_STATUS_NOT_FOUND if no entry is cached for the credential ID.
+ *   See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ * @note
+ *   An entry restored without its pairwise master key still targets the cached channel and BSSID, but the key is
+ *   derived from the PSK again. Use @ref sl_wifi_export_fast_reconnect_entry to persist the key as well.
+ ******************************************************************************/
+sl_status_t sl_wifi_get_fast_reconnect_entry(sl_wifi_credential_id_t credential_id,
+                                             sl_wifi_fast_reconnect_entry_t *entry);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Export the fast-reconnect cache entry of a credential ID including its pairwise master key, for example to
+ *   persist it across resets.
+ * @param[in] credential_id
+ *   Credential ID of the client configuration as identified by @ref sl_wifi_credential_id_t
+ * @param[out] entry
+ *   @ref sl_wifi_fast_reconnect_entry_t object that receives the cached entry.
+ * @return
+ *   sl_status_t. SL_STATUS_NOT_FOUND if no entry is cached for the credential ID.
+ *   See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ * @note
+ *   The entry contains the pairwise master key in plaintext. It must be stored as securely as the credential itself
+ *   and cleared from memory once no longer needed.
+ ******************************************************************************/
+sl_status_t sl_wifi_export_fast_reconnect_entry(sl_wifi_credential_id_t credential_id,
+                                                sl_wifi_fast_reconnect_entry_t *entry);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Restore a fast-reconnect cache entry previously retrieved with @ref sl_wifi_get_fast_reconnect_entry or
+ *   @ref sl_wifi_export_fast_reconnect_entry.
+ * @pre Pre-conditions:
+ * - 
+ *   @ref sl_wifi_enable_fast_reconnect should be called before this API.
+ * @param[in] entry
+ *   @ref sl_wifi_fast_reconnect_entry_t object to restore. An existing entry for the same credential ID is replaced.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sl_wifi_set_fast_reconnect_entry(const sl_wifi_fast_reconnect_entry_t *entry);
+
+/***************************************************************************/ /**
+ * @brief
+ *   Retrieve the attempt counters and time-to-connected measurements of the fast and normal connection paths.
+ * @param[out] statistics
+ *   @ref sl_wifi_fast_reconnect_statistics_t object that receives the statistics.
+ * @return
+ *   sl_status_t. See https://docs.silabs.com/gecko-platform/latest/platform-common/status for details.
+ ******************************************************************************/
+sl_status_t sl_wifi_get_fast_reconnect_statistics(sl_wifi_fast_reconnect_statistics_t *statistics);
+
 /***************************************************************************/ /**
  * @brief
  *   Disconnect the Wi-Fi client interface.
@@ -232,6 +232,51 @@ typedef struct {
   uint8_t *network_type_filter; ///< Pointer to Network type (Filter based on APs network type).
 } sl_wifi_extended_scan_result_parameters_t;
 
+/// Wi-Fi scan result cache configuration
+typedef struct {
+  uint32_t max_age_ms; ///< Maximum age, in milliseconds, of cached results used to serve a scan request. 0 disables the cache.
+  uint8_t
+    refresh_stale_channels_only; ///< If set, a scan request only rescans channels whose cached results are older than max_age_ms.
+} sl_wifi_scan_cache_configuration_t;
+
+/// Wi-Fi scan result cache statistics
+typedef struct {
+  uint32_t hits;              ///< Number of scan requests served entirely from the cache
+  uint32_t misses;            ///< Number of scan requests that required a scan of all requested channels
+  uint32_t partial_refreshes; ///< Number of scan requests that only rescanned stale channels
+  uint32_t last_hit_age_ms;   ///< Age, in milliseconds, of the oldest channel results served by the last cache hit
+  uint32_t max_hit_age_ms;    ///< Largest age, in milliseconds, of channel results served from the cache
+  uint32_t cached_entries;    ///< Number of access points currently held in the cache
+} sl_wifi_scan_cache_statistics_t;
+
+/**
+ * @struct sl_wifi_fast_reconnect_entry_t
+ * @brief Wi-Fi fast-reconnect cache entry.
+ *
+ * Holds the access point a client profile last connected to, so that the next connection can target it directly.
+ */
+typedef struct {
+  sl_wifi_credential_id_t credential_id; ///< Credential ID of the client configuration the entry belongs to
+  sl_wifi_ssid_t ssid;                   ///< SSID of the access point
+  sl_mac_address_t bssid;                ///< BSSID of the access point last connected to
+  uint8_t channel;                       ///< Channel of the access point last connected to
+  uint8_t pmk_valid;                     ///< Set if pmk holds the pairwise master key derived for the SSID
+  sl_wifi_security_t security;           ///< Security mode used to connect to the access point
+  uint8_t pmk[SL_WIFI_MAX_PMK_LENGTH];   ///< Pairwise master key
+} sl_wifi_fast_reconnect_entry_t;
+
+/// Wi-Fi fast-reconnect statistics
+typedef struct {
+  uint32_t fast_attempts;           ///< Number of connections attempted using a cached access point
+  uint32_t fast_connections;        ///< Number of connections established using a cached access point
+  uint32_t fallbacks;               ///< Number of fast connection attempts that fell back to the normal connection path
+  uint32_t normal_connections;      ///< Number of connections established through the normal connection path
+  uint32_t last_fast_connect_ms;    ///< Time to connected, in milliseconds, of the last fast connection
+  uint32_t total_fast_connect_ms;   ///< Accumulated time to connected, in milliseconds, of all fast connections
+  uint32_t last_normal_connect_ms;  ///< Time to connected, in milliseconds, of the last normal connection
+  uint32_t total_normal_connect_ms; ///< Accumulated time to connected, in milliseconds, of all normal connections
+} sl_wifi_fast_reconnect_statistics_t;
+
 /**
  * @struct sl_wifi_scan_configuration_t
  * @brief Wi-Fi scan configuration structure.
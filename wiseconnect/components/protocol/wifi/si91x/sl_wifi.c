@@ -122,6 +122,27 @@ extern rsi_m4ta_desc_t crypto_desc[2];
 #define MAX_2_4G_CHANNEL                     14
 #define DEFAULT_LISTEN_INTERVAL_MULTIPLIER   1
 
+/*========================================================================*/
+// Scan result cache
+/*========================================================================*/
+#ifndef SL_WIFI_SCAN_CACHE_MAX_ENTRIES
+#define SL_WIFI_SCAN_CACHE_MAX_ENTRIES 32
+#endif
+#define SLI_SCAN_CACHE_ALL_CHANNELS (BIT(MAX_2_4G_CHANNEL) - 1)
+#define SLI_SCAN_CACHE_RESULT_SIZE \
+  (sizeof(sl_wifi_scan_result_t) + (SL_WIFI_MAX_SCANNED_AP * sizeof(((sl_wifi_scan_result_t *)0)->scan_info[0])))
+
+#ifndef SL_WIFI_FAST_RECONNECT_MAX_ENTRIES
+#define SL_WIFI_FAST_RECONNECT_MAX_ENTRIES 4
+#endif
+#define SLI_GENERATE_PMK_FROM_PSK 3
+
+typedef struct {
+  sl_wifi_extended_scan_result_t info; ///< Cached access point information
+  uint32_t timestamp;                  ///< Tick count at which the access point was last seen
+  bool in_use;                         ///< Entry holds a cached access point
+} sli_wifi_scan_cache_entry_t;
+
 /*========================================================================*/
 // 11ax params
 /*========================================================================*/
@@ -145,8 +166,25 @@ extern bool device_initialized;
 extern bool bg_enabled;
 extern bool interface_is_up[SL_WIFI_MAX_INTERFACE_INDEX];
 extern sl_wifi_interface_t default_interface;
+extern osMutexId_t scan_cache_mutex;
 static sl_wifi_advanced_scan_configuration_t advanced_scan_configuration     = { 0 };
 static sl_wifi_advanced_client_configuration_t advanced_client_configuration = { 0 };
+static sl_wifi_scan_cache_configuration_t scan_cache_configuration           = { 0 };
+static sl_wifi_scan_cache_statistics_t scan_cache_statistics                 = { 0 };
+static sli_wifi_scan_cache_entry_t scan_cache[SL_WIFI_SCAN_CACHE_MAX_ENTRIES] = { 0 };
+static uint32_t scan_cache_channel_timestamp[MAX_2_4G_CHANNEL]               = { 0 };
+static uint16_t scan_cache_valid_channels                                    = 0;
+static uint16_t scan_cache_pending_channels                                  = 0;
+static uint16_t scan_cache_merge_channels                                    = 0;
+static bool scan_cache_scan_pending                                          = false;
+static sl_wifi_ssid_t scan_cache_merge_ssid                                  = { 0 };
+static uint32_t scan_cache_result_buffer[(SLI_SCAN_CACHE_RESULT_SIZE + 3) / 4];
+
+static bool fast_reconnect_enabled                                                             = false;
+static uint8_t fast_reconnect_next_entry                                                       = 0;
+static sl_wifi_fast_reconnect_entry_t fast_reconnect_cache[SL_WIFI_FAST_RECONNECT_MAX_ENTRIES] = { 0 };
+static sl_wifi_fast_reconnect_statistics_t fast_reconnect_statistics                           = { 0 };
+
 int32_t validate_datarate(sl_wifi_data_rate_t data_rate);
 sl_status_t sl_wifi_get_associated_client_list(const void *client_list_buffer,
                                                uint16_t buffer_length,
@@ -479,6 +517,236 @@ static sl_status_t sli_handle_background_scan(const sl_wifi_scan_configuration_t
                                        NULL);
 }
 
+static bool sli_scan_cache_ssid_matches(const sl_wifi_extended_scan_result_t *info, const sl_wifi_ssid_t *ssid)
+{
+  if (ssid == NULL) {
+    return true;
+  }
+  return (strnlen((const char *)info->ssid, sizeof(info->ssid)) == ssid->length)
+         && (memcmp(info->ssid, ssid->value, ssid->length) == 0);
+}
+
+// Build a scan result from the cached access points on the given channels, strongest first
+static uint32_t sli_scan_cache_build_result(uint16_t channels, const sl_wifi_ssid_t *ssid)
+{
+  sl_wifi_scan_result_t *result = (sl_wifi_scan_result_t *)scan_cache_result_buffer;
+  uint32_t count                = 0;
+
+  memset(result, 0, sizeof(sl_wifi_scan_result_t));
+
+  for (uint8_t index = 0; index < SL_WIFI_SCAN_CACHE_MAX_ENTRIES; index++) {
+    const sl_wifi_extended_scan_result_t *info = &scan_cache[index].info;
+    if (!scan_cache[index].in_use || !(channels & BIT(info->rf_channel - 1)) || !sli_scan_cache_ssid_matches(info, ssid)) {
+      continue;
+    }
+
+    // RSSI is reported as a magnitude, so a lower value is a stronger signal
+    uint32_t position = count;
+    while ((position > 0) && (result->scan_info[position - 1].rssi_val > info->rssi)) {
+      position--;
+    }
+    if (position >= SL_WIFI_MAX_SCANNED_AP) {
+      continue;
+    }
+    uint32_t last = (count < SL_WIFI_MAX_SCANNED_AP) ? count : (SL_WIFI_MAX_SCANNED_AP - 1);
+    memmove(&result->scan_info[position + 1], &result->scan_info[position], (last - position) * sizeof(result->scan_info[0]));
+
+    memset(&result->scan_info[position], 0, sizeof(result->scan_info[0]));
+    result->scan_info[position].rf_channel    = info->rf_channel;
+    result->scan_info[position].security_mode = info->security_mode;
+    result->scan_info[position].rssi_val      = info->rssi;
+    result->scan_info[position].network_type  = info->network_type;
+    memcpy(result->scan_info[position].ssid, info->ssid, sizeof(info->ssid));
+    memcpy(result->scan_info[position].bssid, info->bssid, sizeof(info->bssid));
+
+    if (count < SL_WIFI_MAX_SCANNED_AP) {
+      count++;
+    }
+  }
+
+  result->scan_count = count;
+  return (uint32_t)(sizeof(sl_wifi_scan_result_t) + count * sizeof(result->scan_info[0]));
+}
+
+static void sli_scan_cache_clear_pending(void)
+{
+  scan_cache_scan_pending     = false;
+  scan_cache_pending_channels = 0;
+  scan_cache_merge_channels   = 0;
+}
+
+// Serve a scan request from the cache if possible, otherwise return the channels that need to be scanned.
+// Called with the scan cache mutex held; a cached result is queued to the event handler thread.
+static bool sli_scan_cache_serve(sl_wifi_interface_t interface,
+                                 const sl_wifi_ssid_t *optional_ssid,
+                                 const sl_wifi_scan_configuration_t *configuration,
+                                 uint16_t *scan_channels)
+{
+  uint16_t requested_channels = configuration->channel_bitmap_2g4;
+  if ((requested_channels == 0) || (requested_channels == 0xFFFF)) {
+    requested_channels = SLI_SCAN_CACHE_ALL_CHANNELS;
+  }
+  requested_channels &= SLI_SCAN_CACHE_ALL_CHANNELS;
+  *scan_channels = configuration->channel_bitmap_2g4;
+
+  sli_scan_cache_clear_pending();
+
+  // Only 2.4 GHz active and passive scans are cached
+  if ((scan_cache_configuration.max_age_ms == 0) || !(interface & SL_WIFI_2_4GHZ_INTERFACE)
+      || ((configuration->type != SL_WIFI_SCAN_TYPE_ACTIVE) && (configuration->type != SL_WIFI_SCAN_TYPE_PASSIVE))) {
+    return false;
+  }
+
+  uint16_t stale_channels = 0;
+  uint32_t oldest_age     = 0;
+  for (uint8_t channel = 1; channel <= MAX_2_4G_CHANNEL; channel++) {
+    if (!(requested_channels & BIT(channel - 1))) {
+      continue;
+    }
+    uint32_t age = sl_si91x_host_elapsed_time(scan_cache_channel_timestamp[channel - 1]);
+    if (!(scan_cache_valid_channels & BIT(channel - 1)) || (age > scan_cache_configuration.max_age_ms)) {
+      stale_channels |= (uint16_t)BIT(channel - 1);
+    } else if (age > oldest_age) {
+      oldest_age = age;
+    }
+  }
+
+  if (stale_channels == 0) {
+    uint32_t length = sli_scan_cache_build_result(requested_channels, optional_ssid);
+    // A directed scan that finds nothing in the cache may be looking for a hidden network
+    if (((optional_ssid == NULL) || (((sl_wifi_scan_result_t *)scan_cache_result_buffer)->scan_count != 0))
+        && (sli_si91x_post_wlan_event(SLI_WLAN_RSP_SCAN_CACHE_RESULT, scan_cache_result_buffer, (uint16_t)length)
+            == SL_STATUS_OK)) {
+      scan_cache_statistics.hits++;
+      scan_cache_statistics.last_hit_age_ms = oldest_age;
+      if (oldest_age > scan_cache_statistics.max_hit_age_ms) {
+        scan_cache_statistics.max_hit_age_ms = oldest_age;
+      }
+      return true;
+    }
+    stale_channels = requested_channels;
+  }
+
+  if (scan_cache_configuration.refresh_stale_channels_only && (stale_channels != requested_channels)) {
+    // Rescan only the stale channels and report them merged with the fresh cached channels
+    scan_cache_statistics.partial_refreshes++;
+    scan_cache_merge_channels = requested_channels;
+    memset(&scan_cache_merge_ssid, 0, sizeof(scan_cache_merge_ssid));
+    if (optional_ssid != NULL) {
+      memcpy(&scan_cache_merge_ssid, optional_ssid, sizeof(scan_cache_merge_ssid));
+    }
+    *scan_channels = stale_channels;
+  } else {
+    scan_cache_statistics.misses++;
+    stale_channels = requested_channels;
+  }
+
+  // A directed scan only reports the requested SSID, so it cannot refresh a channel as a whole
+  scan_cache_pending_channels = (optional_ssid == NULL) ? stale_channels : 0;
+  scan_cache_scan_pending     = true;
+  return false;
+}
+
+// Returns true when the result was merged with the cached channels and queued for delivery in its place
+bool sli_wifi_scan_cache_update(const sl_wifi_scan_result_t *result, uint32_t length)
+{
+  bool merged = false;
+
+  if (result == NULL) {
+    return false;
+  }
+
+  osMutexAcquire(scan_cache_mutex, 0xFFFFFFFFUL);
+  if (!scan_cache_scan_pending) {
+    osMutexRelease(scan_cache_mutex);
+    return false;
+  }
+  scan_cache_scan_pending = false;
+
+  uint32_t now   = sl_si91x_host_get_timestamp();
+  uint32_t count = 0;
+  if (length >= sizeof(sl_wifi_scan_result_t)) {
+    count = (length - sizeof(sl_wifi_scan_result_t)) / sizeof(result->scan_info[0]);
+  }
+  if (result->scan_count < count) {
+    count = result->scan_count;
+  }
+
+  // Access points no longer seen on a rescanned channel are dropped
+  for (uint8_t index = 0; index < SL_WIFI_SCAN_CACHE_MAX_ENTRIES; index++) {
+    if (scan_cache[index].in_use && (scan_cache_pending_channels & BIT(scan_cache[index].info.rf_channel - 1))) {
+      scan_cache[index].in_use = false;
+      scan_cache_statistics.cached_entries--;
+    }
+  }
+
+  for (uint32_t ap = 0; ap < count; ap++) {
+    if ((result->scan_info[ap].rf_channel == 0) || (result->scan_info[ap].rf_channel > MAX_2_4G_CHANNEL)) {
+      continue;
+    }
+
+    // Look up the access point by BSSID and channel, or take a free or the least recently seen entry
+    sli_wifi_scan_cache_entry_t *entry = NULL;
+    sli_wifi_scan_cache_entry_t *spare = NULL;
+    for (uint8_t index = 0; index < SL_WIFI_SCAN_CACHE_MAX_ENTRIES; index++) {
+      sli_wifi_scan_cache_entry_t *candidate = &scan_cache[index];
+      if (candidate->in_use && (candidate->info.rf_channel == result->scan_info[ap].rf_channel)
+          && (memcmp(candidate->info.bssid, result->scan_info[ap].bssid, sizeof(candidate->info.bssid)) == 0)) {
+        entry = candidate;
+        break;
+      }
+      if ((spare == NULL) || (spare->in_use && !candidate->in_use)
+          || (spare->in_use && ((now - candidate->timestamp) > (now - spare->timestamp)))) {
+        spare = candidate;
+      }
+    }
+    if (entry == NULL) {
+      entry = spare;
+      if (!entry->in_use) {
+        scan_cache_statistics.cached_entries++;
+      }
+    }
+
+    entry->in_use             = true;
+    entry->timestamp          = now;
+    entry->info.rf_channel    = result->scan_info[ap].rf_channel;
+    entry->info.security_mode = result->scan_info[ap].security_mode;
+    entry->info.rssi          = result->scan_info[ap].rssi_val;
+    entry->info.network_type  = result->scan_info[ap].network_type;
+    memcpy(entry->info.ssid, result->scan_info[ap].ssid, sizeof(entry->info.ssid));
+    memcpy(entry->info.bssid, result->scan_info[ap].bssid, sizeof(entry->info.bssid));
+  }
+
+  for (uint8_t channel = 1; channel <= MAX_2_4G_CHANNEL; channel++) {
+    if (scan_cache_pending_channels & BIT(channel - 1)) {
+      scan_cache_channel_timestamp[channel - 1] = now;
+    }
+  }
+  scan_cache_valid_channels |= scan_cache_pending_channels;
+  scan_cache_pending_channels = 0;
+
+  if (scan_cache_merge_channels != 0) {
+    uint32_t merged_length = sli_scan_cache_build_result(scan_cache_merge_channels,
+                                                         (scan_cache_merge_ssid.length != 0) ? &scan_cache_merge_ssid
+                                                                                             : NULL);
+    scan_cache_merge_channels = 0;
+    sl_status_t status        = sli_si91x_post_wlan_event(SLI_WLAN_RSP_SCAN_CACHE_RESULT,
+                                                          scan_cache_result_buffer,
+                                                          (uint16_t)merged_length);
+    merged                    = (status == SL_STATUS_OK);
+  }
+  osMutexRelease(scan_cache_mutex);
+
+  return merged;
+}
+
+void sli_wifi_scan_cache_abort(void)
+{
+  osMutexAcquire(scan_cache_mutex, 0xFFFFFFFFUL);
+  sli_scan_cache_clear_pending();
+  osMutexRelease(scan_cache_mutex);
+}
+
 sl_status_t sl_wifi_start_scan(sl_wifi_interface_t interface,
                                const sl_wifi_ssid_t *optional_ssid,
                                const sl_wifi_scan_configuration_t *configuration)
@@ -498,7 +766,18 @@ sl_status_t sl_wifi_start_scan(sl_wifi_interface_t interface,
   }
 
   if (SL_WIFI_SCAN_TYPE_ADV_SCAN != configuration->type) {
-    status = sli_handle_standard_scan(interface, optional_ssid, configuration);
+    sl_wifi_scan_configuration_t scan_configuration = *configuration;
+    osMutexAcquire(scan_cache_mutex, 0xFFFFFFFFUL);
+    bool served =
+      sli_scan_cache_serve(interface, optional_ssid, configuration, &scan_configuration.channel_bitmap_2g4);
+    osMutexRelease(scan_cache_mutex);
+    if (served) {
+      return SL_STATUS_OK;
+    }
+    status = sli_handle_standard_scan(interface, optional_ssid, &scan_configuration);
+    if (status != SL_STATUS_OK) {
+      sli_wifi_scan_cache_abort();
+    }
   } else {
     status = sli_handle_background_scan(configuration);
   }
@@ -631,34 +910,114 @@ sl_status_t sli_handle_psk_security(const sl_wifi_client_configuration_t *ap)
                                        NULL);
 }
 
-sl_status_t sl_wifi_connect(sl_wifi_interface_t interface,
-                            const sl_wifi_client_configuration_t *ap,
-                            uint32_t timeout_ms)
+// Clear secrets through a volatile pointer so that the stores cannot be optimized away
+static void sli_fast_reconnect_zeroize(void *buffer, size_t length)
 {
-  sl_status_t status;
-  sli_si91x_req_scan_t scan_request;
-  sli_si91x_req_eap_config_t eap_req;
-  sli_si91x_join_request_t join_request;
-  sl_wifi_buffer_t *buffer              = NULL;
-  const sl_wifi_system_packet_t *packet = NULL;
+  volatile uint8_t *bytes = (volatile uint8_t *)buffer;
+  while (length-- > 0) {
+    *bytes++ = 0;
+  }
+}
 
-  if (!device_initialized) {
-    return SL_STATUS_NOT_INITIALIZED;
+static bool sli_fast_reconnect_security_supported(sl_wifi_security_t security)
+{
+  return (SL_WIFI_OPEN == security) || (SL_WIFI_WPA == security) || (SL_WIFI_WPA2 == security)
+         || (SL_WIFI_WPA_WPA2_MIXED == security) || (SL_WIFI_WPA3 == security) || (SL_WIFI_WPA3_TRANSITION == security);
+}
+
+static sl_wifi_fast_reconnect_entry_t *sli_find_fast_reconnect_entry(sl_wifi_credential_id_t credential_id)
+{
+  for (uint8_t index = 0; index < SL_WIFI_FAST_RECONNECT_MAX_ENTRIES; index++) {
+    if ((fast_reconnect_cache[index].channel != 0) && (fast_reconnect_cache[index].credential_id == credential_id)) {
+      return &fast_reconnect_cache[index];
+    }
   }
+  return NULL;
+}
 
-  if (interface & SL_WIFI_AP_INTERFACE) {
-    return SL_STATUS_NOT_SUPPORTED;
+static sl_wifi_fast_reconnect_entry_t *sli_allocate_fast_reconnect_entry(sl_wifi_credential_id_t credential_id)
+{
+  sl_wifi_fast_reconnect_entry_t *entry = sli_find_fast_reconnect_entry(credential_id);
+  if (entry == NULL) {
+    entry                     = &fast_reconnect_cache[fast_reconnect_next_entry];
+    fast_reconnect_next_entry = (uint8_t)((fast_reconnect_next_entry + 1) % SL_WIFI_FAST_RECONNECT_MAX_ENTRIES);
   }
+  sli_fast_reconnect_zeroize(entry, sizeof(sl_wifi_fast_reconnect_entry_t));
+  return entry;
+}
 
-  if (!sl_wifi_is_interface_up(interface)) {
-    return SL_STATUS_WIFI_INTERFACE_NOT_UP;
+// Returns the cached access point for the given client configuration, if it can be used for a fast connection
+static sl_wifi_fast_reconnect_entry_t *sli_get_fast_reconnect_target(const sl_wifi_client_configuration_t *ap)
+{
+  if (!fast_reconnect_enabled || !sli_fast_reconnect_security_supported(ap->security)) {
+    return NULL;
   }
 
-  SL_WIFI_ARGS_CHECK_NULL_POINTER(ap);
+  sl_wifi_fast_reconnect_entry_t *entry = sli_find_fast_reconnect_entry(ap->credential_id);
+  if ((entry == NULL) || (entry->security != ap->security) || (entry->ssid.length != ap->ssid.length)
+      || (memcmp(entry->ssid.value, ap->ssid.value, ap->ssid.length) != 0)) {
+    return NULL;
+  }
+  return entry;
+}
+
+// Cache the access point the client is connected to, along with the PMK for WPA/WPA2 personal security
+static void sli_save_fast_reconnect_entry(sl_wifi_interface_t interface, const sl_wifi_client_configuration_t *ap)
+{
+  sl_si91x_rsp_wireless_info_t info = { 0 };
+
+  if (sl_wifi_get_wireless_info(&info) != SL_STATUS_OK || (info.channel_number == 0)) {
+    return;
+  }
+
+  sl_wifi_fast_reconnect_entry_t *entry = sli_allocate_fast_reconnect_entry(ap->credential_id);
+  entry->credential_id                  = ap->credential_id;
+  entry->security                       = ap->security;
+  memcpy(&entry->ssid, &ap->ssid, sizeof(sl_wifi_ssid_t));
+  memcpy(entry->bssid.octet, info.bssid, sizeof(entry->bssid.octet));
+
+  if ((SL_WIFI_WPA == ap->security) || (SL_WIFI_WPA2 == ap->security) || (SL_WIFI_WPA_WPA2_MIXED == ap->security)) {
+    sl_wifi_credential_t cred                       = { 0 };
+    char pre_shared_key[SL_WIFI_MAX_PSK_LENGTH + 1] = { 0 };
+
+    // A PMK credential is already passed to the firmware as is, so there is nothing to derive
+    if ((sli_si91x_host_get_credentials(ap->credential_id, SL_WIFI_PSK_CREDENTIAL, &cred) == SL_STATUS_OK)
+        && (cred.type == SL_WIFI_PSK_CREDENTIAL)) {
+      memcpy(pre_shared_key, cred.psk.value, SL_WIFI_MAX_PSK_LENGTH);
+      entry->pmk_valid =
+        (sl_wifi_get_pairwise_master_key(interface, SLI_GENERATE_PMK_FROM_PSK, &ap->ssid, pre_shared_key, entry->pmk)
+         == SL_STATUS_OK);
+    }
+    sli_fast_reconnect_zeroize(pre_shared_key, sizeof(pre_shared_key));
+    sli_fast_reconnect_zeroize(&cred, sizeof(cred));
+  }
+
+  // A non-zero channel marks the entry as in use
+  entry->channel = (uint8_t)info.channel_number;
+}
+
+static sl_status_t sli_wifi_join_access_point(sl_wifi_interface_t interface,
+                                              const sl_wifi_client_configuration_t *ap,
+                                              uint32_t timeout_ms,
+                                              const sl_wifi_fast_reconnect_entry_t *target)
+{
+  sl_status_t status;
+  sli_si91x_req_scan_t scan_request;
+  sli_si91x_req_eap_config_t eap_req;
+  sli_si91x_join_request_t join_request;
+  sl_wifi_buffer_t *buffer              = NULL;
+  const sl_wifi_system_packet_t *packet = NULL;
 
   status = sli_configure_scan_request(ap, &scan_request, interface);
   VERIFY_STATUS_AND_RETURN(status);
 
+  // Only the channel of the cached access point needs to be scanned
+  if (target != NULL) {
+    memset(scan_request.channel_bit_map_2_4, 0, sizeof(scan_request.channel_bit_map_2_4));
+    memset(scan_request.channel_bit_map_5, 0, sizeof(scan_request.channel_bit_map_5));
+    scan_request.channel[0] = target->channel;
+  }
+
   if (advanced_scan_configuration.active_channel_time != SL_WIFI_DEFAULT_ACTIVE_CHANNEL_SCAN_TIME) {
     status =
       sl_si91x_configure_timeout(SL_SI91X_CHANNEL_ACTIVE_SCAN_TIMEOUT, advanced_scan_configuration.active_channel_time);
@@ -680,7 +1039,22 @@ sl_status_t sl_wifi_connect(sl_wifi_interface_t interface,
     VERIFY_STATUS_AND_RETURN(status);
   } else if ((SL_WIFI_WPA == ap->security) || (SL_WIFI_WPA2 == ap->security) || (SL_WIFI_WPA_WPA2_MIXED == ap->security)
              || (SL_WIFI_WPA3 == ap->security) || (SL_WIFI_WPA3_TRANSITION == ap->security)) {
-    status = sli_handle_psk_security(ap);
+    if ((target != NULL) && target->pmk_valid) {
+      // Hand the cached PMK to the firmware instead of having it derived from the PSK again
+      sli_si91x_req_psk_t psk_request = { 0 };
+      psk_request.type                = 2;
+      memcpy(psk_request.psk_or_pmk, target->pmk, sizeof(psk_request.psk_or_pmk));
+      status = sli_si91x_driver_send_command(SLI_WLAN_REQ_HOST_PSK,
+                                             SLI_SI91X_WLAN_CMD,
+                                             &psk_request,
+                                             sizeof(psk_request),
+                                             SLI_SI91X_WAIT_FOR_COMMAND_SUCCESS,
+                                             NULL,
+                                             NULL);
+      sli_fast_reconnect_zeroize(&psk_request, sizeof(psk_request));
+    } else {
+      status = sli_handle_psk_security(ap);
+    }
     VERIFY_STATUS_AND_RETURN(status);
   } else if (SL_WIFI_WEP == ap->security) {
     return SL_STATUS_NOT_SUPPORTED;
@@ -693,6 +1067,10 @@ sl_status_t sl_wifi_connect(sl_wifi_interface_t interface,
   status = get_configured_join_request(SL_WIFI_CLIENT_INTERFACE, ap, &join_request);
   VERIFY_STATUS_AND_RETURN(status);
 
+  if (target != NULL) {
+    memcpy(join_request.join_bssid, target->bssid.octet, sizeof(join_request.join_bssid));
+  }
+
   status =
     sli_si91x_driver_send_command(SLI_WLAN_REQ_JOIN,
                                   SLI_SI91X_WLAN_CMD,
@@ -729,6 +1107,148 @@ sl_status_t sl_wifi_connect(sl_wifi_interface_t interface,
   return SL_STATUS_OK;
 }
 
+sl_status_t sl_wifi_connect(sl_wifi_interface_t interface,
+                            const sl_wifi_client_configuration_t *ap,
+                            uint32_t timeout_ms)
+{
+  sl_status_t status;
+
+  if (!device_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  if (interface & SL_WIFI_AP_INTERFACE) {
+    return SL_STATUS_NOT_SUPPORTED;
+  }
+
+  if (!sl_wifi_is_interface_up(interface)) {
+    return SL_STATUS_WIFI_INTERFACE_NOT_UP;
+  }
+
+  SL_WIFI_ARGS_CHECK_NULL_POINTER(ap);
+
+  // An asynchronous join cannot fall back to the normal path, so it never uses the cached access point
+  if (timeout_ms == 0) {
+    return sli_wifi_join_access_point(interface, ap, timeout_ms, NULL);
+  }
+
+  uint32_t start_time                    = sl_si91x_host_get_timestamp();
+  sl_wifi_fast_reconnect_entry_t *target = sli_get_fast_reconnect_target(ap);
+
+  if (target != NULL) {
+    fast_reconnect_statistics.fast_attempts++;
+    status = sli_wifi_join_access_point(interface, ap, timeout_ms, target);
+    if (status == SL_STATUS_OK) {
+      uint32_t elapsed_time = sl_si91x_host_elapsed_time(start_time);
+      fast_reconnect_statistics.fast_connections++;
+      fast_reconnect_statistics.last_fast_connect_ms = elapsed_time;
+      fast_reconnect_statistics.total_fast_connect_ms += elapsed_time;
+      return SL_STATUS_OK;
+    }
+
+    // The access point moved or the credential changed, forget it and take the normal path
+    SL_DEBUG_LOG("\r\nFast reconnect failed, error code : 0x%lX, falling back to a full connect\r\n", status);
+    fast_reconnect_statistics.fallbacks++;
+    sli_fast_reconnect_zeroize(target, sizeof(sl_wifi_fast_reconnect_entry_t));
+
+    // The normal path only gets what is left of the caller's timeout
+    uint32_t elapsed_time = sl_si91x_host_elapsed_time(start_time);
+    if (elapsed_time >= timeout_ms) {
+      return SL_STATUS_TIMEOUT;
+    }
+    timeout_ms -= elapsed_time;
+    start_time = sl_si91x_host_get_timestamp();
+  }
+
+  status = sli_wifi_join_access_point(interface, ap, timeout_ms, NULL);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  uint32_t elapsed_time = sl_si91x_host_elapsed_time(start_time);
+  fast_reconnect_statistics.normal_connections++;
+  fast_reconnect_statistics.last_normal_connect_ms = elapsed_time;
+  fast_reconnect_statistics.total_normal_connect_ms += elapsed_time;
+
+  if (fast_reconnect_enabled && sli_fast_reconnect_security_supported(ap->security)) {
+    sli_save_fast_reconnect_entry(interface, ap);
+  }
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wifi_enable_fast_reconnect(void)
+{
+  if (!device_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  fast_reconnect_enabled = true;
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wifi_disable_fast_reconnect(void)
+{
+  fast_reconnect_enabled    = false;
+  fast_reconnect_next_entry = 0;
+  sli_fast_reconnect_zeroize(fast_reconnect_cache, sizeof(fast_reconnect_cache));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wifi_get_fast_reconnect_entry(sl_wifi_credential_id_t credential_id,
+                                             sl_wifi_fast_reconnect_entry_t *entry)
+{
+  SL_WIFI_ARGS_CHECK_NULL_POINTER(entry);
+
+  const sl_wifi_fast_reconnect_entry_t *cached_entry = sli_find_fast_reconnect_entry(credential_id);
+  if (cached_entry == NULL) {
+    return SL_STATUS_NOT_FOUND;
+  }
+
+  // The PMK is only handed out by sl_wifi_export_fast_reconnect_entry()
+  memcpy(entry, cached_entry, sizeof(sl_wifi_fast_reconnect_entry_t));
+  entry->pmk_valid = 0;
+  sli_fast_reconnect_zeroize(entry->pmk, sizeof(entry->pmk));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wifi_export_fast_reconnect_entry(sl_wifi_credential_id_t credential_id,
+                                                sl_wifi_fast_reconnect_entry_t *entry)
+{
+  SL_WIFI_ARGS_CHECK_NULL_POINTER(entry);
+
+  const sl_wifi_fast_reconnect_entry_t *cached_entry = sli_find_fast_reconnect_entry(credential_id);
+  if (cached_entry == NULL) {
+    return SL_STATUS_NOT_FOUND;
+  }
+
+  memcpy(entry, cached_entry, sizeof(sl_wifi_fast_reconnect_entry_t));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wifi_set_fast_reconnect_entry(const sl_wifi_fast_reconnect_entry_t *entry)
+{
+  SL_WIFI_ARGS_CHECK_NULL_POINTER(entry);
+
+  if (!fast_reconnect_enabled) {
+    return SL_STATUS_INVALID_STATE;
+  }
+
+  if ((entry->channel == 0) || (entry->ssid.length > sizeof(entry->ssid.value))
+      || !sli_fast_reconnect_security_supported(entry->security)) {
+    return SL_STATUS_INVALID_PARAMETER;
+  }
+
+  memcpy(sli_allocate_fast_reconnect_entry(entry->credential_id), entry, sizeof(sl_wifi_fast_reconnect_entry_t));
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wifi_get_fast_reconnect_statistics(sl_wifi_fast_reconnect_statistics_t *statistics)
+{
+  SL_WIFI_ARGS_CHECK_NULL_POINTER(statistics);
+
+  memcpy(statistics, &fast_reconnect_statistics, sizeof(sl_wifi_fast_reconnect_statistics_t));
+  return SL_STATUS_OK;
+}
+
 sl_status_t sl_wifi_set_advanced_client_configuration(sl_wifi_interface_t interface,
                                                       const sl_wifi_advanced_client_configuration_t *configuration)
 {
@@ -1763,6 +2283,11 @@ sl_status_t sl_wifi_deinit(void)
   sli_reset_ap_configuration();
   sli_reset_sl_wifi_rate();
   memset(&advanced_scan_configuration, 0, sizeof(sl_wifi_advanced_scan_configuration_t));
+  osMutexAcquire(scan_cache_mutex, 0xFFFFFFFFUL);
+  memset(&scan_cache_configuration, 0, sizeof(sl_wifi_scan_cache_configuration_t));
+  osMutexRelease(scan_cache_mutex);
+  sl_wifi_flush_scan_cache();
+  sl_wifi_disable_fast_reconnect();
   status = sl_si91x_driver_deinit();
   sli_wifi_flush_scan_results_database();
 
@@ -2068,6 +2593,42 @@ sl_status_t sl_wifi_set_advanced_scan_configuration(const sl_wifi_advanced_scan_
   return SL_STATUS_OK;
 }
 
+sl_status_t sl_wifi_set_scan_cache_configuration(const sl_wifi_scan_cache_configuration_t *configuration)
+{
+  SL_WIFI_ARGS_CHECK_NULL_POINTER(configuration);
+
+  if (!device_initialized) {
+    return SL_STATUS_NOT_INITIALIZED;
+  }
+
+  osMutexAcquire(scan_cache_mutex, 0xFFFFFFFFUL);
+  memcpy(&scan_cache_configuration, configuration, sizeof(sl_wifi_scan_cache_configuration_t));
+  osMutexRelease(scan_cache_mutex);
+
+  return SL_STATUS_OK;
+}
+
+sl_status_t sl_wifi_get_scan_cache_statistics(sl_wifi_scan_cache_statistics_t *statistics)
+{
+  SL_WIFI_ARGS_CHECK_NULL_POINTER(statistics);
+
+  osMutexAcquire(scan_cache_mutex, 0xFFFFFFFFUL);
+  memcpy(statistics, &scan_cache_statistics, sizeof(sl_wifi_scan_cache_statistics_t));
+  osMutexRelease(scan_cache_mutex);
+
+  return SL_STATUS_OK;
+}
+
+void sl_wifi_flush_scan_cache(void)
+{
+  osMutexAcquire(scan_cache_mutex, 0xFFFFFFFFUL);
+  memset(scan_cache, 0, sizeof(scan_cache));
+  memset(&scan_cache_statistics, 0, sizeof(scan_cache_statistics));
+  scan_cache_valid_channels = 0;
+  sli_scan_cache_clear_pending();
+  osMutexRelease(scan_cache_mutex);
+}
+
 sl_status_t sl_wifi_get_advanced_scan_configuration(sl_wifi_advanced_scan_configuration_t *configuration)
 {
   SL_WIFI_ARGS_CHECK_NULL_POINTER(configuration);
@@ -69,6 +69,9 @@ sl_status_t sl_wifi_default_event_handler(sl_wifi_event_t event, sl_wifi_buffer_
   sl_wifi_system_packet_t *packet = (sl_wifi_system_packet_t *)sl_si91x_host_get_buffer_data(buffer, 0, NULL);
   if (SL_WIFI_CHECK_IF_EVENT_FAILED(event)) {
     sl_status_t status = sli_convert_and_save_firmware_status(sli_get_si91x_frame_status(packet));
+    if (packet->command == SLI_WLAN_RSP_SCAN) {
+      sli_wifi_scan_cache_abort();
+    }
     if (packet->command == SLI_WLAN_RSP_JOIN) {
       sl_status_t temp_status = sli_si91x_driver_send_command(SLI_WLAN_REQ_INIT,
                                                               SLI_SI91X_WLAN_CMD,
@@ -112,6 +115,11 @@ sl_status_t sl_wifi_default_event_handler(sl_wifi_event_t event, sl_wifi_buffer_
       rx_cb_data.status = SL_STATUS_UNKNOWN_PEER;
 
     return entry->function(event, &rx_cb_data, 0, entry->arg);
+  } else if ((event == SL_WIFI_SCAN_RESULT_EVENT) && (packet->command == SLI_WLAN_RSP_SCAN)) {
+    // Feed the scan result cache; a partial channel refresh is queued again merged with the cached channels
+    if (sli_wifi_scan_cache_update((sl_wifi_scan_result_t *)packet->data, packet->length)) {
+      return SL_STATUS_OK;
+    }
   }
 
   if (packet->length) {
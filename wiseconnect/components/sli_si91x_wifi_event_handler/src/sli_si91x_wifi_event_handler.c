@@ -399,13 +399,7 @@ static sli_si91x_socket_t *get_socket_from_packet(sl_wifi_system_packet_t *socke
   } else if (socket_packet->command == SLI_WLAN_RSP_SOCKET_CLOSE) {
     if (((sl_si91x_socket_close_response_t *)socket_packet->data)->socket_id == 0) {
       const uint16_t port = ((sl_si91x_socket_close_response_t *)socket_packet->data)->port_number;
-      for (int i = 0; i < SLI_NUMBER_OF_SOCKETS; ++i) {
-        if (sli_si91x_sockets[i] != NULL && sli_si91x_sockets[i]->local_address.sin6_port == port
-            && sli_si91x_sockets[i]->state == LISTEN) {
-          return sli_si91x_sockets[i];
-        }
-      }
-      return NULL;
+      return sli_si91x_get_listening_socket_from_port(port);
     }
     return sli_si91x_get_socket_from_id(socket_id, RESET, -1);
   } else {
@@ -1339,10 +1333,13 @@ static inline void sli_si91x_wifi_handle_rx_events(uint32_t *event)
               } else {
                 sli_si91x_add_to_queue(&socket->rx_data_queue, buffer);
                 set_async_event(NCP_HOST_SOCKET_DATA_NOTIFICATION_EVENT);
+                // Unsolicited data, the socket is readable until it is consumed
+                sli_si91x_socket_set_poll_event(socket, SL_SI91X_SOCKET_POLL_IN);
               }
             } else {
               sli_si91x_add_to_queue(&socket->rx_data_queue, buffer);
               set_async_event(NCP_HOST_SOCKET_DATA_NOTIFICATION_EVENT);
+              sli_si91x_socket_set_poll_event(socket, SL_SI91X_SOCKET_POLL_IN);
             }
             socket->command_queue.command_tickcount = 0;
             socket->command_queue.command_timeout   = 0;
@@ -1480,6 +1477,7 @@ static inline void sli_si91x_wifi_handle_tx_event(uint32_t *event)
         sl_status_t status = bus_write_data_frame(&sli_si91x_sockets[i]->tx_data_queue);
         if (status == SL_STATUS_OK) {
           --sli_si91x_sockets[i]->data_buffer_count;
+          sli_si91x_socket_set_poll_event(sli_si91x_sockets[i], SL_SI91X_SOCKET_POLL_OUT);
         }
         if (sli_si91x_buffer_queue_empty(&sli_si91x_sockets[i]->tx_data_queue)) {
           tx_socket_data_queues_status &= ~(1 << i);
@@ -1829,6 +1827,27 @@ sl_status_t sli_create_generic_rx_packet_from_params(sli_si91x_queue_packet_t **
   return SL_STATUS_OK;
 }
 
+// Queue a host generated WLAN packet so it is delivered from the event handler thread like a NWP event
+sl_status_t sli_si91x_post_wlan_event(uint16_t command, const void *data, uint16_t data_length)
+{
+  sl_wifi_buffer_t *buffer = NULL;
+  sl_status_t status       = sli_si91x_host_allocate_buffer(&buffer,
+                                                            SL_WIFI_RX_FRAME_BUFFER,
+                                                            sizeof(((sl_wifi_system_packet_t *)0)->desc) + data_length,
+                                                            SLI_WIFI_ALLOCATE_COMMAND_BUFFER_WAIT_TIME);
+  VERIFY_STATUS_AND_RETURN(status);
+
+  sl_wifi_system_packet_t *packet = sl_si91x_host_get_buffer_data(buffer, 0, NULL);
+  memset(packet->desc, 0, sizeof(packet->desc));
+  packet->command = command;
+  packet->length  = data_length;
+  memcpy(packet->data, data, data_length);
+
+  sli_si91x_add_to_queue(&cmd_queues[SLI_SI91X_WLAN_CMD].event_queue, buffer);
+  set_async_event(NCP_HOST_WLAN_NOTIFICATION_EVENT);
+  return SL_STATUS_OK;
+}
+
 // Weak implementation of the function to process data frames received from the SI91x module
 __WEAK sl_status_t sl_si91x_host_process_data_frame(sl_wifi_interface_t interface, sl_wifi_buffer_t *buffer)
 {